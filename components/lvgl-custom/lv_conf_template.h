@@ -216,6 +216,13 @@
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
          *  - 0: disables caching */
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+
+        /** Size of the arc coverage cache in bytes.
+         *  Arcs drawn with a color (not an image) are rasterized once per radius, width, angles
+         *  and rounding; only the covered pixels of each row are kept (A8).
+         *  Later draws of the same arc blend the cached coverage instead of evaluating the masks.
+         *  - 0: disables caching */
+        #define LV_DRAW_SW_ARC_CACHE_SIZE 0
     #endif
 
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
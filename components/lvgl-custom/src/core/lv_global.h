@@ -142,6 +142,9 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+    lv_draw_sw_arc_cache_t sw_arc_cache;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
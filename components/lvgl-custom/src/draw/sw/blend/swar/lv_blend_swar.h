@@ -0,0 +1,45 @@
+/**
+ * @file lv_blend_swar.h
+ *
+ */
+
+#ifndef LV_BLEND_SWAR_H
+#define LV_BLEND_SWAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SWAR
+
+#include "lv_draw_sw_blend_swar_to_rgb565.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SWAR */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_SWAR_H*/
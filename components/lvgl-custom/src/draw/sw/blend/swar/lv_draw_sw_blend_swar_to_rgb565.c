@@ -0,0 +1,379 @@
+/**
+ * @file lv_draw_sw_blend_swar_to_rgb565.c
+ *
+ * `lv_color_16_16_mix()` spreads one RGB565 pixel over a 32-bit word as
+ * B (bits 0..4), R (11..15) and G (21..26), so a single multiplication mixes
+ * all three channels. The gaps above the channels take the product with the
+ * 5-bit mix factor, and each channel's result is independent of the others.
+ *
+ * The same layout also holds "every other channel" of a pixel pair: masking a
+ * word of two pixels with 0x07E0F81F keeps B0, R0 and G1, masking it rotated
+ * by 16 bits keeps B1, R1 and G0. Two multiplications then mix both pixels
+ * with the same factor, and a rotation puts the channels back in place.
+ *
+ * Only pairs sharing a mix factor can be mixed this way. With a mask the
+ * factor is (mask + 4) >> 3, so neighbouring pixels often share it anyway.
+ * Other pairs fall back to one pixel at a time.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_draw_sw_blend_swar_to_rgb565.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SWAR
+
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_types.h"
+#include "../lv_draw_sw_blend_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*B0, R0 and G1 of a pixel pair (0x7E0F81F = 0b00000111111000001111100000011111)*/
+#define SWAR_MASK   0x07E0F81FU
+
+/*Full-cover mix factor*/
+#define SWAR_MIX_COVER  32U
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride);
+
+static inline uint32_t swar_mix_factor(lv_opa_t opa);
+static inline uint32_t swar_mask_factor(lv_opa_t mask, lv_opa_t opa);
+static inline uint32_t swar_rotate16(uint32_t v);
+static inline uint32_t swar_spread(uint16_t c);
+static inline uint32_t swar_mix_channels(uint32_t fg, uint32_t bg, uint32_t mix);
+static inline uint16_t swar_mix_1(uint32_t fg_spread, uint16_t bg, uint32_t mix);
+static inline uint32_t swar_mix_2(uint32_t fg_a, uint32_t fg_b, uint32_t bg, uint32_t mix);
+static inline uint32_t swar_load_2(const uint16_t * src);
+
+static void color_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc, lv_opa_t opa);
+static void rgb565_mask_blend(lv_draw_sw_blend_image_dsc_t * dsc, lv_opa_t opa);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_swar_color_to_rgb565_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    int32_t dest_stride = dsc->dest_stride;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    uint32_t mix = swar_mix_factor(dsc->opa);
+
+    if(mix == 0) return LV_RESULT_OK;
+
+    uint32_t fg = swar_spread(lv_color_to_u16(dsc->color));
+
+    /*Flat backgrounds repeat the same pair: reuse the last result*/
+    uint32_t last_bg32 = 0;
+    uint32_t last_res32 = swar_mix_2(fg, fg, 0, mix);
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x = 0;
+        if(w > 0 && ((lv_uintptr_t)dest_buf_u16 & 0x2)) {
+            dest_buf_u16[0] = swar_mix_1(fg, dest_buf_u16[0], mix);
+            x = 1;
+        }
+
+        for(; x < w - 1; x += 2) {
+            uint32_t * dest32 = (uint32_t *)&dest_buf_u16[x];
+            uint32_t bg32 = *dest32;
+            if(bg32 != last_bg32) {
+                last_bg32 = bg32;
+                last_res32 = swar_mix_2(fg, fg, bg32, mix);
+            }
+            *dest32 = last_res32;
+        }
+
+        if(x < w) {
+            dest_buf_u16[x] = swar_mix_1(fg, dest_buf_u16[x], mix);
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_swar_color_to_rgb565_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mask_blend(dsc, LV_OPA_COVER);
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_swar_color_to_rgb565_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mask_blend(dsc, dsc->opa);
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_swar_rgb565_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    int32_t dest_stride = dsc->dest_stride;
+    int32_t src_stride = dsc->src_stride;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    uint32_t mix = swar_mix_factor(dsc->opa);
+
+    if(mix == 0) return LV_RESULT_OK;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x = 0;
+        if(w > 0 && ((lv_uintptr_t)dest_buf_u16 & 0x2)) {
+            dest_buf_u16[0] = swar_mix_1(swar_spread(src_buf_u16[0]), dest_buf_u16[0], mix);
+            x = 1;
+        }
+
+        for(; x < w - 1; x += 2) {
+            uint32_t * dest32 = (uint32_t *)&dest_buf_u16[x];
+            uint32_t src32 = swar_load_2(&src_buf_u16[x]);
+            *dest32 = swar_mix_2(src32 & SWAR_MASK, swar_rotate16(src32) & SWAR_MASK, *dest32, mix);
+        }
+
+        if(x < w) {
+            dest_buf_u16[x] = swar_mix_1(swar_spread(src_buf_u16[x]), dest_buf_u16[x], mix);
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_swar_rgb565_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_mask_blend(dsc, LV_OPA_COVER);
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_swar_rgb565_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t *
+                                                                                      dsc)
+{
+    rgb565_mask_blend(dsc, dsc->opa);
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Blend a color through a mask
+ * @param dsc   fill descriptor with `mask_buf` set
+ * @param opa   overall opacity, LV_OPA_COVER (or >= LV_OPA_MAX) to use the mask alone
+ */
+static void LV_ATTRIBUTE_FAST_MEM color_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc, lv_opa_t opa)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    int32_t dest_stride = dsc->dest_stride;
+    int32_t mask_stride = dsc->mask_stride;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint32_t color32 = (uint32_t)color16 | ((uint32_t)color16 << 16);
+    uint32_t fg = swar_spread(color16);
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x = 0;
+        if(w > 0 && ((lv_uintptr_t)dest_buf_u16 & 0x2)) {
+            dest_buf_u16[0] = swar_mix_1(fg, dest_buf_u16[0], swar_mask_factor(mask[0], opa));
+            x = 1;
+        }
+
+        for(; x < w - 1; x += 2) {
+            uint32_t mix0 = swar_mask_factor(mask[x], opa);
+            uint32_t mix1 = swar_mask_factor(mask[x + 1], opa);
+            if(mix0 == mix1) {
+                if(mix0 == 0) continue;
+
+                uint32_t * dest32 = (uint32_t *)&dest_buf_u16[x];
+                if(mix0 == SWAR_MIX_COVER) *dest32 = color32;
+                else *dest32 = swar_mix_2(fg, fg, *dest32, mix0);
+            }
+            else {
+                dest_buf_u16[x] = swar_mix_1(fg, dest_buf_u16[x], mix0);
+                dest_buf_u16[x + 1] = swar_mix_1(fg, dest_buf_u16[x + 1], mix1);
+            }
+        }
+
+        if(x < w) {
+            dest_buf_u16[x] = swar_mix_1(fg, dest_buf_u16[x], swar_mask_factor(mask[x], opa));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        mask += mask_stride;
+    }
+}
+
+/**
+ * Blend an RGB565 image through a mask (e.g. the alpha plane of RGB565A8)
+ * @param dsc   image descriptor with `mask_buf` set
+ * @param opa   overall opacity, LV_OPA_COVER (or >= LV_OPA_MAX) to use the mask alone
+ */
+static void LV_ATTRIBUTE_FAST_MEM rgb565_mask_blend(lv_draw_sw_blend_image_dsc_t * dsc, lv_opa_t opa)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    int32_t dest_stride = dsc->dest_stride;
+    int32_t src_stride = dsc->src_stride;
+    int32_t mask_stride = dsc->mask_stride;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x = 0;
+        if(w > 0 && ((lv_uintptr_t)dest_buf_u16 & 0x2)) {
+            dest_buf_u16[0] = swar_mix_1(swar_spread(src_buf_u16[0]), dest_buf_u16[0], swar_mask_factor(mask[0], opa));
+            x = 1;
+        }
+
+        for(; x < w - 1; x += 2) {
+            uint32_t mix0 = swar_mask_factor(mask[x], opa);
+            uint32_t mix1 = swar_mask_factor(mask[x + 1], opa);
+            if(mix0 == mix1) {
+                if(mix0 == 0) continue;
+
+                uint32_t * dest32 = (uint32_t *)&dest_buf_u16[x];
+                uint32_t src32 = swar_load_2(&src_buf_u16[x]);
+                if(mix0 == SWAR_MIX_COVER) *dest32 = src32;
+                else *dest32 = swar_mix_2(src32 & SWAR_MASK, swar_rotate16(src32) & SWAR_MASK, *dest32, mix0);
+            }
+            else {
+                dest_buf_u16[x] = swar_mix_1(swar_spread(src_buf_u16[x]), dest_buf_u16[x], mix0);
+                dest_buf_u16[x + 1] = swar_mix_1(swar_spread(src_buf_u16[x + 1]), dest_buf_u16[x + 1], mix1);
+            }
+        }
+
+        if(x < w) {
+            dest_buf_u16[x] = swar_mix_1(swar_spread(src_buf_u16[x]), dest_buf_u16[x], swar_mask_factor(mask[x], opa));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+        mask += mask_stride;
+    }
+}
+
+/**
+ * 5-bit mix factor of an opacity, as in `lv_color_16_16_mix()`
+ * @param opa   opacity 0..255
+ * @return      0..32
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM swar_mix_factor(lv_opa_t opa)
+{
+    return ((uint32_t)opa + 4) >> 3;
+}
+
+/**
+ * 5-bit mix factor of a mask value combined with the overall opacity
+ * @param mask  mask value 0..255
+ * @param opa   overall opacity, >= LV_OPA_MAX to use the mask alone
+ * @return      0..32
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM swar_mask_factor(lv_opa_t mask, lv_opa_t opa)
+{
+    if(opa >= LV_OPA_MAX) return swar_mix_factor(mask);
+    return swar_mix_factor(LV_OPA_MIX2(mask, opa));
+}
+
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM swar_rotate16(uint32_t v)
+{
+    return (v >> 16) | (v << 16);
+}
+
+/**
+ * Spread one pixel to B, R and G channel slots
+ * @param c     RGB565 pixel
+ * @return      the channels at bits 0..4, 11..15 and 21..26
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM swar_spread(uint16_t c)
+{
+    return ((uint32_t)c | ((uint32_t)c << 16)) & SWAR_MASK;
+}
+
+/**
+ * Mix spread channels
+ * @param fg    foreground channels (SWAR_MASK layout)
+ * @param bg    background channels (SWAR_MASK layout)
+ * @param mix   0..32
+ * @return      bg + (fg - bg) * mix / 32 per channel, SWAR_MASK layout
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM swar_mix_channels(uint32_t fg, uint32_t bg, uint32_t mix)
+{
+    return ((((fg - bg) * mix) >> 5) + bg) & SWAR_MASK;
+}
+
+/**
+ * Mix one pixel
+ * @param fg_spread foreground pixel, spread with `swar_spread()`
+ * @param bg        background pixel
+ * @param mix       0..32
+ * @return          same as `lv_color_16_16_mix()`
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM swar_mix_1(uint32_t fg_spread, uint16_t bg, uint32_t mix)
+{
+    uint32_t res = swar_mix_channels(fg_spread, swar_spread(bg), mix);
+    return (uint16_t)((res >> 16) | res);
+}
+
+/**
+ * Mix a pixel pair with one factor
+ * @param fg_a  B0, R0 and G1 of the foreground pair (word & SWAR_MASK)
+ * @param fg_b  B1, R1 and G0 of the foreground pair (rotated word & SWAR_MASK)
+ * @param bg    background pair, pixel 0 in the low half
+ * @param mix   0..32
+ * @return      the mixed pair, pixel 0 in the low half
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM swar_mix_2(uint32_t fg_a, uint32_t fg_b, uint32_t bg, uint32_t mix)
+{
+    uint32_t res_a = swar_mix_channels(fg_a, bg & SWAR_MASK, mix);
+    uint32_t res_b = swar_mix_channels(fg_b, swar_rotate16(bg) & SWAR_MASK, mix);
+    return res_a | swar_rotate16(res_b);
+}
+
+/**
+ * Load two source pixels as one word
+ * @param src   pixels, 2-byte aligned
+ * @return      pixel 0 in the low half
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM swar_load_2(const uint16_t * src)
+{
+    if(((lv_uintptr_t)src & 0x2) == 0) return *(const uint32_t *)src;
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 16);
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SWAR */
@@ -79,6 +79,10 @@ void lv_draw_sw_init(void)
     lv_draw_sw_mask_init();
 #endif
 
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+    lv_draw_sw_arc_cache_init();
+#endif
+
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
     draw_sw_unit->base_unit.dispatch_cb = dispatch;
     draw_sw_unit->base_unit.evaluate_cb = evaluate;
@@ -118,6 +122,10 @@ void lv_draw_sw_deinit(void)
     tvg_engine_term(TVG_ENGINE_SW);
 #endif
 
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+    lv_draw_sw_arc_cache_deinit();
+#endif
+
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
 #endif
@@ -33,6 +33,21 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+typedef struct {
+    uint32_t hits;          /**< Arcs blended from cached coverage*/
+    uint32_t misses;        /**< Arcs rasterized (and cached if they fit)*/
+    uint32_t bypasses;      /**< Arcs larger than the cache, drawn with masks directly*/
+    uint32_t evictions;     /**< Entries freed to make room for new arcs*/
+    uint32_t size;          /**< Bytes currently held*/
+    uint32_t entry_cnt;     /**< Arcs currently held*/
+} lv_draw_sw_arc_cache_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -99,6 +114,26 @@ void lv_draw_sw_label(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc, const
  */
 void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords);
 
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+/**
+ * Get the hit/miss counters and the memory usage of the arc coverage cache
+ * @param stats         filled with the current statistics
+ */
+void lv_draw_sw_arc_cache_get_stats(lv_draw_sw_arc_cache_stats_t * stats);
+
+/**
+ * Change the byte budget of the arc coverage cache.
+ * Entries not in use are freed until the cache fits.
+ * @param size          new budget in bytes, 0 disables the cache
+ */
+void lv_draw_sw_arc_cache_resize(uint32_t size);
+
+/**
+ * Free all cached arcs that are not in use
+ */
+void lv_draw_sw_arc_cache_drop_all(void);
+#endif
+
 /**
  * Draw a line with SW render.
  * @param t             pointer to a draw task
@@ -18,26 +18,92 @@
 #include "../../misc/lv_log.h"
 #include "../../stdlib/lv_mem.h"
 #include "../../stdlib/lv_string.h"
+#include "../../core/lv_global.h"
 #include "../lv_draw_private.h"
-
-static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_area, const lv_area_t * circle_area,
-                       lv_opa_t * mask_buf,  int32_t width);
-static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, lv_area_t * res_area);
+#include "lv_draw_sw_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
 #define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
+#define ARC_CACHE_SPAN_GAP_MIN 8  /*Split a cached row into two spans if there are at least this many uncovered pixels between them*/
+
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+    #define ARC_CACHE_ENABLED   1
+    #define arc_cache           LV_GLOBAL_DEFAULT()->sw_arc_cache
+#else
+    #define ARC_CACHE_ENABLED   0
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*The masks of an arc. Every coverage value of the arc comes from `arc_masks_apply`,
+ *so the direct and the cached drawing produce the same pixels*/
+typedef struct {
+    lv_draw_sw_mask_angle_param_t angle_param;
+    lv_draw_sw_mask_radius_param_t out_param;
+    lv_draw_sw_mask_radius_param_t in_param;
+    void * mask_list[4];
+    lv_opa_t * circle_mask;     /*Coverage of the rounded ending, NULL if not rounded*/
+    lv_area_t round_area_1;
+    lv_area_t round_area_2;
+    int32_t width;
+} arc_masks_t;
+
+#if ARC_CACHE_ENABLED
+/*A row of a thin arc is covered in at most two spans (left and right side of the ring),
+ *the pixels between them are not stored*/
+typedef struct {
+    int32_t x1[2];              /*First pixel of the spans, relative to the center*/
+    uint16_t len[2];            /*Length of the spans, 0: empty span*/
+} arc_cache_row_t;
+
+/*An entry is one allocation: this header, `h` rows, then the coverage of the spans row by row.
+ *Coverage is stored relative to the center, so the arc can be moved without a miss.*/
+struct _lv_draw_sw_arc_cache_entry_t {
+    int32_t radius;
+    int32_t width;
+    int32_t start_angle;
+    int32_t end_angle;
+    bool rounded;
+
+    int32_t y1;                 /*First row, relative to the center*/
+    int32_t h;                  /*Number of rows*/
+    uint32_t size;              /*Size of the allocation*/
+    uint32_t last_used;         /*Value of the cache's clock at the last use*/
+    uint32_t used_cnt;          /*Draws using this entry right now, it's not evicted while > 0*/
+};
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static void arc_masks_init(arc_masks_t * masks, const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                           int32_t start_angle, int32_t end_angle, int32_t width);
+static lv_draw_sw_mask_res_t arc_masks_apply(arc_masks_t * masks, lv_opa_t * mask_buf, int32_t abs_x, int32_t abs_y,
+                                             int32_t len);
+static void arc_masks_free(arc_masks_t * masks);
+static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_area, const lv_area_t * circle_area,
+                       lv_opa_t * mask_buf,  int32_t width);
+static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, lv_area_t * res_area);
+
+#if ARC_CACHE_ENABLED
+static bool arc_cache_draw(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                           const lv_area_t * clipped_area, int32_t start_angle, int32_t end_angle, int32_t width);
+static lv_draw_sw_arc_cache_entry_t * arc_cache_find(const lv_draw_arc_dsc_t * dsc, int32_t start_angle,
+                                                     int32_t end_angle);
+static lv_draw_sw_arc_cache_entry_t * arc_cache_render(const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                                                       int32_t start_angle, int32_t end_angle, int32_t width);
+static bool arc_cache_insert(lv_draw_sw_arc_cache_entry_t * entry);
+static void arc_cache_evict(uint32_t idx);
+static void arc_cache_blend(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc,
+                            const lv_draw_sw_arc_cache_entry_t * entry, const lv_area_t * clipped_area);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -78,37 +144,20 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
         return;
     }
 
-    lv_area_t area_in;
-    lv_area_copy(&area_in, &area_out);
-    area_in.x1 += dsc->width;
-    area_in.y1 += dsc->width;
-    area_in.x2 -= dsc->width;
-    area_in.y2 -= dsc->width;
-
     int32_t start_angle = (int32_t)dsc->start_angle;
     int32_t end_angle = (int32_t)dsc->end_angle;
     while(start_angle >= 360) start_angle -= 360;
     while(end_angle >= 360) end_angle -= 360;
 
-    void * mask_list[4] = {0};
-    /*Create an angle mask*/
-    lv_draw_sw_mask_angle_param_t mask_angle_param;
-    lv_draw_sw_mask_angle_init(&mask_angle_param, dsc->center.x, dsc->center.y, start_angle, end_angle);
-    mask_list[0] = &mask_angle_param;
-
-    /*Create an outer mask*/
-    lv_draw_sw_mask_radius_param_t mask_out_param;
-    lv_draw_sw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
-    mask_list[1] = &mask_out_param;
-
-    /*Create inner the mask*/
-    lv_draw_sw_mask_radius_param_t mask_in_param;
-    bool mask_in_param_valid = false;
-    if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
-        lv_draw_sw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
-        mask_list[2] = &mask_in_param;
-        mask_in_param_valid = true;
+#if ARC_CACHE_ENABLED
+    if(dsc->img_src == NULL &&
+       arc_cache_draw(t, dsc, &area_out, &clipped_area, start_angle, end_angle, width)) {
+        return;
     }
+#endif
+
+    arc_masks_t masks;
+    arc_masks_init(&masks, dsc, &area_out, start_angle, end_angle, width);
 
     int32_t blend_h = lv_area_get_height(&clipped_area);
     int32_t blend_w = lv_area_get_width(&clipped_area);
@@ -152,57 +201,9 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
         }
     }
 
-    lv_opa_t * circle_mask = NULL;
-    lv_area_t round_area_1;
-    lv_area_t round_area_2;
-    if(dsc->rounded) {
-        circle_mask = lv_malloc(width * width);
-        LV_ASSERT_MALLOC(circle_mask);
-        lv_memset(circle_mask, 0xff, width * width);
-        lv_area_t circle_area = {0, 0, width - 1, width - 1};
-        lv_draw_sw_mask_radius_param_t circle_mask_param;
-        lv_draw_sw_mask_radius_init(&circle_mask_param, &circle_area, width / 2, false);
-        void * circle_mask_list[2] = {&circle_mask_param, NULL};
-
-        lv_opa_t * circle_mask_tmp = circle_mask;
-        for(h = 0; h < width; h++) {
-            lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(circle_mask_list, circle_mask_tmp, 0, h, width);
-            if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                lv_memzero(circle_mask_tmp, width);
-            }
-
-            circle_mask_tmp += width;
-        }
-        lv_draw_sw_mask_free_param(&circle_mask_param);
-
-        get_rounded_area(start_angle, dsc->radius, width, &round_area_1);
-        lv_area_move(&round_area_1, dsc->center.x, dsc->center.y);
-        get_rounded_area(end_angle, dsc->radius, width, &round_area_2);
-        lv_area_move(&round_area_2, dsc->center.x, dsc->center.y);
-
-    }
-
     blend_area.y2 = blend_area.y1;
     for(h = 0; h < blend_h; h++) {
-        lv_memset(mask_buf, 0xff, blend_w);
-        blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w);
-
-        if(dsc->rounded) {
-            if(blend_area.y1 >= round_area_1.y1 && blend_area.y1 <= round_area_1.y2) {
-                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                    lv_memzero(mask_buf, blend_w);
-                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
-                }
-                add_circle(circle_mask, &blend_area, &round_area_1, mask_buf, width);
-            }
-            if(blend_area.y1 >= round_area_2.y1 && blend_area.y1 <= round_area_2.y2) {
-                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                    lv_memzero(mask_buf, blend_w);
-                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
-                }
-                add_circle(circle_mask, &blend_area, &round_area_2, mask_buf, width);
-            }
-        }
+        blend_dsc.mask_res = arc_masks_apply(&masks, mask_buf, blend_area.x1, blend_area.y1, blend_w);
 
         /*If it was an RGB565A8 image use consider its A8 part on the mask*/
         if(img_mask && blend_dsc.mask_res != LV_DRAW_SW_MASK_RES_TRANSP) {
@@ -225,15 +226,10 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
         blend_area.y2 ++;
     }
 
-    lv_draw_sw_mask_free_param(&mask_angle_param);
-    lv_draw_sw_mask_free_param(&mask_out_param);
-    if(mask_in_param_valid) {
-        lv_draw_sw_mask_free_param(&mask_in_param);
-    }
+    arc_masks_free(&masks);
 
     lv_free(mask_buf);
     if(dsc->img_src) lv_image_decoder_close(&decoder_dsc);
-    if(circle_mask) lv_free(circle_mask);
 #else
     LV_LOG_WARN("Can't draw arc with LV_DRAW_SW_COMPLEX == 0");
     LV_UNUSED(center);
@@ -245,10 +241,453 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
 
+#if ARC_CACHE_ENABLED
+
+void lv_draw_sw_arc_cache_init(void)
+{
+    lv_memzero(&arc_cache, sizeof(arc_cache));
+    arc_cache.max_size = LV_DRAW_SW_ARC_CACHE_SIZE;
+    lv_mutex_init(&arc_cache.lock);
+}
+
+void lv_draw_sw_arc_cache_deinit(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_ARC_CACHE_ENTRY_CNT; i++) {
+        lv_free(arc_cache.entries[i]);
+        arc_cache.entries[i] = NULL;
+    }
+    arc_cache.size = 0;
+    lv_mutex_delete(&arc_cache.lock);
+}
+
+void lv_draw_sw_arc_cache_get_stats(lv_draw_sw_arc_cache_stats_t * stats)
+{
+    lv_mutex_lock(&arc_cache.lock);
+    *stats = arc_cache.stats;
+    stats->size = arc_cache.size;
+    stats->entry_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_ARC_CACHE_ENTRY_CNT; i++) {
+        if(arc_cache.entries[i]) stats->entry_cnt++;
+    }
+    lv_mutex_unlock(&arc_cache.lock);
+}
+
+void lv_draw_sw_arc_cache_resize(uint32_t size)
+{
+    lv_mutex_lock(&arc_cache.lock);
+    arc_cache.max_size = size;
+
+    /*Entries in use stay until the next resize or eviction*/
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_ARC_CACHE_ENTRY_CNT && arc_cache.size > size; i++) {
+        if(arc_cache.entries[i] && arc_cache.entries[i]->used_cnt == 0) arc_cache_evict(i);
+    }
+    lv_mutex_unlock(&arc_cache.lock);
+}
+
+void lv_draw_sw_arc_cache_drop_all(void)
+{
+    lv_mutex_lock(&arc_cache.lock);
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_ARC_CACHE_ENTRY_CNT; i++) {
+        if(arc_cache.entries[i] && arc_cache.entries[i]->used_cnt == 0) arc_cache_evict(i);
+    }
+    lv_mutex_unlock(&arc_cache.lock);
+}
+
+#endif /*ARC_CACHE_ENABLED*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void arc_masks_init(arc_masks_t * masks, const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                           int32_t start_angle, int32_t end_angle, int32_t width)
+{
+    lv_memzero(masks, sizeof(arc_masks_t));
+    masks->width = width;
+
+    /*Create an angle mask*/
+    lv_draw_sw_mask_angle_init(&masks->angle_param, dsc->center.x, dsc->center.y, start_angle, end_angle);
+    masks->mask_list[0] = &masks->angle_param;
+
+    /*Create an outer mask*/
+    lv_draw_sw_mask_radius_init(&masks->out_param, area_out, LV_RADIUS_CIRCLE, false);
+    masks->mask_list[1] = &masks->out_param;
+
+    /*Create inner the mask*/
+    lv_area_t area_in;
+    lv_area_copy(&area_in, area_out);
+    area_in.x1 += dsc->width;
+    area_in.y1 += dsc->width;
+    area_in.x2 -= dsc->width;
+    area_in.y2 -= dsc->width;
+    if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
+        lv_draw_sw_mask_radius_init(&masks->in_param, &area_in, LV_RADIUS_CIRCLE, true);
+        masks->mask_list[2] = &masks->in_param;
+    }
+
+    if(dsc->rounded) {
+        masks->circle_mask = lv_malloc(width * width);
+        LV_ASSERT_MALLOC(masks->circle_mask);
+        lv_memset(masks->circle_mask, 0xff, width * width);
+        lv_area_t circle_area = {0, 0, width - 1, width - 1};
+        lv_draw_sw_mask_radius_param_t circle_mask_param;
+        lv_draw_sw_mask_radius_init(&circle_mask_param, &circle_area, width / 2, false);
+        void * circle_mask_list[2] = {&circle_mask_param, NULL};
+
+        lv_opa_t * circle_mask_tmp = masks->circle_mask;
+        int32_t h;
+        for(h = 0; h < width; h++) {
+            lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(circle_mask_list, circle_mask_tmp, 0, h, width);
+            if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                lv_memzero(circle_mask_tmp, width);
+            }
+
+            circle_mask_tmp += width;
+        }
+        lv_draw_sw_mask_free_param(&circle_mask_param);
+
+        get_rounded_area(start_angle, dsc->radius, width, &masks->round_area_1);
+        lv_area_move(&masks->round_area_1, dsc->center.x, dsc->center.y);
+        get_rounded_area(end_angle, dsc->radius, width, &masks->round_area_2);
+        lv_area_move(&masks->round_area_2, dsc->center.x, dsc->center.y);
+    }
+}
+
+/**
+ * Calculate the coverage of the arc in a part of a row
+ * @param masks     the arc's masks
+ * @param mask_buf  store the coverage here
+ * @param abs_x     absolute X coordinate of the first pixel
+ * @param abs_y     absolute Y coordinate of the row
+ * @param len       number of pixels
+ * @return          the result of the masks: `mask_buf` is valid unless LV_DRAW_SW_MASK_RES_TRANSP
+ */
+static lv_draw_sw_mask_res_t arc_masks_apply(arc_masks_t * masks, lv_opa_t * mask_buf, int32_t abs_x, int32_t abs_y,
+                                             int32_t len)
+{
+    lv_memset(mask_buf, 0xff, len);
+    lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(masks->mask_list, mask_buf, abs_x, abs_y, len);
+
+    if(masks->circle_mask) {
+        lv_area_t row_area = {abs_x, abs_y, abs_x + len - 1, abs_y};
+        if(abs_y >= masks->round_area_1.y1 && abs_y <= masks->round_area_1.y2) {
+            if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                lv_memzero(mask_buf, len);
+                res = LV_DRAW_SW_MASK_RES_CHANGED;
+            }
+            add_circle(masks->circle_mask, &row_area, &masks->round_area_1, mask_buf, masks->width);
+        }
+        if(abs_y >= masks->round_area_2.y1 && abs_y <= masks->round_area_2.y2) {
+            if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                lv_memzero(mask_buf, len);
+                res = LV_DRAW_SW_MASK_RES_CHANGED;
+            }
+            add_circle(masks->circle_mask, &row_area, &masks->round_area_2, mask_buf, masks->width);
+        }
+    }
+
+    return res;
+}
+
+static void arc_masks_free(arc_masks_t * masks)
+{
+    lv_draw_sw_mask_free_param(&masks->angle_param);
+    lv_draw_sw_mask_free_param(&masks->out_param);
+    if(masks->mask_list[2]) {
+        lv_draw_sw_mask_free_param(&masks->in_param);
+    }
+    if(masks->circle_mask) lv_free(masks->circle_mask);
+}
+
+#if ARC_CACHE_ENABLED
+
+/**
+ * Draw an arc from the cache, rasterizing it into the cache on a miss
+ * @return          false if the arc doesn't fit into the cache: draw it with the masks directly
+ */
+static bool arc_cache_draw(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                           const lv_area_t * clipped_area, int32_t start_angle, int32_t end_angle, int32_t width)
+{
+    if(arc_cache.max_size == 0) return false;
+
+    lv_mutex_lock(&arc_cache.lock);
+    lv_draw_sw_arc_cache_entry_t * entry = arc_cache_find(dsc, start_angle, end_angle);
+    if(entry) {
+        arc_cache.stats.hits++;
+        entry->used_cnt++;
+    }
+    lv_mutex_unlock(&arc_cache.lock);
+
+    bool cached = true;
+    if(entry == NULL) {
+        entry = arc_cache_render(dsc, area_out, start_angle, end_angle, width);
+        if(entry == NULL) return false;
+
+        lv_mutex_lock(&arc_cache.lock);
+        cached = arc_cache_insert(entry);
+        lv_mutex_unlock(&arc_cache.lock);
+    }
+
+    arc_cache_blend(t, dsc, entry, clipped_area);
+
+    if(cached) {
+        lv_mutex_lock(&arc_cache.lock);
+        entry->used_cnt--;
+        lv_mutex_unlock(&arc_cache.lock);
+    }
+    else {
+        lv_free(entry);
+    }
+
+    return true;
+}
+
+static lv_draw_sw_arc_cache_entry_t * arc_cache_find(const lv_draw_arc_dsc_t * dsc, int32_t start_angle,
+                                                     int32_t end_angle)
+{
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_ARC_CACHE_ENTRY_CNT; i++) {
+        lv_draw_sw_arc_cache_entry_t * entry = arc_cache.entries[i];
+        if(entry && entry->radius == dsc->radius && entry->width == dsc->width &&
+           entry->start_angle == start_angle && entry->end_angle == end_angle && entry->rounded == dsc->rounded) {
+            entry->last_used = ++arc_cache.clock;
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Rasterize an arc into a new (not yet cached) entry
+ * @return          the new entry or NULL if the arc is too large for the cache
+ */
+static lv_draw_sw_arc_cache_entry_t * arc_cache_render(const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                                                       int32_t start_angle, int32_t end_angle, int32_t width)
+{
+    /*Only scan the area the arc can touch (as invalidated by the widgets) plus a pixel for safety.
+     *The angles are already normalized to [0..360), `lv_draw_arc_get_area` expects end > start*/
+    lv_area_t scan_area;
+    lv_draw_arc_get_area(dsc->center.x, dsc->center.y, dsc->radius, start_angle,
+                         end_angle < start_angle ? end_angle + 360 : end_angle, dsc->width, dsc->rounded, &scan_area);
+    lv_area_increase(&scan_area, 1, 1);
+    if(!lv_area_intersect(&scan_area, &scan_area, area_out)) return NULL;
+
+    int32_t scan_w = lv_area_get_width(&scan_area);
+    int32_t scan_h = lv_area_get_height(&scan_area);
+
+    /*Estimate the size from the arc's length before doing any work: an arc is a band of about
+     *`width + 2` pixels (anti-aliasing) along `radius * angle` pixels*/
+    int32_t angle_span = end_angle - start_angle;
+    if(angle_span < 0) angle_span += 360;
+    uint32_t estimated_size = sizeof(lv_draw_sw_arc_cache_entry_t) + scan_h * sizeof(arc_cache_row_t) +
+                              ((dsc->radius * angle_span * 1144) >> 16) * (width + 2);
+    if(estimated_size > arc_cache.max_size) {
+        lv_mutex_lock(&arc_cache.lock);
+        arc_cache.stats.bypasses++;
+        lv_mutex_unlock(&arc_cache.lock);
+        return NULL;
+    }
+
+    arc_cache_row_t * rows = lv_malloc(scan_h * sizeof(arc_cache_row_t));
+    lv_opa_t * mask_buf = lv_malloc(scan_w);
+    LV_ASSERT_MALLOC(rows);
+    LV_ASSERT_MALLOC(mask_buf);
+    if(rows == NULL || mask_buf == NULL) {
+        lv_free(rows);
+        lv_free(mask_buf);
+        return NULL;
+    }
+
+    arc_masks_t masks;
+    arc_masks_init(&masks, dsc, area_out, start_angle, end_angle, width);
+
+    /*Find the covered spans of each row*/
+    int32_t first_row = -1;
+    int32_t last_row = -1;
+    uint32_t data_size = 0;
+    int32_t y;
+    for(y = 0; y < scan_h; y++) {
+        int32_t x1 = 0;
+        int32_t x2 = -1;
+        if(arc_masks_apply(&masks, mask_buf, scan_area.x1, scan_area.y1 + y, scan_w) != LV_DRAW_SW_MASK_RES_TRANSP) {
+            x2 = scan_w - 1;
+            while(x1 <= x2 && mask_buf[x1] == LV_OPA_TRANSP) x1++;
+            while(x2 >= x1 && mask_buf[x2] == LV_OPA_TRANSP) x2--;
+        }
+
+        /*Find the longest uncovered gap between the first and last covered pixels*/
+        int32_t gap_x1 = x1;
+        int32_t gap_len = 0;
+        int32_t x = x1;
+        while(x < x2) {
+            if(mask_buf[x] != LV_OPA_TRANSP) {
+                x++;
+                continue;
+            }
+            int32_t run_x1 = x;
+            while(mask_buf[x] == LV_OPA_TRANSP) x++;
+            if(x - run_x1 > gap_len) {
+                gap_x1 = run_x1;
+                gap_len = x - run_x1;
+            }
+        }
+
+        arc_cache_row_t * row = &rows[y];
+        row->x1[0] = scan_area.x1 + x1 - dsc->center.x;
+        if(gap_len >= ARC_CACHE_SPAN_GAP_MIN) {
+            row->len[0] = gap_x1 - x1;
+            row->x1[1] = scan_area.x1 + gap_x1 + gap_len - dsc->center.x;
+            row->len[1] = x2 - (gap_x1 + gap_len) + 1;
+        }
+        else {
+            row->len[0] = x2 - x1 + 1;
+            row->x1[1] = 0;
+            row->len[1] = 0;
+        }
+        if(row->len[0] == 0) continue;
+
+        data_size += row->len[0] + row->len[1];
+        if(first_row < 0) first_row = y;
+        last_row = y;
+    }
+
+    int32_t h = first_row < 0 ? 0 : last_row - first_row + 1;
+    uint32_t size = sizeof(lv_draw_sw_arc_cache_entry_t) + h * sizeof(arc_cache_row_t) + data_size;
+    lv_draw_sw_arc_cache_entry_t * entry = NULL;
+    if(size <= arc_cache.max_size) entry = lv_malloc(size);
+
+    if(entry) {
+        entry->radius = dsc->radius;
+        entry->width = dsc->width;
+        entry->start_angle = start_angle;
+        entry->end_angle = end_angle;
+        entry->rounded = dsc->rounded;
+        entry->y1 = scan_area.y1 + first_row - dsc->center.y;
+        entry->h = h;
+        entry->size = size;
+        entry->last_used = 0;
+        entry->used_cnt = 0;
+
+        /*Calculate the coverage again, now only on the covered spans*/
+        arc_cache_row_t * entry_rows = (arc_cache_row_t *)(entry + 1);
+        lv_opa_t * data = (lv_opa_t *)(entry_rows + h);
+        if(h) lv_memcpy(entry_rows, &rows[first_row], h * sizeof(arc_cache_row_t));
+        for(y = 0; y < h; y++) {
+            uint32_t i;
+            for(i = 0; i < 2; i++) {
+                const arc_cache_row_t * row = &entry_rows[y];
+                if(row->len[i] == 0) continue;
+                arc_masks_apply(&masks, data, dsc->center.x + row->x1[i], dsc->center.y + entry->y1 + y, row->len[i]);
+                data += row->len[i];
+            }
+        }
+    }
+
+    arc_masks_free(&masks);
+    lv_free(mask_buf);
+    lv_free(rows);
+
+    lv_mutex_lock(&arc_cache.lock);
+    if(entry) arc_cache.stats.misses++;
+    else arc_cache.stats.bypasses++;
+    lv_mutex_unlock(&arc_cache.lock);
+
+    return entry;
+}
+
+/**
+ * Add a new entry to the cache, evicting the least recently used entries to make room.
+ * Must be called with the cache locked.
+ * @return          true if the entry was added and marked as used, false if it can't be added
+ */
+static bool arc_cache_insert(lv_draw_sw_arc_cache_entry_t * entry)
+{
+    while(1) {
+        uint32_t free_idx = LV_DRAW_SW_ARC_CACHE_ENTRY_CNT;
+        uint32_t lru_idx = LV_DRAW_SW_ARC_CACHE_ENTRY_CNT;
+        uint32_t i;
+        for(i = 0; i < LV_DRAW_SW_ARC_CACHE_ENTRY_CNT; i++) {
+            lv_draw_sw_arc_cache_entry_t * e = arc_cache.entries[i];
+            if(e == NULL) {
+                if(free_idx == LV_DRAW_SW_ARC_CACHE_ENTRY_CNT) free_idx = i;
+            }
+            else if(e->used_cnt == 0 &&
+                    (lru_idx == LV_DRAW_SW_ARC_CACHE_ENTRY_CNT || e->last_used < arc_cache.entries[lru_idx]->last_used)) {
+                lru_idx = i;
+            }
+        }
+
+        if(free_idx < LV_DRAW_SW_ARC_CACHE_ENTRY_CNT && arc_cache.size + entry->size <= arc_cache.max_size) {
+            arc_cache.entries[free_idx] = entry;
+            arc_cache.size += entry->size;
+            entry->used_cnt = 1;
+            entry->last_used = ++arc_cache.clock;
+            return true;
+        }
+
+        if(lru_idx == LV_DRAW_SW_ARC_CACHE_ENTRY_CNT) return false;
+        arc_cache_evict(lru_idx);
+    }
+}
+
+/**
+ * Free an entry. Must be called with the cache locked.
+ * @param idx       index of the entry
+ */
+static void arc_cache_evict(uint32_t idx)
+{
+    arc_cache.size -= arc_cache.entries[idx]->size;
+    arc_cache.stats.evictions++;
+    lv_free(arc_cache.entries[idx]);
+    arc_cache.entries[idx] = NULL;
+}
+
+static void arc_cache_blend(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc,
+                            const lv_draw_sw_arc_cache_entry_t * entry, const lv_area_t * clipped_area)
+{
+    const arc_cache_row_t * rows = (const arc_cache_row_t *)(entry + 1);
+    const lv_opa_t * data = (const lv_opa_t *)(rows + entry->h);
+
+    lv_area_t blend_area;
+    lv_draw_sw_blend_dsc_t blend_dsc = {0};
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.color = dsc->color;
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+    /*Rows and pixels outside of the cached spans are not covered, skip them.
+     *lv_draw_sw_blend() clips the spans horizontally*/
+    int32_t y_ofs = dsc->center.y + entry->y1;
+    int32_t y2 = LV_MIN(clipped_area->y2 - y_ofs, entry->h - 1);
+    int32_t y;
+    for(y = 0; y <= y2; y++) {
+        uint32_t i;
+        for(i = 0; i < 2; i++) {
+            const arc_cache_row_t * row = &rows[y];
+            if(row->len[i] == 0) continue;
+
+            blend_area.x1 = dsc->center.x + row->x1[i];
+            blend_area.x2 = blend_area.x1 + row->len[i] - 1;
+            blend_area.y1 = y + y_ofs;
+            blend_area.y2 = y + y_ofs;
+            if(blend_area.y1 >= clipped_area->y1 &&
+               blend_area.x1 <= clipped_area->x2 && blend_area.x2 >= clipped_area->x1) {
+                blend_dsc.mask_buf = (lv_opa_t *)data;
+                lv_draw_sw_blend(t, &blend_dsc);
+            }
+            data += row->len[i];
+        }
+    }
+}
+
+#endif /*ARC_CACHE_ENABLED*/
+
 static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_area, const lv_area_t * circle_area,
                        lv_opa_t * mask_buf,  int32_t width)
 {
@@ -23,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of arcs the arc coverage cache can hold, the size is limited by LV_DRAW_SW_ARC_CACHE_SIZE*/
+#define LV_DRAW_SW_ARC_CACHE_ENTRY_CNT  8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -58,10 +61,35 @@ typedef struct {
 } lv_draw_sw_shadow_cache_t;
 #endif
 
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+typedef struct _lv_draw_sw_arc_cache_entry_t lv_draw_sw_arc_cache_entry_t;
+
+typedef struct {
+    lv_draw_sw_arc_cache_entry_t * entries[LV_DRAW_SW_ARC_CACHE_ENTRY_CNT];
+    uint32_t size;          /**< Bytes held by the entries*/
+    uint32_t max_size;      /**< Byte budget, see lv_draw_sw_arc_cache_resize()*/
+    uint32_t clock;         /**< Incremented on every lookup to find the least recently used entry*/
+    lv_draw_sw_arc_cache_stats_t stats;
+    lv_mutex_t lock;
+} lv_draw_sw_arc_cache_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+/**
+ * Initialize the arc coverage cache. Called internally by lv_draw_sw_init().
+ */
+void lv_draw_sw_arc_cache_init(void);
+
+/**
+ * Free the arc coverage cache. Called internally by lv_draw_sw_deinit().
+ */
+void lv_draw_sw_arc_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -216,9 +216,16 @@
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
          *  - 0: disables caching */
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+
+        /** Size of the arc coverage cache in bytes.
+         *  The battery gauges (ui_Arc1/ui_Arc2, 3 px rounded arcs) take ~700 bytes per value shown,
+         *  and are blended from the cache instead of rebuilding the angle and radius masks.
+         *  - 0: disables caching */
+        #define LV_DRAW_SW_ARC_CACHE_SIZE (4 * 1024U)
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /** The ESP32-C3 has no SIMD: SWAR mixes two RGB565 pixels per 32-bit word (opacity and masked blends) */
+    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_SWAR
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
         #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
@@ -496,8 +503,10 @@
  *  Used by image decoders such as `lv_lodepng` to keep the decoded image in memory.
  *  If size is not set to 0, the decoder will fail to decode when the cache is full.
  *  If size is 0, the cache function is not enabled and the decoded memory will be
- *  released immediately after use. */
-#define LV_CACHE_DEF_SIZE       0
+ *  released immediately after use.
+ *  Holds the decompressed RLE images (ImageCache): the 52 KB splash logo while
+ *  the splash is shown, ~10 KB of icons afterwards. Must fit the largest image. */
+#define LV_CACHE_DEF_SIZE       (64 * 1024)
 
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
@@ -619,7 +628,7 @@
 #define LV_FONT_MONTSERRAT_34 0
 #define LV_FONT_MONTSERRAT_36 0
 #define LV_FONT_MONTSERRAT_38 0
-#define LV_FONT_MONTSERRAT_40 1
+#define LV_FONT_MONTSERRAT_40 0  /* Pressure readouts use ui_font_pressure_40 (digit subset) */
 #define LV_FONT_MONTSERRAT_42 0
 #define LV_FONT_MONTSERRAT_44 0
 #define LV_FONT_MONTSERRAT_46 0
@@ -958,11 +967,11 @@
 /** GStreamer library */
 #define LV_USE_GSTREAMER 0
 
-/** Decode bin images to RAM */
-#define LV_BIN_DECODER_RAM_LOAD 0
+/** Decode bin images to RAM (required for compressed C-array images) */
+#define LV_BIN_DECODER_RAM_LOAD 1
 
-/** RLE decompress library */
-#define LV_USE_RLE 0
+/** RLE decompress library (squareline/compress_images.py) */
+#define LV_USE_RLE 1
 
 /** QR code library */
 #define LV_USE_QRCODE 0
@@ -1038,7 +1047,7 @@
 /* Documentation for several of the below items can be found here: https://docs.lvgl.io/master/details/auxiliary-modules/index.html . */
 
 /** 1: Enable API to take snapshot for object */
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /** 1: Enable system monitor component */
 #define LV_USE_SYSMON   0
@@ -1072,20 +1081,25 @@
     #endif
 #endif /*LV_USE_SYSMON*/
 
-/** 1: Enable runtime performance profiler */
-#define LV_USE_PROFILER 0
+/** 1: Enable runtime performance profiler
+ *  - Set by the UI_PROFILER build option, see main/Profiler.h */
+#if defined(UI_PROFILER) && UI_PROFILER
+    #define LV_USE_PROFILER 1
+#else
+    #define LV_USE_PROFILER 0
+#endif
 #if LV_USE_PROFILER
     /** 1: Enable the built-in profiler */
     #define LV_USE_PROFILER_BUILTIN 1
     #if LV_USE_PROFILER_BUILTIN
-        /** Default profiler trace buffer size */
-        #define LV_PROFILER_BUILTIN_BUF_SIZE (16 * 1024)     /**< [bytes] */
+        /** Default profiler trace buffer size (24 bytes per event, allocated from the LVGL heap) */
+        #define LV_PROFILER_BUILTIN_BUF_SIZE (12 * 1024)     /**< [bytes] */
         #define LV_PROFILER_BUILTIN_DEFAULT_ENABLE 1
         #define LV_USE_PROFILER_BUILTIN_POSIX 0 /**< Enable POSIX profiler port */
     #endif
 
     /** Header to include for profiler */
-    #define LV_PROFILER_INCLUDE "lvgl/src/misc/lv_profiler_builtin.h"
+    #define LV_PROFILER_INCLUDE "src/misc/lv_profiler_builtin.h"
 
     /** Profiler start point function */
     #define LV_PROFILER_BEGIN    LV_PROFILER_BUILTIN_BEGIN
@@ -1114,8 +1128,8 @@
     /*Enable decoder profiler*/
     #define LV_PROFILER_DECODER 1
 
-    /*Enable font profiler*/
-    #define LV_PROFILER_FONT 1
+    /*Enable font profiler (one event pair per glyph: fills the ring in a frame)*/
+    #define LV_PROFILER_FONT 0
 
     /*Enable fs profiler*/
     #define LV_PROFILER_FS 1
@@ -1127,10 +1141,10 @@
     #define LV_PROFILER_TIMER 1
 
     /*Enable cache profiler*/
-    #define LV_PROFILER_CACHE 1
+    #define LV_PROFILER_CACHE 0
 
-    /*Enable event profiler*/
-    #define LV_PROFILER_EVENT 1
+    /*Enable event profiler (every lv_obj_send_event: fills the ring in a frame)*/
+    #define LV_PROFILER_EVENT 0
 #endif
 
 /** 1: Enable Monkey test */
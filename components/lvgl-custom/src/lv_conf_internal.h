@@ -28,6 +28,7 @@
 #define LV_DRAW_SW_ASM_NONE             0
 #define LV_DRAW_SW_ASM_NEON             1
 #define LV_DRAW_SW_ASM_HELIUM           2
+#define LV_DRAW_SW_ASM_SWAR             3
 #define LV_DRAW_SW_ASM_CUSTOM           255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -613,6 +614,19 @@
                 #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
             #endif
         #endif
+
+        /** Size of the arc coverage cache in bytes.
+         *  Arcs drawn with a color (not an image) are rasterized once per radius, width, angles
+         *  and rounding; only the covered pixels of each row are kept (A8).
+         *  Later draws of the same arc blend the cached coverage instead of evaluating the masks.
+         *  - 0: disables caching */
+        #ifndef LV_DRAW_SW_ARC_CACHE_SIZE
+            #ifdef CONFIG_LV_DRAW_SW_ARC_CACHE_SIZE
+                #define LV_DRAW_SW_ARC_CACHE_SIZE CONFIG_LV_DRAW_SW_ARC_CACHE_SIZE
+            #else
+                #define LV_DRAW_SW_ARC_CACHE_SIZE 0
+            #endif
+        #endif
     #endif
 
     #ifndef LV_USE_DRAW_SW_ASM
@@ -58,6 +58,7 @@ typedef struct _lv_profiler_builtin_ctx_t {
     lv_profiler_builtin_item_t * item_arr; /**< Pointer to an array of profiler items */
     uint32_t item_num;                     /**< Number of profiler items in the array */
     uint32_t cur_index;                    /**< Index of the current profiler item */
+    bool wrapped;                          /**< In ring mode: the items from `cur_index` on are older */
     lv_profiler_builtin_config_t config;   /**< Configuration for the built-in profiler */
     bool enable;                           /**< Whether the built-in profiler is enabled */
 #if LV_USE_OS
@@ -97,6 +98,8 @@ void lv_profiler_builtin_config_init(lv_profiler_builtin_config_t * config)
     config->flush_cb = default_flush_cb;
     config->tid_get_cb = default_tid_get_cb;
     config->cpu_get_cb = default_cpu_get_cb;
+    config->format = LV_PROFILER_BUILTIN_FORMAT_SYSTRACE;
+    config->ring = false;
 }
 
 void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
@@ -136,7 +139,7 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
     profiler_ctx->item_num = num;
     profiler_ctx->config = *config;
 
-    if(profiler_ctx->config.flush_cb) {
+    if(profiler_ctx->config.flush_cb && profiler_ctx->config.format == LV_PROFILER_BUILTIN_FORMAT_SYSTRACE) {
         /* add profiler header for perfetto */
         profiler_ctx->config.flush_cb("# tracer: nop\n");
         profiler_ctx->config.flush_cb("#\n");
@@ -188,7 +191,12 @@ void lv_profiler_builtin_write(const char * func, char tag)
     LV_PROFILER_MULTEX_LOCK;
 
     if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
-        flush_no_lock();
+        if(profiler_ctx->config.ring) {
+            profiler_ctx->wrapped = true;
+        }
+        else {
+            flush_no_lock();
+        }
         profiler_ctx->cur_index = 0;
     }
 
@@ -238,31 +246,47 @@ static void flush_no_lock(void)
         return;
     }
 
-    uint32_t cur = 0;
+    /*After wrapping around, the oldest item is the one to be overwritten next*/
+    uint32_t start = profiler_ctx->wrapped ? profiler_ctx->cur_index : 0;
+    uint32_t cnt = profiler_ctx->wrapped ? profiler_ctx->item_num : profiler_ctx->cur_index;
+    uint32_t i;
     char buf[LV_PROFILER_STR_MAX_LEN];
     uint32_t tick_per_sec = profiler_ctx->config.tick_per_sec;
-    while(cur < profiler_ctx->cur_index) {
-        lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[cur++];
+    for(i = 0; i < cnt; i++) {
+        uint32_t cur = start + i;
+        if(cur >= profiler_ctx->item_num) cur -= profiler_ctx->item_num;
+        lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[cur];
         uint64_t sec = item->tick / tick_per_sec;
         uint64_t nsec = (item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
 
 #if LV_USE_OS
-        lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-%d [%d] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: %c|1|%s\n",
-                    item->tid,
-                    item->cpu,
-                    sec,
-                    nsec,
-                    item->tag,
-                    item->func);
+        int tid = item->tid;
+        int cpu = item->cpu;
 #else
-        lv_snprintf(buf, sizeof(buf),
-                    "   LVGL-1 [0] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: %c|1|%s\n",
-                    sec,
-                    nsec,
-                    item->tag,
-                    item->func);
+        int tid = 1;
+        int cpu = 0;
 #endif
+
+        if(profiler_ctx->config.format == LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON) {
+            /*Timestamps are in microseconds*/
+            lv_snprintf(buf, sizeof(buf),
+                        "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%" LV_PRIu64 ".%03d,\"pid\":1,\"tid\":%d},\n",
+                        item->func,
+                        item->tag,
+                        sec * 1000000 + nsec / 1000,
+                        (int)(nsec % 1000),
+                        tid);
+        }
+        else {
+            lv_snprintf(buf, sizeof(buf),
+                        "   LVGL-%d [%d] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: %c|1|%s\n",
+                        tid,
+                        cpu,
+                        sec,
+                        nsec,
+                        item->tag,
+                        item->func);
+        }
         profiler_ctx->config.flush_cb(buf);
     }
 }
@@ -33,6 +33,14 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * @brief Output formats of the built-in profiler
+ */
+typedef enum {
+    LV_PROFILER_BUILTIN_FORMAT_SYSTRACE,    /**< ftrace `tracing_mark_write` lines (systrace, Perfetto) */
+    LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON, /**< Chrome trace event objects, one per line, each followed by a comma */
+} lv_profiler_builtin_format_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -62,6 +70,7 @@ void lv_profiler_builtin_set_enable(bool enable);
 
 /**
  * @brief Flush the profiling data to the console
+ * @note In ring mode the items are kept, every flush writes the latest `buf_size` worth of items
  */
 void lv_profiler_builtin_flush(void);
 
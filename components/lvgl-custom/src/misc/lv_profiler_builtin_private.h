@@ -36,6 +36,9 @@ struct _lv_profiler_builtin_config_t {
     void (*flush_cb)(const char * buf); /**< Callback function to flush the profiling data */
     int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID */
     int (*cpu_get_cb)(void);            /**< Callback function to get the current CPU */
+    lv_profiler_builtin_format_t format; /**< Format of the flushed items */
+    bool ring;                          /**< true: overwrite the oldest items when the buffer is full,
+                                         *   false: flush the buffer when it is full */
 };
 
 
@@ -10,8 +10,10 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_sprintf.h"
+#include "../stdlib/lv_string.h"
 #include "lv_assert.h"
 #include "lv_ll.h"
+#include "lv_math.h"
 #include "lv_profiler.h"
 
 /*********************
@@ -20,6 +22,7 @@
 
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_SIZE_MIN 8
 
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
@@ -33,8 +36,18 @@
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static int64_t time_until_due(const lv_timer_t * timer, uint32_t now);
 static void lv_timer_handler_resume(void);
 
+static bool heap_reserve(lv_timer_heap_t * heap, uint32_t cnt);
+static void heap_insert(lv_timer_heap_t * heap, lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static bool heap_sift_up(lv_timer_heap_t * heap, uint32_t id, uint32_t now);
+static void heap_sift_down(lv_timer_heap_t * heap, uint32_t id, uint32_t now);
+static bool heap_is_before(const lv_timer_heap_t * heap, const lv_timer_t * a, const lv_timer_t * b, uint32_t now);
+static void heap_set(lv_timer_heap_t * heap, uint32_t id, lv_timer_t * timer);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -90,44 +103,30 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
-
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
+    /*Each timer runs at most once per call*/
+    state_p->handler_cnt++;
+    lv_timer_heap_t * due_heap = &state_p->due_heap;
+    lv_timer_heap_t * ready_heap = &state_p->ready_heap;
+    while(1) {
+        /*Take the ready timers from the top of `due_heap`. Run them in the order of the timer list
+         *(newest first) as the timers of LVGL depend on it. E.g. the display has to be refreshed
+         *before the animations of a new object run, else they think the object is not visible.*/
+        while(due_heap->cnt > 0) {
+            lv_timer_t * timer_next = due_heap->timers[0];
+            if(timer_next->run_cnt == state_p->handler_cnt) break;  /*All the ready timers have run*/
+            if(lv_timer_time_remaining(timer_next) != 0) break;     /*Not ready, so neither are the others*/
+            heap_remove(timer_next);
+            heap_insert(ready_heap, timer_next);
         }
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+        /*New timers can be ready after a callback too, so take them again after each run*/
+        if(ready_heap->cnt == 0) break;
+        lv_timer_exec(ready_heap->timers[0]);
     }
 
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(due_heap->cnt > 0) time_until_next = lv_timer_time_remaining(due_heap->timers[0]);
+
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -166,6 +165,10 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    /*Make room in the heaps first to never fail after the timer is created*/
+    if(!heap_reserve(&state.due_heap, state.timer_cnt + 1)) return NULL;
+    if(!heap_reserve(&state.ready_heap, state.timer_cnt + 1)) return NULL;
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -177,8 +180,14 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->ready = 0;
+    new_timer->heap_id = LV_TIMER_HEAP_ID_NONE;
+    new_timer->run_cnt = state.handler_cnt - 1;  /*Can run in the current handler call too*/
+    new_timer->create_cnt = state.create_cnt;
 
-    state.timer_created = true;
+    state.create_cnt++;
+    state.timer_cnt++;
+    heap_insert(&state.due_heap, new_timer);
 
     lv_timer_handler_resume();
 
@@ -193,8 +202,11 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    if(state.timer_exec == timer) state.timer_exec = NULL;
+
+    heap_remove(timer);
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    state.timer_cnt--;
 
     lv_free(timer);
 }
@@ -203,12 +215,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    if(timer->heap_id == LV_TIMER_HEAP_ID_NONE) heap_insert(&state.due_heap, timer);
     lv_timer_handler_resume();
 }
 
@@ -216,12 +230,14 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    heap_update(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
@@ -246,6 +262,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -260,6 +277,12 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.due_heap.timers);
+    lv_free(state.ready_heap.timers);
+    lv_memzero(&state.due_heap, sizeof(lv_timer_heap_t));
+    lv_memzero(&state.ready_heap, sizeof(lv_timer_heap_t));
+    state.timer_cnt = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -311,35 +334,38 @@ bool lv_timer_get_paused(lv_timer_t * timer)
 static bool lv_timer_exec(lv_timer_t * timer)
 {
     if(timer->paused) return false;
+    if(lv_timer_time_remaining(timer) != 0) {
+        heap_update(timer);     /*Not ready anymore, so back to `due_heap`*/
+        return false;
+    }
 
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
-
-        if(timer->timer_cb && original_repeat_count != 0) {
-            LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
-            timer->timer_cb(timer);
-            LV_PROFILER_TIMER_END_TAG("timer_cb");
-        }
-
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
-        }
-        else {
-            LV_TRACE_TIMER("timer callback finished");
-        }
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted `if(timer->repeat_count == 0)` is not executed below*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->run_cnt = state.handler_cnt;
+    heap_update(timer); /*Back to `due_heap` before the callback as it can change the timer too*/
+    LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
+
+    state.timer_exec = timer;
+    if(timer->timer_cb && original_repeat_count != 0) {
+        LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
+        timer->timer_cb(timer);
+        LV_PROFILER_TIMER_END_TAG("timer_cb");
+    }
 
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+    if(state.timer_exec) {
+        LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
+    }
+    else {
+        LV_TRACE_TIMER("timer callback finished");
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
+    LV_ASSERT_MEM_INTEGRITY();
+
+    if(state.timer_exec) { /*The timer might be deleted by itself as well*/
+        state.timer_exec = NULL;
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             if(timer->auto_delete) {
                 LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
@@ -352,7 +378,7 @@ static bool lv_timer_exec(lv_timer_t * timer)
         }
     }
 
-    return exec;
+    return true;
 }
 
 /**
@@ -369,6 +395,18 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
     return timer->period - elp;
 }
 
+/**
+ * Get the time until a timer is due, negative if it's late.
+ * 64 bit to handle any period and elapsed time.
+ * @param timer     pointer to a timer
+ * @param now       the current tick
+ * @return          the time until the timer is due
+ */
+static int64_t time_until_due(const lv_timer_t * timer, uint32_t now)
+{
+    return (int64_t)timer->period - (int64_t)lv_tick_diff(now, timer->last_run);
+}
+
 /**
  * Call the ready lv_timer
  */
@@ -386,3 +424,153 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Make sure a heap has room for a given number of timers
+ * @param heap  pointer to a heap
+ * @param cnt   number of timers
+ * @return      true: success; false: out of memory
+ */
+static bool heap_reserve(lv_timer_heap_t * heap, uint32_t cnt)
+{
+    if(cnt <= heap->size) return true;
+
+    uint32_t new_size = LV_MAX(heap->size * 2, HEAP_SIZE_MIN);
+    lv_timer_t ** new_timers = lv_realloc(heap->timers, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_timers);
+    if(new_timers == NULL) return false;
+
+    heap->timers = new_timers;
+    heap->size = new_size;
+    return true;
+}
+
+/**
+ * Add a timer which is in none of the heaps to a heap
+ * @param heap      pointer to `due_heap` or `ready_heap`
+ * @param timer     pointer to a timer
+ */
+static void heap_insert(lv_timer_heap_t * heap, lv_timer_t * timer)
+{
+    /*There is always room as `lv_timer_create` reserves a slot for each timer*/
+    timer->ready = heap == &state.ready_heap;
+    uint32_t id = heap->cnt;
+    heap->cnt++;
+    heap_set(heap, id, timer);
+    heap_sift_up(heap, id, lv_tick_get());
+}
+
+/**
+ * Remove a timer from the heap it's in
+ * @param timer     pointer to a timer
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t id = timer->heap_id;
+    if(id == LV_TIMER_HEAP_ID_NONE) return;
+
+    lv_timer_heap_t * heap = timer->ready ? &state.ready_heap : &state.due_heap;
+    timer->heap_id = LV_TIMER_HEAP_ID_NONE;
+    heap->cnt--;
+    if(id == heap->cnt) return;  /*It was the last one*/
+
+    /*Fill the hole with the last timer and move it to its place*/
+    heap_set(heap, id, heap->timers[heap->cnt]);
+    uint32_t now = lv_tick_get();
+    if(!heap_sift_up(heap, id, now)) heap_sift_down(heap, id, now);
+}
+
+/**
+ * Move a timer to its new place after its time remaining has changed.
+ * A ready timer goes back to `due_heap` as it might be not ready anymore.
+ * @param timer     pointer to a timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    uint32_t id = timer->heap_id;
+    if(id == LV_TIMER_HEAP_ID_NONE) return;
+
+    if(timer->ready) {
+        heap_remove(timer);
+        heap_insert(&state.due_heap, timer);
+        return;
+    }
+
+    uint32_t now = lv_tick_get();
+    if(!heap_sift_up(&state.due_heap, id, now)) heap_sift_down(&state.due_heap, id, now);
+}
+
+/**
+ * Move a timer up while it's before its parent
+ * @param heap      pointer to a heap
+ * @param id        index of the timer in the heap
+ * @param now       the current tick
+ * @return          true: the timer was moved
+ */
+static bool heap_sift_up(lv_timer_heap_t * heap, uint32_t id, uint32_t now)
+{
+    lv_timer_t * timer = heap->timers[id];
+    uint32_t id_ori = id;
+
+    while(id > 0) {
+        uint32_t parent = (id - 1) / 2;
+        if(!heap_is_before(heap, timer, heap->timers[parent], now)) break;
+        heap_set(heap, id, heap->timers[parent]);
+        id = parent;
+    }
+
+    heap_set(heap, id, timer);
+    return id != id_ori;
+}
+
+/**
+ * Move a timer down while one of its children is before it
+ * @param heap      pointer to a heap
+ * @param id        index of the timer in the heap
+ * @param now       the current tick
+ */
+static void heap_sift_down(lv_timer_heap_t * heap, uint32_t id, uint32_t now)
+{
+    lv_timer_t ** timers = heap->timers;
+    lv_timer_t * timer = timers[id];
+    uint32_t cnt = heap->cnt;
+
+    while(1) {
+        uint32_t child = id * 2 + 1;
+        if(child >= cnt) break;
+        if(child + 1 < cnt && heap_is_before(heap, timers[child + 1], timers[child], now)) child++;
+        if(!heap_is_before(heap, timers[child], timer, now)) break;
+        heap_set(heap, id, timers[child]);
+        id = child;
+    }
+
+    heap_set(heap, id, timer);
+}
+
+/**
+ * Tell whether a timer has to be on top of an other one in a heap.
+ * In `due_heap` the timer due first is on top. As time passes the times until due decrease
+ * equally, so the order is kept. In `ready_heap` the newer timer is on top like in the timer list.
+ * @param heap      pointer to `due_heap` or `ready_heap`
+ * @param a         pointer to a timer
+ * @param b         pointer to an other timer
+ * @param now       the current tick
+ * @return          true: `a` is before `b`
+ */
+static bool heap_is_before(const lv_timer_heap_t * heap, const lv_timer_t * a, const lv_timer_t * b, uint32_t now)
+{
+    if(heap == &state.ready_heap) return (int32_t)(a->create_cnt - b->create_cnt) > 0;
+
+    int64_t a_due = time_until_due(a, now);
+    int64_t b_due = time_until_due(b, now);
+    if(a_due != b_due) return a_due < b_due;
+
+    /*Of the timers due at the same time the ones which haven't run in this handler call yet come first*/
+    return a->run_cnt != state.handler_cnt && b->run_cnt == state.handler_cnt;
+}
+
+static void heap_set(lv_timer_heap_t * heap, uint32_t id, lv_timer_t * timer)
+{
+    heap->timers[id] = timer;
+    timer->heap_id = id;
+}
@@ -20,6 +20,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_TIMER_HEAP_ID_NONE  UINT32_MAX   /**< `heap_id` of paused timers*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,15 +37,34 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+    uint32_t ready : 1;        /**< 1: in `ready_heap`; 0: in `due_heap` (if not paused) */
+    uint32_t heap_id;          /**< Index in the timer heap, LV_TIMER_HEAP_ID_NONE if paused */
+    uint32_t run_cnt;          /**< `handler_cnt` of the last `lv_timer_handler()` call which ran the timer */
+    uint32_t create_cnt;       /**< `create_cnt` when the timer was created, gives the order of the timer list */
 };
 
+/**
+ * Binary heap of timers.
+ * It has room for all the timers so pausing, resuming and running a timer never allocates.
+ */
+typedef struct {
+    lv_timer_t ** timers;
+    uint32_t cnt;              /**< Number of timers in the heap*/
+    uint32_t size;             /**< Number of allocated slots*/
+} lv_timer_heap_t;
+
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
 
+    lv_timer_heap_t due_heap;   /**< The not paused timers, the one due first on top*/
+    lv_timer_heap_t ready_heap; /**< The ready timers of a `lv_timer_handler()` call in the order of the list*/
+    uint32_t timer_cnt;        /**< Number of timers, paused included*/
+    uint32_t create_cnt;       /**< Number of `lv_timer_create()` calls*/
+    uint32_t handler_cnt;      /**< Number of `lv_timer_handler()` calls, to run a timer once per call*/
+    lv_timer_t * timer_exec;   /**< The timer whose callback is running, NULL if it deleted itself*/
+
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     volatile uint32_t timer_time_until_next;
 
     bool already_running;
@@ -41,6 +41,14 @@
  *      TYPEDEFS
  **********************/
 
+/** How a new text differs from the current text of the label*/
+typedef enum {
+    LABEL_TEXT_NEW,             /**< Needs a new buffer and a new measurement*/
+    LABEL_TEXT_SAME_LENGTH,     /**< Fits into the current buffer, but needs a new measurement*/
+    LABEL_TEXT_SAME_LAYOUT,     /**< Only digits of the same width changed, the measured size is still valid*/
+    LABEL_TEXT_SAME,            /**< Identical, nothing to do*/
+} label_text_change_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -52,6 +60,10 @@ static void draw_main(lv_event_t * e);
 static void set_text_internal(lv_obj_t * obj, const char * text);
 static void remove_translation_tag(lv_obj_t * obj);
 static void lv_label_refr_text(lv_obj_t * obj);
+static label_text_change_t get_text_change(lv_obj_t * obj, const char * text);
+static int32_t get_letter_width(const lv_font_t * font, const char * txt, uint32_t byte_id);
+static uint32_t get_text_hash(const char * text);
+static bool layout_key_equal(const lv_label_layout_key_t * a, const lv_label_layout_key_t * b);
 static void lv_label_revert_dots(lv_obj_t * label);
 static void lv_label_set_dots(lv_obj_t * label, uint32_t dot_begin);
 
@@ -806,6 +818,8 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
     lv_obj_t * obj = lv_event_get_current_target(e);
 
     if((code == LV_EVENT_STYLE_CHANGED) || (code == LV_EVENT_SIZE_CHANGED)) {
+        /*The self size also depends on the width and max. width styles*/
+        ((lv_label_t *)obj)->invalid_size_cache = true;
         lv_label_refr_text(obj);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
@@ -991,7 +1005,22 @@ static void set_text_internal(lv_obj_t * obj, const char * text)
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
 
+    const label_text_change_t change = get_text_change(obj, text);
+    if(change == LABEL_TEXT_SAME) return;
+
     lv_label_revert_dots(obj); /*In case text == label->text*/
+
+    if(change == LABEL_TEXT_SAME_LENGTH || change == LABEL_TEXT_SAME_LAYOUT) {
+        /*E.g. a value changed from "12.5" to "12.6": reuse the buffer*/
+        copy_text_to_label(label, text);
+
+        /*The layout of the old text is the layout of the new text too*/
+        if(change == LABEL_TEXT_SAME_LAYOUT) label->layout_key.text_hash = get_text_hash(label->text);
+
+        lv_label_refr_text(obj);
+        return;
+    }
+
     const size_t text_len = get_text_length(text);
 
     /*If set its own text then reallocate it (maybe its size changed)*/
@@ -1070,10 +1099,6 @@ static void lv_label_refr_text(lv_obj_t * obj)
 {
     lv_label_t * label = (lv_label_t *)obj;
     if(label->text == NULL) return;
-#if LV_LABEL_LONG_TXT_HINT
-    label->hint.line_start = -1; /*The hint is invalid if the text changes*/
-#endif
-    label->invalid_size_cache = true;
 
     lv_area_t txt_coords;
     lv_text_attributes_t attributes = {0};
@@ -1088,10 +1113,30 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_point_t size;
 
     lv_label_revert_dots(obj);
-    lv_text_get_size_attributes(&size, label->text, font, &attributes);
-    label->text_size = size;
 
-    lv_obj_refresh_self_size(obj);
+    /*Measure the text only if it or its attributes changed since the last measurement*/
+    lv_label_layout_key_t key;
+    key.font = font;
+    key.text_hash = get_text_hash(label->text);
+    key.max_width = attributes.max_width;
+    key.letter_space = attributes.letter_space;
+    key.line_space = attributes.line_space;
+    key.flags = attributes.text_flags;
+
+    if(layout_key_equal(&key, &label->layout_key)) {
+        size = label->text_size;
+    }
+    else {
+        lv_text_get_size_attributes(&size, label->text, font, &attributes);
+        label->text_size = size;
+        label->layout_key = key;
+#if LV_LABEL_LONG_TXT_HINT
+        label->hint.line_start = -1; /*The hint is invalid if the layout changes*/
+#endif
+        label->invalid_size_cache = true;
+    }
+
+    if(label->invalid_size_cache) lv_obj_refresh_self_size(obj);
 
     /*In scroll mode start an offset animation*/
     if(label->long_mode == LV_LABEL_LONG_MODE_SCROLL) {
@@ -1335,6 +1380,100 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 }
 
+/**
+ * Compare a new text with the current text of the label to see what can be kept
+ * @param obj       pointer to a label object
+ * @param text      the new text
+ * @return          what has to be updated, see `label_text_change_t`
+ */
+static label_text_change_t get_text_change(lv_obj_t * obj, const char * text)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    const char * old = label->text;
+    if(old == NULL || old == text || label->static_txt || label->dot_begin != LV_LABEL_DOT_BEGIN_INV) {
+        return LABEL_TEXT_NEW;
+    }
+
+    bool changed = false;
+    bool digits_only = true;
+    uint32_t i;
+    for(i = 0; old[i] != '\0' && text[i] != '\0'; i++) {
+#if LV_USE_ARABIC_PERSIAN_CHARS
+        /*The stored text is processed, but letters below U+0600 (UTF-8 lead byte < 0xD8) are kept*/
+        if((uint8_t)text[i] >= 0xD8) return LABEL_TEXT_NEW;
+#endif
+        if(old[i] == text[i]) continue;
+        changed = true;
+        if(old[i] < '0' || old[i] > '9' || text[i] < '0' || text[i] > '9') digits_only = false;
+    }
+
+    if(old[i] != text[i]) return LABEL_TEXT_NEW;  /*Different length*/
+    if(!changed) return LABEL_TEXT_SAME;
+    if(!digits_only) return LABEL_TEXT_SAME_LENGTH;
+
+    /*The measured size has to belong to the old text*/
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    if(label->layout_key.font != font || label->layout_key.text_hash != get_text_hash(old)) {
+        return LABEL_TEXT_SAME_LENGTH;
+    }
+
+    /*Digits are not break characters, so the lines break at the same place if every changed digit
+     *and the letter before it (kerning) has the same width as before*/
+    for(i = 0; old[i] != '\0'; i++) {
+        if(old[i] == text[i]) continue;
+
+        if(get_letter_width(font, old, i) != get_letter_width(font, text, i)) return LABEL_TEXT_SAME_LENGTH;
+
+        if(i > 0) {
+            uint32_t prev_id = i;
+            lv_text_encoded_prev(old, &prev_id);
+            if(get_letter_width(font, old, prev_id) != get_letter_width(font, text, prev_id)) {
+                return LABEL_TEXT_SAME_LENGTH;
+            }
+        }
+    }
+
+    return LABEL_TEXT_SAME_LAYOUT;
+}
+
+/**
+ * Get the width of a letter as the text measurement sees it, i.e. with the kerning to the next letter
+ * @param font      the font of the label
+ * @param txt       the text
+ * @param byte_id   byte index of the letter
+ * @return          the width of the letter
+ */
+static int32_t get_letter_width(const lv_font_t * font, const char * txt, uint32_t byte_id)
+{
+    uint32_t letter = lv_text_encoded_next(txt, &byte_id);
+    uint32_t letter_next = lv_text_encoded_next(txt, &byte_id);
+    return lv_font_get_glyph_width(font, letter, letter_next);
+}
+
+static uint32_t get_text_hash(const char * text)
+{
+    /*FNV-1a*/
+    uint32_t hash = 2166136261U;
+    while(*text != '\0') {
+        hash ^= (uint8_t) * text;
+        hash *= 16777619U;
+        text++;
+    }
+
+    return hash;
+}
+
+static bool layout_key_equal(const lv_label_layout_key_t * a, const lv_label_layout_key_t * b)
+{
+    return a->font != NULL &&
+           a->font == b->font &&
+           a->text_hash == b->text_hash &&
+           a->max_width == b->max_width &&
+           a->letter_space == b->letter_space &&
+           a->line_space == b->line_space &&
+           a->flags == b->flags;
+}
+
 static void lv_label_revert_dots(lv_obj_t * obj)
 {
     lv_label_t * label = (lv_label_t *)obj;
@@ -28,6 +28,16 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Inputs of the last text measurement. If they are the same the measured size is still valid.*/
+typedef struct {
+    const lv_font_t * font;
+    uint32_t text_hash;
+    int32_t max_width;
+    int32_t letter_space;
+    int32_t line_space;
+    lv_text_flag_t flags;           /**< Includes the effect of the long mode (expand)*/
+} lv_label_layout_key_t;
+
 struct _lv_label_t {
     lv_obj_t obj;
     char * text;
@@ -55,6 +65,7 @@ struct _lv_label_t {
     uint8_t invalid_size_cache : 1;     /**< 1: Recalculate size and update cache */
 
     lv_point_t text_size;
+    lv_label_layout_key_t layout_key;   /**< What `text_size` was measured with*/
 };
 
 
@@ -180,6 +180,12 @@
 
 #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    1
 
+/*RGB565 renders (test_render_to_rgb565) go through the SWAR blend kernels*/
+#define LV_USE_DRAW_SW_ASM  LV_DRAW_SW_ASM_SWAR
+
+/*Arcs in the screenshot tests are blended from the arc coverage cache*/
+#define LV_DRAW_SW_ARC_CACHE_SIZE   (16 * 1024)
+
 #define LV_USE_GESTURE_RECOGNITION 1
 
 #define LV_DISABLE_API_MAPPING 1
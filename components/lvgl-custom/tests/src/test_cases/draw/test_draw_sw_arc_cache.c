@@ -0,0 +1,201 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+
+#include "unity/unity.h"
+
+#define CANVAS_W    240
+#define CANVAS_H    240
+#define ARC_CNT     200
+
+static lv_obj_t * canvas;
+static uint8_t * ref_buf;
+static uint32_t rnd_state;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1664525 + 1013904223;
+    return rnd_state >> 8;
+}
+
+void setUp(void)
+{
+    rnd_state = 0x2468ace0;
+    lv_draw_sw_arc_cache_resize(LV_DRAW_SW_ARC_CACHE_SIZE);
+    lv_draw_sw_arc_cache_drop_all();
+
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    lv_canvas_set_draw_buf(canvas, draw_buf);
+    ref_buf = lv_malloc(draw_buf->data_size);
+}
+
+void tearDown(void)
+{
+    lv_draw_buf_destroy(lv_canvas_get_draw_buf(canvas));
+    lv_obj_delete(canvas);
+    lv_free(ref_buf);
+    lv_draw_sw_arc_cache_resize(LV_DRAW_SW_ARC_CACHE_SIZE);
+    lv_draw_sw_arc_cache_drop_all();
+}
+
+static void random_arc(lv_draw_arc_dsc_t * dsc)
+{
+    lv_draw_arc_dsc_init(dsc);
+    dsc->center.x = 20 + rnd() % (CANVAS_W - 40);
+    dsc->center.y = 20 + rnd() % (CANVAS_H - 40);
+    dsc->radius = 4 + rnd() % 120;
+    dsc->width = 1 + rnd() % 12;
+    dsc->start_angle = rnd() % 360;
+    dsc->end_angle = (dsc->start_angle + 1 + rnd() % 358) + (rnd() % 2 ? 0 : 360);
+    dsc->rounded = rnd() % 2;
+    dsc->color = lv_color_hex(rnd());
+    dsc->opa = rnd() % 3 ? LV_OPA_COVER : LV_OPA_50;
+}
+
+/**
+ * Clear the canvas and draw one arc on it
+ * @param dsc       the arc
+ * @param clip      clip area of the layer, NULL: the whole canvas
+ */
+static void draw_arc(const lv_draw_arc_dsc_t * dsc, const lv_area_t * clip)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(canvas);
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    if(clip) layer._clip_area = *clip;
+    lv_draw_arc(&layer, dsc);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+/*Draw an arc directly with the masks into `ref_buf`, then from the cache (miss and hit) and compare*/
+static void check_arc(const lv_draw_arc_dsc_t * dsc, const lv_area_t * clip)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(canvas);
+
+    lv_draw_sw_arc_cache_resize(0);
+    draw_arc(dsc, clip);
+    lv_memcpy(ref_buf, draw_buf->data, draw_buf->data_size);
+    lv_draw_sw_arc_cache_resize(LV_DRAW_SW_ARC_CACHE_SIZE);
+
+    draw_arc(dsc, clip);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, draw_buf->data, draw_buf->data_size);
+
+    draw_arc(dsc, clip);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, draw_buf->data, draw_buf->data_size);
+}
+
+void test_arc_cache_same_pixels_as_masks(void)
+{
+    lv_draw_sw_arc_cache_stats_t start;
+    lv_draw_sw_arc_cache_get_stats(&start);
+
+    uint32_t i;
+    for(i = 0; i < ARC_CNT; i++) {
+        lv_draw_arc_dsc_t dsc;
+        random_arc(&dsc);
+        check_arc(&dsc, NULL);
+    }
+
+    /*Most of the arcs have to be compared from the cache, not drawn directly*/
+    lv_draw_sw_arc_cache_stats_t stats;
+    lv_draw_sw_arc_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(ARC_CNT / 2, stats.hits - start.hits);
+}
+
+void test_arc_cache_same_pixels_when_clipped(void)
+{
+    uint32_t i;
+    for(i = 0; i < ARC_CNT; i++) {
+        lv_draw_arc_dsc_t dsc;
+        random_arc(&dsc);
+
+        /*Cache the arc with one clip area then draw it with an other*/
+        lv_area_t clip;
+        clip.x1 = rnd() % CANVAS_W;
+        clip.y1 = rnd() % CANVAS_H;
+        clip.x2 = clip.x1 + 10 + rnd() % 100;
+        clip.y2 = clip.y1 + 10 + rnd() % 100;
+        clip.x2 = LV_MIN(clip.x2, CANVAS_W - 1);
+        clip.y2 = LV_MIN(clip.y2, CANVAS_H - 1);
+        draw_arc(&dsc, NULL);
+        check_arc(&dsc, &clip);
+    }
+}
+
+void test_arc_cache_battery_gauge(void)
+{
+    /*Like ui_Arc1/ui_Arc2 of the TPMS display: 220 px, 3 px wide, rounded, 60 deg background*/
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.center.x = CANVAS_W / 2;
+    dsc.center.y = CANVAS_H / 2;
+    dsc.radius = 110;
+    dsc.width = 3;
+    dsc.rounded = true;
+    dsc.start_angle = 240;
+    dsc.end_angle = 300;
+
+    lv_draw_sw_arc_cache_stats_t start;
+    lv_draw_sw_arc_cache_get_stats(&start);
+    check_arc(&dsc, NULL);
+
+    lv_draw_sw_arc_cache_stats_t stats;
+    lv_draw_sw_arc_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.misses - start.misses);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hits - start.hits);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1024, stats.size);
+
+    /*Moving the arc still hits the cache and gives the same pixels*/
+    dsc.center.x += 7;
+    dsc.center.y -= 3;
+    draw_arc(&dsc, NULL);
+    lv_draw_sw_arc_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.misses - start.misses);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hits - start.hits);
+
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(canvas);
+    lv_memcpy(ref_buf, draw_buf->data, draw_buf->data_size);
+    lv_draw_sw_arc_cache_resize(0);
+    draw_arc(&dsc, NULL);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, draw_buf->data, draw_buf->data_size);
+}
+
+void test_arc_cache_bounded(void)
+{
+    const uint32_t budget = 2048;
+    lv_draw_sw_arc_cache_resize(budget);
+
+    lv_draw_sw_arc_cache_stats_t start;
+    lv_draw_sw_arc_cache_get_stats(&start);
+    lv_draw_sw_arc_cache_stats_t stats;
+
+    uint32_t i;
+    for(i = 0; i < ARC_CNT; i++) {
+        lv_draw_arc_dsc_t dsc;
+        random_arc(&dsc);
+        draw_arc(&dsc, NULL);
+
+        lv_draw_sw_arc_cache_get_stats(&stats);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(budget, stats.size);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_SW_ARC_CACHE_ENTRY_CNT, stats.entry_cnt);
+    }
+
+    TEST_ASSERT_GREATER_THAN_UINT32(start.misses, stats.misses);
+    TEST_ASSERT_GREATER_THAN_UINT32(start.evictions, stats.evictions);
+    TEST_ASSERT_GREATER_THAN_UINT32(start.bypasses, stats.bypasses);
+
+    lv_draw_sw_arc_cache_drop_all();
+    lv_draw_sw_arc_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+}
+
+#endif /*LV_DRAW_SW_ARC_CACHE_SIZE*/
+
+#endif
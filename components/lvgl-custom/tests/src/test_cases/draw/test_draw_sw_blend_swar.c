@@ -0,0 +1,216 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SWAR
+
+#include "../src/draw/sw/blend/swar/lv_draw_sw_blend_swar_to_rgb565.h"
+
+#include "unity/unity.h"
+
+/* The SWAR kernels are compared pixel by pixel with the reference formula
+ * (lv_color_16_16_mix) on random data. Every combination of destination and
+ * source alignment and of odd/even widths is covered, and the padding around
+ * each row must stay untouched.*/
+
+#define TEST_W_MAX      37
+#define TEST_H          3
+#define TEST_PAD        2   /*Guard pixels on both sides of each row*/
+#define TEST_STRIDE_PX  (TEST_W_MAX + 2 * TEST_PAD + 1)
+#define TEST_BUF_PX     (TEST_STRIDE_PX * TEST_H)
+
+static uint32_t rnd_state;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1664525 + 1013904223;
+    return rnd_state >> 8;
+}
+
+static uint16_t rnd_color(void)
+{
+    /*Few distinct colors so equal neighbours and the result cache are hit too*/
+    static const uint16_t palette[] = {0x0000, 0xffff, 0xf800, 0x07e0, 0x001f, 0x8410};
+    if(rnd() % 3 == 0) return palette[rnd() % 6];
+    return (uint16_t)rnd();
+}
+
+static lv_opa_t rnd_mask(void)
+{
+    /*Runs of transparent/opaque pixels like glyph edges, plus random values*/
+    uint32_t r = rnd() % 4;
+    if(r == 0) return LV_OPA_TRANSP;
+    if(r == 1) return LV_OPA_COVER;
+    return (lv_opa_t)rnd();
+}
+
+static void fill_random(uint16_t * dest, uint16_t * src, lv_opa_t * mask)
+{
+    int32_t i;
+    for(i = 0; i < TEST_BUF_PX; i++) {
+        dest[i] = rnd_color();
+        src[i] = rnd_color();
+        mask[i] = rnd_mask();
+    }
+}
+
+static lv_opa_t ref_mix(const lv_opa_t * mask, int32_t i, lv_opa_t opa)
+{
+    if(mask == NULL) return opa;
+    if(opa >= LV_OPA_MAX) return mask[i];
+    return LV_OPA_MIX2(mask[i], opa);
+}
+
+typedef enum {
+    KERNEL_COLOR,
+    KERNEL_RGB565,
+} kernel_src_t;
+
+/**
+ * Run one kernel over every width and alignment and compare with the reference
+ * @param src_type  KERNEL_COLOR or KERNEL_RGB565
+ * @param use_mask  pass a mask buffer
+ * @param opa       overall opacity
+ */
+static void check_kernel(kernel_src_t src_type, bool use_mask, lv_opa_t opa)
+{
+    static uint16_t dest[TEST_BUF_PX + 2];
+    static uint16_t expected[TEST_BUF_PX + 2];
+    static uint16_t src[TEST_BUF_PX + 2];
+    static lv_opa_t mask[TEST_BUF_PX + 2];
+
+    int32_t w;
+    for(w = 1; w <= TEST_W_MAX; w++) {
+        uint32_t dest_ofs;
+        for(dest_ofs = 0; dest_ofs < 2; dest_ofs++) {
+            uint32_t src_ofs;
+            for(src_ofs = 0; src_ofs < 2; src_ofs++) {
+                fill_random(dest, src, mask);
+                lv_memcpy(expected, dest, sizeof(dest));
+
+                /*The fill kernels convert the color with lv_color_to_u16(), so use the same value here*/
+                uint32_t rgb = rnd();
+                lv_color_t color = lv_color_make(rgb >> 16, rgb >> 8, rgb);
+                uint16_t color16 = lv_color_to_u16(color);
+                uint16_t * dest_start = dest + TEST_PAD + dest_ofs;
+                const uint16_t * src_start = src + TEST_PAD + src_ofs;
+                const lv_opa_t * mask_start = use_mask ? mask + 3 : NULL;
+
+                int32_t x;
+                int32_t y;
+                for(y = 0; y < TEST_H; y++) {
+                    uint16_t * e = expected + TEST_PAD + dest_ofs + y * TEST_STRIDE_PX;
+                    const uint16_t * s = src_start + y * TEST_STRIDE_PX;
+                    const lv_opa_t * m = mask_start ? mask_start + y * TEST_STRIDE_PX : NULL;
+                    for(x = 0; x < w; x++) {
+                        uint16_t fg = src_type == KERNEL_COLOR ? color16 : s[x];
+                        e[x] = lv_color_16_16_mix(fg, e[x], ref_mix(m, x, opa));
+                    }
+                }
+
+                if(src_type == KERNEL_COLOR) {
+                    lv_draw_sw_blend_fill_dsc_t dsc;
+                    lv_memzero(&dsc, sizeof(dsc));
+                    dsc.dest_buf = dest_start;
+                    dsc.dest_w = w;
+                    dsc.dest_h = TEST_H;
+                    dsc.dest_stride = TEST_STRIDE_PX * 2;
+                    dsc.mask_buf = mask_start;
+                    dsc.mask_stride = TEST_STRIDE_PX;
+                    dsc.color = color;
+                    dsc.opa = opa;
+
+                    lv_result_t res;
+                    if(!use_mask) res = lv_draw_sw_blend_swar_color_to_rgb565_with_opa(&dsc);
+                    else if(opa >= LV_OPA_MAX) res = lv_draw_sw_blend_swar_color_to_rgb565_with_mask(&dsc);
+                    else res = lv_draw_sw_blend_swar_color_to_rgb565_with_opa_mask(&dsc);
+                    TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+                }
+                else {
+                    lv_draw_sw_blend_image_dsc_t dsc;
+                    lv_memzero(&dsc, sizeof(dsc));
+                    dsc.dest_buf = dest_start;
+                    dsc.dest_w = w;
+                    dsc.dest_h = TEST_H;
+                    dsc.dest_stride = TEST_STRIDE_PX * 2;
+                    dsc.src_buf = src_start;
+                    dsc.src_stride = TEST_STRIDE_PX * 2;
+                    dsc.src_color_format = LV_COLOR_FORMAT_RGB565;
+                    dsc.mask_buf = mask_start;
+                    dsc.mask_stride = TEST_STRIDE_PX;
+                    dsc.opa = opa;
+                    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+                    lv_result_t res;
+                    if(!use_mask) res = lv_draw_sw_blend_swar_rgb565_to_rgb565_with_opa(&dsc);
+                    else if(opa >= LV_OPA_MAX) res = lv_draw_sw_blend_swar_rgb565_to_rgb565_with_mask(&dsc);
+                    else res = lv_draw_sw_blend_swar_rgb565_to_rgb565_with_opa_mask(&dsc);
+                    TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+                }
+
+                TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, dest, TEST_BUF_PX);
+            }
+        }
+    }
+}
+
+void setUp(void)
+{
+    rnd_state = 0x12345678;
+}
+
+void tearDown(void)
+{
+}
+
+void test_swar_color_with_opa(void)
+{
+    uint32_t opa;
+    for(opa = 0; opa < LV_OPA_MAX; opa++) {
+        check_kernel(KERNEL_COLOR, false, (lv_opa_t)opa);
+    }
+}
+
+void test_swar_color_with_mask(void)
+{
+    uint32_t i;
+    for(i = 0; i < 64; i++) {
+        check_kernel(KERNEL_COLOR, true, LV_OPA_COVER);
+    }
+}
+
+void test_swar_color_with_opa_mask(void)
+{
+    uint32_t opa;
+    for(opa = 0; opa < LV_OPA_MAX; opa++) {
+        check_kernel(KERNEL_COLOR, true, (lv_opa_t)opa);
+    }
+}
+
+void test_swar_rgb565_with_opa(void)
+{
+    uint32_t opa;
+    for(opa = 0; opa < LV_OPA_MAX; opa++) {
+        check_kernel(KERNEL_RGB565, false, (lv_opa_t)opa);
+    }
+}
+
+void test_swar_rgb565_with_mask(void)
+{
+    uint32_t i;
+    for(i = 0; i < 64; i++) {
+        check_kernel(KERNEL_RGB565, true, LV_OPA_COVER);
+    }
+}
+
+void test_swar_rgb565_with_opa_mask(void)
+{
+    uint32_t opa;
+    for(opa = 0; opa < LV_OPA_MAX; opa++) {
+        check_kernel(KERNEL_RGB565, true, (lv_opa_t)opa);
+    }
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SWAR*/
+
+#endif
@@ -98,4 +98,67 @@ void test_profiler_disable(void)
     TEST_ASSERT_EQUAL_CHAR(output_buf[4][0], '\0');
 }
 
+static void init_profiler(lv_profiler_builtin_format_t format, bool ring)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = OUTPUT_BUF_MAX;
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = flush_cb;
+    config.format = format;
+    config.ring = ring;
+    lv_profiler_builtin_init(&config);
+
+    profiler_tick = 0;
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+}
+
+void test_profiler_chrome_json(void)
+{
+    init_profiler(LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON, false);
+    profiler_tick = 1500;
+
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+    LV_PROFILER_END_TAG("custom_tag");
+    lv_profiler_builtin_flush();
+
+    /*No systrace header, one event object per line in microseconds*/
+    TEST_ASSERT_EQUAL_INT(2, output_line);
+    TEST_ASSERT_EQUAL_STRING("{\"name\":\"custom_tag\",\"ph\":\"B\",\"ts\":1500.000,\"pid\":1,\"tid\":1},\n",
+                             output_buf[0]);
+    TEST_ASSERT_EQUAL_STRING("{\"name\":\"custom_tag\",\"ph\":\"E\",\"ts\":1501.000,\"pid\":1,\"tid\":1},\n",
+                             output_buf[1]);
+}
+
+void test_profiler_ring(void)
+{
+    init_profiler(LV_PROFILER_BUILTIN_FORMAT_SYSTRACE, true);
+
+    /*Write more items than fit: nothing is flushed until asked*/
+    uint32_t i;
+    for(i = 0; i < 10 * OUTPUT_LINE_MAX; i++) {
+        LV_PROFILER_BEGIN_TAG("custom_tag");
+    }
+    TEST_ASSERT_EQUAL_INT(0, output_line);
+
+    /*Only the latest items are flushed, oldest first*/
+    lv_profiler_builtin_flush();
+    TEST_ASSERT_GREATER_THAN_INT(0, output_line);
+    int line;
+    for(line = 0; line < output_line; line++) {
+        char expected[OUTPUT_BUF_MAX];
+        lv_snprintf(expected, sizeof(expected), "   LVGL-1 [0] 0.%06d000: tracing_mark_write: B|1|custom_tag\n",
+                    (int)(10 * OUTPUT_LINE_MAX - output_line + line));
+        TEST_ASSERT_EQUAL_STRING(expected, output_buf[line]);
+    }
+
+    /*The items are kept for the next flush*/
+    int flushed = output_line;
+    output_line = 0;
+    lv_profiler_builtin_flush();
+    TEST_ASSERT_EQUAL_INT(flushed, output_line);
+}
+
 #endif
@@ -0,0 +1,260 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define OTHER_TIMER_MAX     16
+#define STRESS_TIMER_CNT    40
+
+static lv_timer_t * other_timers[OTHER_TIMER_MAX];
+static uint32_t other_timer_cnt;
+
+static uint32_t run_log[16];
+static uint32_t run_log_cnt;
+
+void setUp(void)
+{
+    /*Pause the timers of the display, input devices, etc. to test only the timers created here*/
+    other_timer_cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer && other_timer_cnt < OTHER_TIMER_MAX) {
+        if(!lv_timer_get_paused(timer)) {
+            lv_timer_pause(timer);
+            other_timers[other_timer_cnt++] = timer;
+        }
+        timer = lv_timer_get_next(timer);
+    }
+
+    run_log_cnt = 0;
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < other_timer_cnt; i++) {
+        lv_timer_resume(other_timers[i]);
+    }
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+static void log_cb(lv_timer_t * timer)
+{
+    if(run_log_cnt < sizeof(run_log) / sizeof(run_log[0])) {
+        run_log[run_log_cnt++] = (uint32_t)(uintptr_t)lv_timer_get_user_data(timer);
+    }
+}
+
+static void count_cb(lv_timer_t * timer)
+{
+    (*(uint32_t *)lv_timer_get_user_data(timer))++;
+}
+
+static void delete_other_cb(lv_timer_t * timer)
+{
+    lv_timer_t ** other = lv_timer_get_user_data(timer);
+    lv_timer_delete(*other);
+    *other = NULL;
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    lv_timer_delete(timer);
+}
+
+void test_timer_runs_ready_timers_in_list_order(void)
+{
+    lv_timer_t * t30 = lv_timer_create(log_cb, 30, (void *)30);
+    lv_timer_t * t10 = lv_timer_create(log_cb, 10, (void *)10);
+    lv_timer_t * t20 = lv_timer_create(log_cb, 20, (void *)20);
+
+    /*Only the timer which is due runs*/
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(10, run_log[0]);
+
+    /*The ready timers run newest first, like in the timer list, regardless of how late they are*/
+    run_log_cnt = 0;
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, run_log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20, run_log[0]);
+    TEST_ASSERT_EQUAL_UINT32(10, run_log[1]);
+    TEST_ASSERT_EQUAL_UINT32(30, run_log[2]);
+
+    lv_timer_delete(t10);
+    lv_timer_delete(t20);
+    lv_timer_delete(t30);
+}
+
+void test_timer_runs_once_per_handler_call(void)
+{
+    uint32_t cnt = 0;
+    lv_timer_t * timer = lv_timer_create(count_cb, 0, &cnt);
+
+    lv_timer_handler();
+    lv_timer_handler();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, cnt);
+
+    lv_timer_delete(timer);
+}
+
+void test_timer_time_until_next(void)
+{
+    uint32_t cnt_20 = 0;
+    uint32_t cnt_50 = 0;
+    lv_timer_t * t20 = lv_timer_create(count_cb, 20, &cnt_20);
+    lv_timer_t * t50 = lv_timer_create(count_cb, 50, &cnt_50);
+
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_get_time_until_next());
+
+    lv_tick_inc(15);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_timer_handler());
+
+    lv_tick_inc(5);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, cnt_20);
+    TEST_ASSERT_EQUAL_UINT32(0, cnt_50);
+
+    /*Only the 50 ms timer is left: 30 ms from now*/
+    lv_timer_pause(t20);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+
+    lv_timer_set_period(t50, 25);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_timer_handler());
+
+    lv_timer_ready(t50);
+    TEST_ASSERT_EQUAL_UINT32(25, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, cnt_50);
+
+    lv_timer_resume(t20);
+    lv_timer_reset(t20);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_handler());
+
+    lv_timer_delete(t20);
+    lv_timer_delete(t50);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_repeat_count(void)
+{
+    uint32_t cnt = 0;
+    lv_timer_t * timer = lv_timer_create(count_cb, 10, &cnt);
+    lv_timer_set_repeat_count(timer, 3);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(3, cnt);
+    TEST_ASSERT_FALSE(timer_exists(timer));
+
+    /*Without auto delete the timer is paused instead*/
+    cnt = 0;
+    timer = lv_timer_create(count_cb, 10, &cnt);
+    lv_timer_set_repeat_count(timer, 1);
+    lv_timer_set_auto_delete(timer, false);
+    lv_tick_inc(10);
+    lv_timer_handler();
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timer));
+
+    lv_timer_delete(timer);
+}
+
+void test_timer_delete_in_callback(void)
+{
+    uint32_t cnt = 0;
+    lv_timer_t * victim = lv_timer_create(count_cb, 20, &cnt);
+    lv_timer_t * killer = lv_timer_create(delete_other_cb, 10, &victim);
+    lv_timer_create(delete_self_cb, 10, NULL);
+
+    /*The killer runs first and deletes the victim which was ready as well*/
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_NULL(victim);
+    TEST_ASSERT_EQUAL_UINT32(0, cnt);
+
+    lv_timer_delete(killer);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_heap_consistent(void)
+{
+    /*Random operations: after each handler call no ready timer may be left out
+     *and the returned time has to be the smallest time remaining*/
+    lv_timer_t * timers[STRESS_TIMER_CNT];
+    uint32_t cnt[STRESS_TIMER_CNT];
+    uint32_t rnd = 0x1234;
+    uint32_t i;
+    for(i = 0; i < STRESS_TIMER_CNT; i++) {
+        rnd = rnd * 1103515245 + 12345;
+        cnt[i] = 0;
+        timers[i] = lv_timer_create(count_cb, (rnd >> 16) % 100, &cnt[i]);
+    }
+
+    uint32_t step;
+    for(step = 0; step < 2000; step++) {
+        rnd = rnd * 1103515245 + 12345;
+        lv_timer_t * timer = timers[(rnd >> 16) % STRESS_TIMER_CNT];
+        rnd = rnd * 1103515245 + 12345;
+        switch((rnd >> 16) % 6) {
+            case 0:
+                lv_timer_pause(timer);
+                break;
+            case 1:
+                lv_timer_resume(timer);
+                break;
+            case 2:
+                lv_timer_set_period(timer, (rnd >> 8) % 100);
+                break;
+            case 3:
+                lv_timer_reset(timer);
+                break;
+            case 4:
+                lv_timer_ready(timer);
+                break;
+            default:
+                break;
+        }
+
+        lv_tick_inc((rnd >> 4) % 20);
+        uint32_t time_until_next = lv_timer_handler();
+
+        uint32_t min_remaining = LV_NO_TIMER_READY;
+        for(i = 0; i < STRESS_TIMER_CNT; i++) {
+            lv_timer_t * t = timers[i];
+            if(lv_timer_get_paused(t)) continue;
+
+            uint32_t elapsed = lv_tick_elaps(t->last_run);
+            uint32_t remaining = elapsed >= t->period ? 0 : t->period - elapsed;
+            /*Only a timer which has just run can be ready (period 0)*/
+            if(remaining == 0) TEST_ASSERT_EQUAL_UINT32(LV_GLOBAL_DEFAULT()->timer_state.handler_cnt, t->run_cnt);
+            if(remaining < min_remaining) min_remaining = remaining;
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(min_remaining, time_until_next);
+    }
+
+    for(i = 0; i < STRESS_TIMER_CNT; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+#endif
@@ -850,4 +850,74 @@ void test_label_setting_text_disables_translation(void)
     TEST_ASSERT_EQUAL_STRING(lv_label_get_text(label), "Der Tiger");
 }
 
+void test_label_set_same_text_keeps_everything(void)
+{
+    char buf[16];
+    lv_label_set_text(label, "12.5");
+    const char * text = lv_label_get_text(label);
+    lv_refr_now(NULL);
+
+    /*Identical text from an other buffer: no reallocation, no redraw*/
+    lv_strcpy(buf, "12.5");
+    lv_label_set_text(label, buf);
+    TEST_ASSERT_EQUAL_PTR(text, lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_default()->inv_p);
+
+    /*A value of the same length reuses the buffer but is redrawn*/
+    lv_label_set_text(label, "13.0");
+    TEST_ASSERT_EQUAL_PTR(text, lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_STRING("13.0", lv_label_get_text(label));
+    TEST_ASSERT_NOT_EQUAL_UINT32(0, lv_display_get_default()->inv_p);
+}
+
+void test_label_numeric_update_keeps_valid_size(void)
+{
+    /*Digits of different width, kerning and line breaks in a narrow wrapping label*/
+    const lv_font_t * font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_obj_set_width(long_label, 70);
+    lv_obj_set_style_text_letter_space(long_label, 2, LV_PART_MAIN);
+
+    /*Find two digits of the same width to often change only the text but not the layout*/
+    uint32_t same_w[2] = {0, 0};
+    uint32_t a;
+    uint32_t b;
+    for(a = 0; a < 10 && same_w[0] == same_w[1]; a++) {
+        for(b = a + 1; b < 10; b++) {
+            if(lv_font_get_glyph_width(font, '0' + a, 0) == lv_font_get_glyph_width(font, '0' + b, 0)) {
+                same_w[0] = a;
+                same_w[1] = b;
+                break;
+            }
+        }
+    }
+    TEST_ASSERT_NOT_EQUAL_UINT32(same_w[0], same_w[1]);
+
+    uint32_t rnd = 12345;
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        char buf[32];
+        uint32_t d[6];
+        uint32_t j;
+        for(j = 0; j < 6; j++) {
+            rnd = rnd * 1103515245 + 12345;
+            if(i % 2) d[j] = (rnd >> 16) % 10;
+            else d[j] = same_w[(rnd >> 16) % 2];
+        }
+
+        lv_snprintf(buf, sizeof(buf), "%d%d.%d °C", d[0], d[1], d[2]);
+        lv_label_set_text(label, buf);
+        lv_snprintf(buf, sizeof(buf), "%d1%d1 %d%d.%d%%", d[0], d[1], d[3], d[4], d[5]);
+        lv_label_set_text(long_label, buf);
+        lv_obj_update_layout(active_screen);
+
+        lv_point_t size;
+        lv_text_get_size(&size, lv_label_get_text(label), font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+        TEST_ASSERT_EQUAL_INT32(size.x, lv_obj_get_width(label));
+        TEST_ASSERT_EQUAL_INT32(size.y, lv_obj_get_height(label));
+
+        lv_text_get_size(&size, lv_label_get_text(long_label), font, 2, 0, 70, LV_TEXT_FLAG_NONE);
+        TEST_ASSERT_EQUAL_INT32(size.y, lv_obj_get_height(long_label));
+    }
+}
+
 #endif
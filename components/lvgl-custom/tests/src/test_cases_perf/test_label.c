@@ -5,6 +5,9 @@
 static lv_obj_t * active_screen = NULL;
 static lv_obj_t * label = NULL;
 
+static const char * long_text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae";
+
 void setUp(void)
 {
     active_screen = lv_screen_active();
@@ -13,8 +16,30 @@ void setUp(void)
 
 void test_label(void)
 {
-    TEST_ASSERT_MAX_TIME(lv_label_set_text, 0.5, label,
-                         "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae");
+    TEST_ASSERT_MAX_TIME(lv_label_set_text, 0.5, label, long_text);
+
+}
+
+void test_label_same_text(void)
+{
+    /*Re-setting the same text must not measure it again*/
+    lv_label_set_text(label, long_text);
+    TEST_ASSERT_MAX_TIME_ITER(lv_label_set_text, 0.5, 100, label, long_text);
+}
 
+static void set_numeric_texts(lv_obj_t * obj)
+{
+    /*Values like the ones a sensor dashboard shows at 10 Hz*/
+    static const char * values[] = {"31.5", "31.6", "31.4", "30.9", "31.0", "31.1", "32.0", "31.8"};
+    uint32_t i;
+    for(i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        lv_label_set_text(obj, values[i]);
+    }
+}
+
+void test_label_numeric_update(void)
+{
+    lv_label_set_text(label, "00.0");
+    TEST_ASSERT_MAX_TIME_ITER(set_numeric_texts, 0.5, 100, label);
 }
 #endif
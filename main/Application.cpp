@@ -6,13 +6,18 @@
  */
 
 #include "Application.h"
+#include "BootTimeline.h"      // Boot phase timestamps
 #include "State.h"             // Global state singleton
+#include "Telemetry.h"         // Task, stack and heap statistics
+#include "UICommandQueue.h"    // Cross-task UI commands
+#include "WebServer.h"         // Config server stop
+#include "WiFiManager.h"       // Config AP stop
 #include "driver/gpio.h"       // GPIO configuration for button
 #include "esp_timer.h"         // High-resolution timer for timestamps
 #include "esp_log.h"           // ESP logging
 #include "freertos/FreeRTOS.h" // FreeRTOS primitives
 #include "freertos/task.h"     // Task creation and delays
-#include "lvgl.h"              // LVGL async calls
+#include "freertos/event_groups.h" // Boot task join
 #include <NimBLEDevice.h>      // BLE scanning
 
 /// Global button state for ISR and task interaction
@@ -22,18 +27,19 @@ static Application::ButtonState g_buttonState = {};
 static constexpr uint32_t DEBOUNCE_DELAY_MS = 50;
 
 // Timing constants (milliseconds)
-static constexpr uint32_t SPLASH_SCREEN_DELAY_MS = 1000;     ///< Delay before showing splash screen
-static constexpr uint32_t MAIN_SCREEN_DELAY_MS = 4500;       ///< Delay before showing main/pair screen
-static constexpr uint32_t LABEL_INIT_DELAY_MS = 50;          ///< Delay after initializing labels
 static constexpr uint32_t LONG_PRESS_DURATION_MS = 2000;     ///< Duration for long press (clear pairing)
 static constexpr uint32_t VERY_LONG_PRESS_DURATION_MS = 15000; ///< Duration for very long press (WiFi mode)
 static constexpr uint32_t CONTROL_LOOP_DELAY_MS = 100;       ///< Main control loop iteration delay
 static constexpr uint32_t BLE_SCAN_TIME_MS = 1000;           ///< BLE scan window duration
+static constexpr uint32_t BOOT_TASK_STACK_SIZE = 3584;       ///< Boot task stack (same as the app_main task)
+static constexpr uint32_t WIFI_TASK_STACK_SIZE = 3584;       ///< WiFi switch task stack (AP/httpd start ran on app_main)
 
-// Default configuration values
-static constexpr float DEFAULT_FRONT_PSI = 36.0f;            ///< Default front tire pressure
-static constexpr float DEFAULT_REAR_PSI = 42.0f;             ///< Default rear tire pressure
-static constexpr int DEFAULT_BRIGHTNESS_INDEX = 4;           ///< Default brightness (100%)
+// Helper task completion bits (m_bootEvents)
+static constexpr EventBits_t BOOT_DISPLAY_READY = 1U << 0;    ///< Display, LVGL and splash screen up
+static constexpr EventBits_t BOOT_CONFIG_READY = 1U << 1;     ///< Configuration loaded
+static constexpr EventBits_t WIFI_SWITCH_DONE = 1U << 2;      ///< WiFi mode switch task finished
+
+// Configuration limits (the defaults are in ConfigManager)
 static constexpr uint8_t MAX_BRIGHTNESS_INDEX = 4;           ///< Maximum brightness index
 
 /// Log tag for Application module
@@ -64,39 +70,55 @@ Application &Application::instance() {
 
 /**
  * @brief Initialize application subsystems
- * @details Initialization flow:
- *          1. Load configuration from NVS
- *          2. Check for WiFi config mode flag
- *          3. Initialize display and UI
- *          4. Record start time for screen transitions
- *          5. Start BLE scanning (normal mode) OR web server (WiFi mode)
- *          6. Start LVGL UI system
+ * @details Boot phases run concurrently on two short-lived tasks:
+ *          - boot_display: LCD, boot splash, LVGL and ui_init()
+ *            (see DisplayManager::init())
+ *          - boot_config: NVS configuration and WiFi mode flag, then BLE
+ *            scanning. NimBLE needs NVS, so BLE waits for the configuration
+ *            on the same task.
+ *
+ *          init() joins on both the display and the configuration, then:
+ *          1. Applies the saved brightness and the version/WiFi label
+ *          2. Records start time
+ *          3. Starts the LVGL UI system
+ *          4. Starts the web server (WiFi mode)
+ *
+ *          BLE may still be starting when init() returns. Every phase is
+ *          recorded in BootTimeline, and the control task shows the main/pair
+ *          screen as soon as the phases it needs are reached.
  */
 void Application::init() {
+	BootTimeline::instance().mark(BootTimeline::Phase::AppStart);
+
 	// Set default log level for all components
 	esp_log_level_set("*", ESP_LOG_WARN);
+	// Serial reports (compiled in at INFO by their source files)
+	esp_log_level_set("Telemetry", ESP_LOG_INFO);
+	esp_log_level_set("Latency", ESP_LOG_INFO);
+	esp_log_level_set("BootTimeline", ESP_LOG_INFO);
+	esp_log_level_set("UIController", ESP_LOG_INFO);
+#if DISPLAY_RENDER_BENCHMARK
+	esp_log_level_set("DisplayManager", ESP_LOG_INFO);
+	esp_log_level_set("ImageCache", ESP_LOG_INFO);
+#endif
 	ESP_LOGI(TAG, "Initializing application...");
 
-	// Load configuration from NVS (sensors, brightness, WiFi mode flag)
-	loadConfiguration();
-	
-	// Check if we should boot into WiFi configuration mode
-	m_wifiConfigMode = isWiFiConfigMode();
-	if (m_wifiConfigMode) {
-		ESP_LOGI(TAG, "Starting in WiFi CONFIG MODE");
-	}
-	
-	// Initialize LCD display and UI controllers
-	initializeDisplay();
+	// Display bring-up and config/BLE overlap: the panel init delays, SPI
+	// transfers and flash reads of one phase leave the CPU to the other
+	m_bootEvents = xEventGroupCreate();
+	xTaskCreate(displayBootTaskWrapper, "boot_display", BOOT_TASK_STACK_SIZE, this,
+				tskIDLE_PRIORITY + 3, nullptr);
+	xTaskCreate(configBootTaskWrapper, "boot_config", BOOT_TASK_STACK_SIZE, this,
+				tskIDLE_PRIORITY + 2, nullptr);
+
+	// Brightness and labels need both the display and the configuration
+	xEventGroupWaitBits(m_bootEvents, BOOT_DISPLAY_READY | BOOT_CONFIG_READY,
+						pdFALSE, pdTRUE, portMAX_DELAY);
+	applyDisplaySettings();
 	
-	// Record start timestamp for screen transition timing
+	// Record start timestamp
 	recordStartTime();
 	
-	if (!m_wifiConfigMode) {
-		// Normal mode: Start BLE scanning for TPMS sensors
-		initBLE();
-	}
-	
 	// Start LVGL tick timer for UI updates
 	startUISystem();
 	
@@ -108,57 +130,113 @@ void Application::init() {
 	ESP_LOGI(TAG, "Application initialized successfully");
 }
 
+/**
+ * @brief Boot task: display bring-up
+ * @details Signals BOOT_DISPLAY_READY and deletes itself
+ */
+void Application::displayBootTask() {
+	initializeDisplay();
+	xEventGroupSetBits(m_bootEvents, BOOT_DISPLAY_READY);
+	vTaskDelete(nullptr);
+}
+
+/**
+ * @brief Boot task: configuration, then BLE
+ * @details Signals BOOT_CONFIG_READY as soon as the configuration is loaded,
+ *          then starts BLE scanning and deletes itself. BLE also scans in
+ *          WiFi config mode, for the live sensor list of the web page.
+ */
+void Application::configBootTask() {
+	BootTimeline &boot = BootTimeline::instance();
+
+	// Load configuration from NVS (sensors, brightness, WiFi mode flag)
+	boot.begin(BootTimeline::Phase::ConfigLoaded);
+	loadConfiguration();
+	
+	// Check if we should boot into WiFi configuration mode
+	m_wifiConfigMode = isWiFiConfigMode();
+	if (m_wifiConfigMode) {
+		ESP_LOGI(TAG, "Starting in WiFi CONFIG MODE");
+	}
+	boot.mark(BootTimeline::Phase::ConfigLoaded);
+	xEventGroupSetBits(m_bootEvents, BOOT_CONFIG_READY);
+
+	// Start BLE scanning for TPMS sensors (coexistence friendly parameters)
+	boot.begin(BootTimeline::Phase::BleStarted);
+	initBLE();
+	boot.mark(BootTimeline::Phase::BleStarted);
+	vTaskDelete(nullptr);
+}
+
 /**
  * @brief Load application configuration from NVS
  * @details Loads and validates:
- *          - Sensor addresses (front/rear)
+ *          - Sensor addresses (front/rear) and State pairing status
  *          - Ideal pressure values (PSI/BAR)
  *          - Pressure unit preference
  *          - Display brightness level
- *          - Updates State pairing status
+ *          Later changes reach State through configChangedCallback().
  */
 void Application::loadConfiguration() {
-	State &state = State::getInstance();
-
-	// Initialize ConfigManager and load JSON from NVS
+	// Initialize ConfigManager and load the config record from NVS
 	m_config.init();
-	ESP_LOGI(TAG, "Loaded JSON Config: %s", m_config.getJsonString().c_str());
-
-	// Load sensor MAC addresses
-	std::string frontAddr, rearAddr;
-	m_config.getString("front_address", frontAddr, "");
-	m_config.getString("rear_address", rearAddr, "");
-	state.setFrontAddress(frontAddr);
-	state.setRearAddress(rearAddr);
-
-	ESP_LOGI(TAG, "Loaded sensor addresses: Front=%s, Rear=%s",
-		   state.getFrontAddress().c_str(), state.getRearAddress().c_str());
-
-	// Load ideal pressure values with defaults
-	float frontPSI, rearPSI;
-	m_config.getFloat("front_ideal_psi", frontPSI, DEFAULT_FRONT_PSI);
-	m_config.getFloat("rear_ideal_psi", rearPSI, DEFAULT_REAR_PSI);
-	state.setFrontIdealPSI(frontPSI);
-	state.setRearIdealPSI(rearPSI);
-	
-	// Load pressure unit preference (PSI or BAR)
-	std::string unit;
-	m_config.getString("pressure_unit", unit, "PSI");
-	state.setPressureUnit(unit);
+	ESP_LOGI(TAG, "Loaded Config: %s", m_config.toJSON().c_str());
+
+	// Sensors, pressures and unit (ConfigManager supplies the defaults)
+	applyConfig(ConfigManager::ALL_KEYS);
+	m_config.addListener(configChangedCallback, this);
 
 	// Load and validate brightness setting (0-4 index into BRIGHTNESS_LEVELS array)
-	int brightnessIndex = DEFAULT_BRIGHTNESS_INDEX;
-	m_config.getInt("brightness_index", brightnessIndex, DEFAULT_BRIGHTNESS_INDEX);
+	const int brightnessIndex = m_config.getInt(ConfigInt::BrightnessIndex);
 	m_currentBrightnessIndex = static_cast<uint8_t>(brightnessIndex);
-	if (m_currentBrightnessIndex > MAX_BRIGHTNESS_INDEX) {
+	if (brightnessIndex < 0 || m_currentBrightnessIndex > MAX_BRIGHTNESS_INDEX) {
 		m_currentBrightnessIndex = MAX_BRIGHTNESS_INDEX;
 	}
+}
+
+/**
+ * @brief Apply changed configuration keys
+ * @param changed ConfigManager::keyBit() mask of the changed keys
+ * @details State is updated directly, the control task picks up a new
+ *          pairing status (main/pair screen) and WiFi mode on its next loop.
+ *          Brightness is applied by cycleBrightness() itself.
+ */
+void Application::applyConfig(uint32_t changed) {
+	State &state = State::getInstance();
 
-	// Update pairing status based on whether both addresses are configured
-	state.setIsPaired(!state.getFrontAddress().empty() && !state.getRearAddress().empty());
+	const uint32_t addressKeys = ConfigManager::keyBit(ConfigString::FrontAddress) |
+								 ConfigManager::keyBit(ConfigString::RearAddress);
+	if (changed & addressKeys) {
+		state.setFrontAddress(m_config.getString(ConfigString::FrontAddress));
+		state.setRearAddress(m_config.getString(ConfigString::RearAddress));
 
-	ESP_LOGI(TAG, "Sensors: Front=%s, Rear=%s, Paired=%d",
-		   state.getFrontAddress().c_str(), state.getRearAddress().c_str(), state.getIsPaired());
+		// Paired once both addresses are configured
+		state.setIsPaired(!state.getFrontAddress().empty() && !state.getRearAddress().empty());
+		ESP_LOGI(TAG, "Sensors: Front=%s, Rear=%s, Paired=%d",
+			   state.getFrontAddress().c_str(), state.getRearAddress().c_str(), state.getIsPaired());
+	}
+	if (changed & ConfigManager::keyBit(ConfigFloat::FrontIdealPsi)) {
+		state.setFrontIdealPSI(m_config.getFloat(ConfigFloat::FrontIdealPsi));
+	}
+	if (changed & ConfigManager::keyBit(ConfigFloat::RearIdealPsi)) {
+		state.setRearIdealPSI(m_config.getFloat(ConfigFloat::RearIdealPsi));
+	}
+	if (changed & ConfigManager::keyBit(ConfigString::PressureUnit)) {
+		state.setPressureUnit(m_config.getString(ConfigString::PressureUnit));
+	}
+	if (changed & ConfigManager::keyBit(ConfigInt::WiFiConfigMode)) {
+		m_wifiModeRequested = isWiFiConfigMode();
+	}
+}
+
+/**
+ * @brief ConfigManager change listener
+ * @param changed ConfigManager::keyBit() mask of the changed keys
+ * @param ctx Application instance
+ * @details Runs on the task that committed (control task or web server)
+ */
+void Application::configChangedCallback(uint32_t changed, void *ctx) {
+	static_cast<Application *>(ctx)->applyConfig(changed);
 }
 
 /**
@@ -166,8 +244,7 @@ void Application::loadConfiguration() {
  * @details Steps:
  *          1. Get DisplayManager singleton and initialize LCD/LVGL
  *          2. Get UIController and PairController singletons
- *          3. Set version label or WiFi mode label on splash screen
- *          4. Apply saved brightness setting from configuration
+ *          Runs on the boot_display task, the configuration may not be loaded yet.
  */
 void Application::initializeDisplay() {
 	// Initialize LCD display and LVGL
@@ -175,9 +252,19 @@ void Application::initializeDisplay() {
 	m_display->init();
 
 	// Get UI controller instances
+	m_backlight = &BacklightController::instance();
 	m_uiController = &UIController::instance();
 	m_pairController = &PairController::instance();
+}
 
+/**
+ * @brief Apply the configuration to the display
+ * @details Steps:
+ *          1. Set version label or WiFi mode label on splash screen
+ *          2. Apply saved brightness setting from configuration
+ *          Called once both boot tasks signalled, before the LVGL task starts.
+ */
+void Application::applyDisplaySettings() {
 	// Set version or WiFi mode label before any screen transitions
 	if (m_wifiConfigMode) {
 		m_uiController->setWiFiModeLabel();
@@ -186,14 +273,14 @@ void Application::initializeDisplay() {
 	}
 
 	// Apply saved brightness setting from configuration
-	m_display->setBacklightBrightness(BRIGHTNESS_LEVELS[m_currentBrightnessIndex]);
+	m_backlight->setBrightness(BRIGHTNESS_LEVELS[m_currentBrightnessIndex]);
 	ESP_LOGI(TAG, "Display brightness: %d%% (index %d)",
 		   BRIGHTNESS_LEVELS[m_currentBrightnessIndex], m_currentBrightnessIndex);
 }
 
 /**
  * @brief Record application start timestamp
- * @details Used for calculating elapsed time for screen transitions
+ * @details Reference point for getStartTime()
  */
 void Application::recordStartTime() {
 	m_startTime = esp_timer_get_time() / 1000; // Convert microseconds to milliseconds
@@ -208,9 +295,10 @@ void Application::startUISystem() {
 
 /**
  * @brief Start application main loop
- * @details Creates two FreeRTOS tasks:
+ * @details Creates three FreeRTOS tasks:
  *          1. LVGL task - handles GUI rendering and touch input
  *          2. Control logic task - handles screen transitions, button input, app state
+ *          3. Telemetry task - samples CPU, stack and heap usage
  */
 void Application::run() {
 	// Start LVGL timer handler task (handles GUI updates at ~30fps)
@@ -219,6 +307,9 @@ void Application::run() {
 	// Create control logic task (handles screen transitions and app state)
 	xTaskCreate(controlLogicTaskWrapper, "control_logic", 2048, this,
 				tskIDLE_PRIORITY + 2, nullptr);
+
+	// Sample per-task CPU share, stack high-water marks and heap usage
+	Telemetry::instance().start();
 }
 
 /**
@@ -259,14 +350,15 @@ void Application::initBLE() {
  *          - Handle button input for brightness/pairing/mode changes
  *          - Update pairing controller in pairing mode
  *          - Update UI with sensor data in normal mode
+ *          - Write debounced configuration changes
+ *          - Enter/leave WiFi config mode when the configuration asks for it
  * 
  * Operating modes:
- * - WiFi Config Mode: Show splash, wait for button press to exit
+ * - WiFi Config Mode: Stay on splash, wait for button press to exit
  * - Pairing Mode: Guide user through sensor pairing workflow
  * - Normal Mode: Display sensor data, handle brightness control
  */
 void Application::controlLogicTask() {
-	bool splashShown = false;
 	bool mainShown = false;
 	bool inPairingMode = false;
 
@@ -275,25 +367,27 @@ void Application::controlLogicTask() {
 
 	// Main application loop
 	for (;;) {
-		uint32_t elapsed = getElapsedTime();
 		uint32_t currentTime = esp_timer_get_time() / 1000;
 
-		// In WiFi config mode, stay on splash screen and only handle button input
+		// WiFi mode changed through the configuration (button or web UI)
+		const bool wifiModeRequested = m_wifiModeRequested;
+		if (wifiModeRequested != m_wifiConfigMode) {
+			switchWiFiMode(wifiModeRequested, mainShown);
+		}
+
+		// In WiFi config mode, stay on splash screen (WiFi mode label) and only handle button input
 		if (m_wifiConfigMode) {
-			// Show splash screen with WiFi mode label
-			if (elapsed >= SPLASH_SCREEN_DELAY_MS && !splashShown) {
-				lv_async_call(showSplashScreenCallback, nullptr);
-				splashShown = true;
-				printf("Showing splash screen (WiFi config mode)\\n");
-			}
 			// Monitor button for exit request (2s press) - interrupt-driven
 			handleButtonInput(g_buttonState);
 		} else {
 			// Normal mode operation
-			handleScreenTransitions(elapsed, splashShown, mainShown);
+			handleScreenTransitions(mainShown);
 
 			if (mainShown) {
 				State &state = State::getInstance();
+
+				// Dim / switch off the backlight after inactivity
+				m_backlight->update();
 				
 				if (!state.getIsPaired()) {
 					// In pairing mode: run pairing state machine
@@ -310,6 +404,9 @@ void Application::controlLogicTask() {
 			}
 		}
 
+		// Write debounced configuration changes (brightness)
+		m_config.update();
+
 		// Run control loop at 10Hz
 		vTaskDelay(pdMS_TO_TICKS(CONTROL_LOOP_DELAY_MS));
 	}
@@ -340,51 +437,56 @@ void Application::configureButton() {
 }
 
 /**
- * @brief Get elapsed time since application start
- * @return Milliseconds since init()
+ * @brief Check the boot phases the main/pair screen depends on
+ * @return true once the LVGL UI is up, the configuration is loaded and BLE
+ *         scanning runs
  */
-uint32_t Application::getElapsedTime() const {
-	return (esp_timer_get_time() / 1000) - m_startTime;
+bool Application::isBootComplete() const {
+	const BootTimeline &boot = BootTimeline::instance();
+	return boot.isReached(BootTimeline::Phase::UiReady) &&
+		   boot.isReached(BootTimeline::Phase::ConfigLoaded) &&
+		   boot.isReached(BootTimeline::Phase::BleStarted);
 }
 
 /**
- * @brief Handle timed screen transitions at startup
- * @param elapsed Time since application start (milliseconds)
- * @param splashShown Flag tracking if splash screen has been shown
+ * @brief Leave the splash screen as soon as the boot is complete, and follow
+ *        pairing status changes
  * @param mainShown Flag tracking if main/pair screen has been shown
  * 
- * @details Transition flow:
- *          1. At 1000ms: Show splash screen with logo/version
- *          2. At 4500ms: Show main screen (if paired) OR pair screen (if not paired)
- *          3. Initialize sensor labels if showing main screen
+ * @details The splash is on the panel from DisplayManager::init() on (first
+ *          as the pre-LVGL boot splash, then as the LVGL splash screen), so
+ *          there is no fixed delay:
+ *          1. Wait for isBootComplete()
+ *          2. Show main screen (if paired) OR pair screen (if not paired)
+ *          3. The target screen is created on first use (see UIController::createScreen)
+ *          Afterwards a completed pairing switches to the main screen and a
+ *          cleared pairing back to the pair screen, without a reboot.
  */
-void Application::handleScreenTransitions(uint32_t elapsed, bool &splashShown,
-										  bool &mainShown) {
+void Application::handleScreenTransitions(bool &mainShown) {
+	if (!isBootComplete()) {
+		return;
+	}
+
 	State &state = State::getInstance();
-	
-	// Step 1: Show splash screen after 1 second
-	if (elapsed >= SPLASH_SCREEN_DELAY_MS && !splashShown) {
-		lv_async_call(showSplashScreenCallback, nullptr);
-		splashShown = true;
-		ESP_LOGI(TAG, "Showing splash screen");
-	} 
-	// Step 2: Show main/pair screen after 4.5 seconds
-	else if (elapsed >= MAIN_SCREEN_DELAY_MS && !mainShown) {
-		if (state.getIsPaired()) {
-			// Sensors are paired: Show main screen with sensor data
-			lv_async_call(initializeLabelsCallback, nullptr);
-			ESP_LOGD(TAG, "Labels initialized");
-			vTaskDelay(pdMS_TO_TICKS(LABEL_INIT_DELAY_MS));
-			lv_async_call(showMainScreenCallback, nullptr);
-			ESP_LOGI(TAG, "Showing main screen");
-		} else {
-			// Sensors not paired: Show pairing workflow screen
-			lv_async_call(showPairScreenCallback, nullptr);
-			m_pairController->init();
-			ESP_LOGI(TAG, "Showing pair screen - not paired");
-		}
-		mainShown = true;
+	const bool paired = state.getIsPaired();
+	if (mainShown && paired == m_shownPaired) {
+		return;
+	}
+
+	UICommandQueue &commands = UICommandQueue::instance();
+	if (paired) {
+		// Sensors are paired: Show main screen (labels are initialized when it is created)
+		commands.post(UICommand::Type::ShowMainScreen);
+		ESP_LOGI(TAG, "Showing main screen");
+	} else {
+		// Sensors not paired: Show pairing workflow screen. The pairing view
+		// PairController posts next is applied after the screen switch.
+		commands.post(UICommand::Type::ShowPairScreen);
+		m_pairController->init();
+		ESP_LOGI(TAG, "Showing pair screen - not paired");
 	}
+	m_shownPaired = paired;
+	mainShown = true;
 }
 
 /**
@@ -393,15 +495,16 @@ void Application::handleScreenTransitions(uint32_t elapsed, bool &splashShown,
  * 
  * @details Button press durations:
  *          - Short press (<2s): Cycle brightness (normal mode) or pairing action
- *          - Long press (2-15s): Clear sensor addresses and reboot
+ *          - Long press (2-15s): Clear sensor addresses (back to pairing)
  *          - Very long press (>15s): Enter WiFi configuration mode
- *          - WiFi mode long press (>2s): Exit WiFi mode and reboot
+ *          - WiFi mode long press (>2s): Exit WiFi mode
  * 
  * Implementation notes:
  * - Button is active-low (pressed = GPIO low)
  * - Very long press has priority over long press
  * - Uses state machine to prevent double-handling
  * - Interrupt-driven with debounce (50ms) for low CPU usage
+ * - A press that wakes a dimmed/off backlight is not handled as a short press
  * - Checks button state every debounce cycle while pressed
  */
 void Application::handleButtonInput(ButtonState &state) {
@@ -417,6 +520,7 @@ void Application::handleButtonInput(ButtonState &state) {
 		if (state.lastState && !currentButtonState) {
 			state.pressStartTime = currentTime;
 			state.pressHandled = false;
+			state.wokeDisplay = m_backlight->wake();
 			ESP_LOGD(TAG, "Button pressed");
 		} 
 		// Button held down - check duration for long/very long press
@@ -446,8 +550,8 @@ void Application::handleButtonInput(ButtonState &state) {
 				if (pressDuration >= LONG_PRESS_DURATION_MS && pressDuration < VERY_LONG_PRESS_DURATION_MS) {
 					// Released after long press but before very long press
 					handleLongPress();
-				} else if (pressDuration < LONG_PRESS_DURATION_MS) {
-					// Short press
+				} else if (pressDuration < LONG_PRESS_DURATION_MS && !state.wokeDisplay) {
+					// Short press (unless it only woke the display)
 					handleShortPress();
 				}
 			}
@@ -467,21 +571,18 @@ void Application::handleButtonInput(ButtonState &state) {
 
 /**
  * @brief Handle long button press (2-15 seconds)
- * @details Clears sensor pairing addresses from configuration and reboots device
- *          to restart the pairing process from scratch
+ * @details Clears sensor pairing addresses from configuration. The change
+ *          listener marks State unpaired, and handleScreenTransitions() starts
+ *          the pairing process from scratch.
  */
 void Application::handleLongPress() {
-	ESP_LOGI(TAG, "Long press detected - clearing sensor addresses and rebooting...");
-	
-	// Clear sensor addresses from configuration
-	m_config.setString("front_address", "");
-	m_config.setString("rear_address", "");
+	ESP_LOGI(TAG, "Long press detected - clearing sensor addresses");
 	
-	// Brief delay for user feedback
-	vTaskDelay(pdMS_TO_TICKS(500));
-	
-	// Reboot device to re-enter pairing mode
-	esp_restart();
+	// Clear sensor addresses from configuration (one NVS write)
+	m_config.begin();
+	m_config.setString(ConfigString::FrontAddress, "");
+	m_config.setString(ConfigString::RearAddress, "");
+	m_config.commit();
 }
 
 /**
@@ -513,124 +614,68 @@ void Application::handleShortPress() {
 
 /**
  * @brief Cycle through display brightness levels
- * @details Cycles through 5 levels (10%, 30%, 50%, 75%, 100%) and saves preference
+ * @details Cycles through 5 levels (10%, 30%, 50%, 75%, 100%) and saves preference.
+ *          The save is debounced: stepping through the levels writes flash
+ *          once, a few seconds after the last press.
  */
 void Application::cycleBrightness() {
 	// Cycle to next brightness level (wraps at 5)
 	m_currentBrightnessIndex = (m_currentBrightnessIndex + 1) % 5;
 	uint8_t brightness = BRIGHTNESS_LEVELS[m_currentBrightnessIndex];
 	
-	// Apply new brightness to display
-	m_display->setBacklightBrightness(brightness);
+	// Fade the backlight to the new brightness
+	m_backlight->setBrightness(brightness);
 	
-	// Save brightness preference to NVS
-	m_config.setInt("brightness_index", m_currentBrightnessIndex);
+	// Save brightness preference to NVS once the user stops pressing
+	m_config.begin();
+	m_config.setInt(ConfigInt::BrightnessIndex, m_currentBrightnessIndex);
+	m_config.commitDebounced();
 	
 	ESP_LOGI(TAG, "Brightness set to %d%%", brightness);
 }
 
 /**
  * @brief Update UI with sensor data if sensors are paired
- * @details Requests async UI update in LVGL task context
+ * @details Requests a UI update in LVGL task context. A request still
+ *          queued from the previous loop is not repeated.
  */
 void Application::updateUIIfPaired() {
 	State &state = State::getInstance();
 	if (state.getIsPaired()) {
-		lv_async_call(updateLabelsCallback, nullptr);
+		UICommandQueue::instance().post(UICommand::Type::UpdateLabels);
 	}
 }
 
-// ============================================================================
-// LVGL Async Callbacks
-// ============================================================================
-// These callbacks are invoked via lv_async_call() to ensure they run in the
-// LVGL task context. This is required for thread-safe GUI updates.
-
 /**
- * @brief Callback to set version label on splash screen
- * @param arg Unused parameter (required by lv_async_call signature)
- */
-void Application::setVersionLabelCallback(void *arg) {
-	(void)arg;
-	UIController::instance().setVersionLabel();
-}
-
-/**
- * @brief Callback to show splash screen
- * @param arg Unused parameter (required by lv_async_call signature)
- */
-void Application::showSplashScreenCallback(void *arg) {
-	(void)arg;
-	UIController::instance().showSplashScreen();
-}
-
-/**
- * @brief Callback to show main sensor data screen
- * @param arg Unused parameter (required by lv_async_call signature)
- */
-void Application::showMainScreenCallback(void *arg) {
-	(void)arg;
-	UIController::instance().showMainScreen();
-}
-
-/**
- * @brief Callback to show sensor pairing screen
- * @param arg Unused parameter (required by lv_async_call signature)
+ * @brief FreeRTOS task wrapper for controlLogicTask
+ * @param pvParameter Pointer to Application instance
  */
-void Application::showPairScreenCallback(void *arg) {
-	(void)arg;
-	UIController::instance().showPairScreen();
+void Application::controlLogicTaskWrapper(void *pvParameter) {
+	static_cast<Application *>(pvParameter)->controlLogicTask();
 }
 
 /**
- * @brief Callback to initialize sensor data labels
- * @param arg Unused parameter (required by lv_async_call signature)
+ * @brief FreeRTOS task wrapper for displayBootTask
+ * @param pvParameter Pointer to Application instance
  */
-void Application::initializeLabelsCallback(void *arg) {
-	(void)arg;
-	UIController::instance().initializeLabels();
+void Application::displayBootTaskWrapper(void *pvParameter) {
+	static_cast<Application *>(pvParameter)->displayBootTask();
 }
 
 /**
- * @brief Callback to update sensor data labels on main screen
- * @param arg Unused parameter (required by lv_async_call signature)
- * @details Retrieves sensor data from State, updates alert blink state,
- *          and calls UIController to refresh all sensor displays
+ * @brief FreeRTOS task wrapper for configBootTask
+ * @param pvParameter Pointer to Application instance
  */
-void Application::updateLabelsCallback(void *arg) {
-	(void)arg;
-	State &state = State::getInstance();
-	UIController &ui = UIController::instance();
-
-	// Look up sensor data by address
-	TPMSUtil *frontSensor = nullptr;
-	TPMSUtil *rearSensor = nullptr;
-
-	auto frontIt = state.getData().find(state.getFrontAddress());
-	if (frontIt != state.getData().end()) {
-		frontSensor = frontIt->second;
-	}
-
-	auto rearIt = state.getData().find(state.getRearAddress());
-	if (rearIt != state.getData().end()) {
-		rearSensor = rearIt->second;
-	}
-
-	// Update alert blink state for warning indicators
-	uint32_t currentTime = esp_timer_get_time() / 1000;
-	ui.updateAlertBlinkState(currentTime);
-
-	// Update UI with current sensor readings
-	ui.updateSensorUI(frontSensor, rearSensor, state.getFrontIdealPSI(),
-					  state.getRearIdealPSI(), currentTime);
+void Application::configBootTaskWrapper(void *pvParameter) {
+	static_cast<Application *>(pvParameter)->configBootTask();
 }
 
 /**
- * @brief FreeRTOS task wrapper for controlLogicTask
+ * @brief FreeRTOS task wrapper for wifiSwitchTask
  * @param pvParameter Pointer to Application instance
  */
-void Application::controlLogicTaskWrapper(void *pvParameter) {
-	static_cast<Application *>(pvParameter)->controlLogicTask();
+void Application::wifiSwitchTaskWrapper(void *pvParameter) {
+	static_cast<Application *>(pvParameter)->wifiSwitchTask();
 }
 
 // ============================================================================
@@ -642,33 +687,80 @@ void Application::controlLogicTaskWrapper(void *pvParameter) {
  * @return true if wifi_config_mode flag is set in NVS
  */
 bool Application::isWiFiConfigMode() {
-	int wifiMode = 0;
-	m_config.getInt("wifi_config_mode", wifiMode, 0);
-	return wifiMode == 1;
+	return m_config.getInt(ConfigInt::WiFiConfigMode) == 1;
 }
 
 /**
  * @brief Enter WiFi configuration mode
- * @details Sets wifi_config_mode flag in NVS and reboots device
- *          into AP mode with web server for OTA updates
+ * @details Sets wifi_config_mode flag in NVS (a reset stays in WiFi mode);
+ *          the control loop switches to AP mode with web server for OTA
+ *          updates (switchWiFiMode())
  */
 void Application::enterWiFiConfigMode() {
 	ESP_LOGI(TAG, "Entering WiFi config mode...");
-	m_config.setInt("wifi_config_mode", 1);
-	vTaskDelay(pdMS_TO_TICKS(500));
-	esp_restart();
+	m_config.setInt(ConfigInt::WiFiConfigMode, 1);
 }
 
 /**
  * @brief Exit WiFi configuration mode
- * @details Clears wifi_config_mode flag in NVS and reboots device
- *          back to normal TPMS monitoring mode
+ * @details Clears wifi_config_mode flag in NVS; the control loop returns to
+ *          normal TPMS monitoring mode (switchWiFiMode())
  */
 void Application::exitWiFiConfigMode() {
 	ESP_LOGI(TAG, "Exiting WiFi config mode...");
-	m_config.setInt("wifi_config_mode", 0);
-	vTaskDelay(pdMS_TO_TICKS(500));
-	esp_restart();
+	m_config.setInt(ConfigInt::WiFiConfigMode, 0);
+}
+
+/**
+ * @brief Start or stop WiFi configuration mode in place
+ * @param enable true to enter WiFi mode
+ * @param mainShown Main/pair screen flag of the control loop, cleared when
+ *                  leaving so handleScreenTransitions() shows it again
+ * @details Runs on the control task. Entering shows the splash screen with
+ *          the WiFi label, as a WiFi mode boot does, and starts the AP and
+ *          web server. Leaving stops them. BLE scanning continues in both
+ *          modes (live sensor list of the web page).
+ *
+ *          The WiFi driver, netif and httpd calls need more stack than the
+ *          control loop has, so they run on a wifi_switch task sized like
+ *          app_main, which ran them before. The control task waits for it.
+ */
+void Application::switchWiFiMode(bool enable, bool &mainShown) {
+	const int64_t startUs = esp_timer_get_time();
+	m_wifiConfigMode = enable;
+
+	if (xTaskCreate(wifiSwitchTaskWrapper, "wifi_switch", WIFI_TASK_STACK_SIZE, this,
+					tskIDLE_PRIORITY + 2, nullptr) != pdPASS) {
+		// The control loop tries again on its next iteration
+		ESP_LOGE(TAG, "Failed to create WiFi switch task");
+		m_wifiConfigMode = !enable;
+		return;
+	}
+
+	if (enable) {
+		UICommandQueue::instance().post(UICommand::Type::ShowWiFiScreen);
+	} else {
+		mainShown = false;
+	}
+	xEventGroupWaitBits(m_bootEvents, WIFI_SWITCH_DONE, pdTRUE, pdTRUE, portMAX_DELAY);
+
+	ESP_LOGI(TAG, "%s WiFi config mode in %lu ms", enable ? "Entered" : "Left",
+			 static_cast<uint32_t>((esp_timer_get_time() - startUs) / 1000));
+}
+
+/**
+ * @brief WiFi switch task: start or stop the AP and web server
+ * @details Follows m_wifiConfigMode, signals WIFI_SWITCH_DONE and deletes itself
+ */
+void Application::wifiSwitchTask() {
+	if (m_wifiConfigMode) {
+		startConfigServer();
+	} else {
+		WebServer::instance().stop();
+		WiFiManager::instance().stop();
+	}
+	xEventGroupSetBits(m_bootEvents, WIFI_SWITCH_DONE);
+	vTaskDelete(nullptr);
 }
 
 /**
@@ -691,6 +783,7 @@ void Application::startConfigServer() {
 
 	if (!wifi.start()) {
 		ESP_LOGE(TAG, "Failed to start WiFi AP");
+		wifi.stop();  // Deinitialize the driver, the next attempt calls init() again
 		return;
 	}
 
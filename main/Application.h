@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BacklightController.h"
 #include "ConfigManager.h"
 #include "DisplayManager.h"
 #include "PairController.h"
@@ -7,6 +8,9 @@
 #include "UIController.h"
 #include "WiFiManager.h"
 #include "WebServer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include <atomic>
 #include <cstdint>
 
 /**
@@ -74,6 +78,7 @@ public:
 		bool pressHandled = false;   ///< Flag to prevent double-handling
 		bool debounceActive = false; ///< Debounce timer active flag
 		uint32_t debounceTime = 0;   ///< Debounce timeout timestamp
+		bool wokeDisplay = false;    ///< Press turned the backlight back on (short press ignored)
 	};
 
 private:
@@ -85,23 +90,32 @@ private:
 
 	// Initialization helpers
 	void loadConfiguration();    ///< Load config from NVS (sensors, brightness, etc.)
+	void applyConfig(uint32_t changed);  ///< Apply changed config keys to State and the requested mode
 	void initializeDisplay();    ///< Initialize LCD, LVGL, and UI controllers
+	void applyDisplaySettings(); ///< Apply saved brightness and version/WiFi label
 	void recordStartTime();      ///< Record boot timestamp for screen timing
 	void startUISystem();        ///< Start LVGL tick timer
 	void initBLE();              ///< Initialize BLE scanning for TPMS sensors
 	void startConfigServer();    ///< Start WiFi AP and web server for config mode
 
+	// Boot tasks (run concurrently during init())
+	void displayBootTask();   ///< Display bring-up
+	void configBootTask();    ///< Configuration load, then BLE start
+
+	// WiFi mode switch helper task (started by switchWiFiMode())
+	void wifiSwitchTask();    ///< WiFi AP and web server start/stop
+
 	// Main control task
 	void controlLogicTask();  ///< Main application loop (screen transitions, button handling)
 
 	// Control task helpers
 	void configureButton();  ///< Configure GPIO9 as button input with interrupt handler
-	uint32_t getElapsedTime() const;  ///< Get milliseconds since application start
-	void handleScreenTransitions(uint32_t elapsed, bool &splashShown,
-								 bool &mainShown);  ///< Manage splash -> main/pair screen flow
+	bool isBootComplete() const;  ///< Check the boot phases the main/pair screen depends on
+	void handleScreenTransitions(bool &mainShown);  ///< Manage splash -> main/pair screen flow
+	void switchWiFiMode(bool enable, bool &mainShown);  ///< Start/stop WiFi config mode in place
 
 	void handleButtonInput(ButtonState &state);  ///< Process button press/release events
-	void handleLongPress();      ///< 2s press: Clear sensor pairing and reboot
+	void handleLongPress();      ///< 2s press: Clear sensor pairing (pair screen follows)
 	void handleVeryLongPress();  ///< 15s press: Enter WiFi config mode
 	void handleShortPress();     ///< Short press: Cycle brightness or pairing action
 	void cycleBrightness();      ///< Cycle through 5 brightness levels (10-100%)
@@ -109,29 +123,31 @@ private:
 	
 	// WiFi config mode helpers
 	bool isWiFiConfigMode();     ///< Check if wifi_config_mode flag is set in NVS
-	void enterWiFiConfigMode();  ///< Set flag and reboot into WiFi mode
-	void exitWiFiConfigMode();   ///< Clear flag and reboot into normal mode
-
-	// LVGL async callbacks (must run in LVGL task context)
-	static void setVersionLabelCallback(void *arg);      ///< Set version text on splash screen
-	static void showSplashScreenCallback(void *arg);     ///< Show splash screen
-	static void showMainScreenCallback(void *arg);       ///< Show main sensor screen
-	static void showPairScreenCallback(void *arg);       ///< Show sensor pairing screen
-	static void initializeLabelsCallback(void *arg);     ///< Initialize sensor labels
-	static void updateLabelsCallback(void *arg);         ///< Update sensor data on main screen
-
-	// FreeRTOS task wrapper
+	void enterWiFiConfigMode();  ///< Set flag, the control loop enters WiFi mode
+	void exitWiFiConfigMode();   ///< Clear flag, the control loop returns to normal mode
+
+	// Configuration change listener (runs on the committing task)
+	static void configChangedCallback(uint32_t changed, void *ctx);
+
+	// FreeRTOS task wrappers
 	static void controlLogicTaskWrapper(void *pvParameter);  ///< Static wrapper for task creation
+	static void displayBootTaskWrapper(void *pvParameter);   ///< Static wrapper for the display boot task
+	static void configBootTaskWrapper(void *pvParameter);    ///< Static wrapper for the config boot task
+	static void wifiSwitchTaskWrapper(void *pvParameter);    ///< Static wrapper for the WiFi switch task
 
 	// Member variables
 	ConfigManager m_config;                 ///< Configuration manager (NVS persistence)
 	DisplayManager *m_display = nullptr;    ///< Display manager (LCD/LVGL)
+	BacklightController *m_backlight = nullptr; ///< Backlight brightness and auto-dim
 	UIController *m_uiController = nullptr; ///< UI controller (screen/label updates)
 	PairController *m_pairController = nullptr; ///< Sensor pairing state machine
 	TPMSScanCallbacks m_scanCallbacks;      ///< BLE scan callbacks for TPMS detection
 	uint32_t m_startTime = 0;               ///< Application start timestamp (ms)
+	EventGroupHandle_t m_bootEvents = nullptr; ///< Boot and WiFi switch task completion bits
 
 	static constexpr uint8_t BRIGHTNESS_LEVELS[5] = {10, 30, 50, 75, 100}; ///< Available brightness percentages
 	uint8_t m_currentBrightnessIndex = 4;   ///< Current brightness level index (0-4)
 	bool m_wifiConfigMode = false;          ///< True if in WiFi configuration mode
+	std::atomic<bool> m_wifiModeRequested{false}; ///< WiFi mode set in the configuration, applied by the control task
+	bool m_shownPaired = false;             ///< Pairing status the shown main/pair screen reflects
 };
\ No newline at end of file
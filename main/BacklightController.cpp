@@ -0,0 +1,244 @@
+/**
+ * @file BacklightController.cpp
+ * @brief Backlight controller implementation
+ * @details LEDC hardware fades between gamma-corrected duty cycles and the
+ *          inactivity state machine (active -> dimmed -> off).
+ */
+
+#include "BacklightController.h"
+#include <array>
+#include <driver/ledc.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+static const char *TAG = "Backlight";
+
+static constexpr ledc_mode_t SPEED_MODE = LEDC_LOW_SPEED_MODE;
+
+/**
+ * @brief Build the brightness -> duty table at compile time
+ * @return Duty cycle (0-8191) for each perceived brightness 0-100%
+ * @details Brightness is treated as CIE 1931 lightness L* and converted to
+ *          relative luminance: Y = L / 903.3 for L <= 8, otherwise
+ *          Y = ((L + 16) / 116)^3. 10% is about 1% duty, 50% about 18%.
+ */
+static constexpr std::array<uint16_t, 101> makeGammaTable() {
+	std::array<uint16_t, 101> table{};
+	constexpr double maxDuty = 8191.0;
+	for (int l = 0; l <= 100; l++) {
+		double y;
+		if (l <= 8) {
+			y = l / 903.3;
+		} else {
+			const double t = (l + 16) / 116.0;
+			y = t * t * t;
+		}
+		table[l] = static_cast<uint16_t>(y * maxDuty + 0.5);
+	}
+	return table;
+}
+
+/// Perceived brightness (%) -> 13-bit LEDC duty
+static constexpr std::array<uint16_t, 101> GAMMA_TABLE = makeGammaTable();
+
+/**
+ * @brief Get current time in milliseconds
+ * @return Milliseconds since boot
+ */
+static uint32_t nowMs() {
+	return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the BacklightController singleton
+ */
+BacklightController &BacklightController::instance() {
+	static BacklightController controller;
+	return controller;
+}
+
+/**
+ * @brief Configure the LEDC timer/channel and the fade service
+ * @details 13-bit resolution is the maximum at 5 kHz (80 MHz APB clock) and
+ *          leaves enough steps for the low end of the gamma curve.
+ */
+void BacklightController::init() {
+	static_assert(GAMMA_TABLE[100] == (1U << BACKLIGHT_RESOLUTION) - 1,
+				  "Gamma table does not match the PWM resolution");
+
+	m_mutex = xSemaphoreCreateMutex();
+	m_lastActivityMs = nowMs();
+
+	// Configure LEDC timer for PWM backlight control
+	ledc_timer_config_t ledc_timer = {
+		.speed_mode = SPEED_MODE,
+		.duty_resolution = static_cast<ledc_timer_bit_t>(BACKLIGHT_RESOLUTION),
+		.timer_num = LEDC_TIMER_0,
+		.freq_hz = BACKLIGHT_FREQ,
+		.clk_cfg = LEDC_AUTO_CLK,
+		.deconfigure = false
+	};
+	ESP_ERROR_CHECK(ledc_timer_config(&ledc_timer));
+
+	// Configure LEDC channel for backlight pin
+	ledc_channel_config_t ledc_channel = {
+		.gpio_num = BACKLIGHT_PIN,
+		.speed_mode = SPEED_MODE,
+		.channel = static_cast<ledc_channel_t>(BACKLIGHT_CHANNEL),
+		.intr_type = LEDC_INTR_DISABLE,
+		.timer_sel = LEDC_TIMER_0,
+		.duty = 0,
+		.hpoint = 0,
+		.flags = {}
+	};
+	ESP_ERROR_CHECK(ledc_channel_config(&ledc_channel));
+
+	// Hardware fade service (installs the LEDC fade-end interrupt)
+	ESP_ERROR_CHECK(ledc_fade_func_install(0));
+
+	// Start dark: DisplayManager calls fadeIn() once the boot splash is on the
+	// panel, so the uninitialized panel RAM is never visible
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	fadeTo(0, 0);
+	xSemaphoreGive(m_mutex);
+}
+
+/**
+ * @brief Set the configured brightness
+ * @param brightness Perceived brightness percentage (0-100)
+ * @details While dimmed or off only the stored level changes. It is used
+ *          when the backlight wakes up again.
+ */
+void BacklightController::setBrightness(uint8_t brightness) {
+	if (brightness > 100) {
+		brightness = 100;
+	}
+
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	m_brightness = brightness;
+	if (m_mode == Mode::Active) {
+		fadeTo(brightness, BRIGHTNESS_FADE_MS);
+	}
+	xSemaphoreGive(m_mutex);
+
+	ESP_LOGI(TAG, "Brightness set to %d%% (duty: %u/8191)", brightness, GAMMA_TABLE[brightness]);
+}
+
+/**
+ * @brief Record activity (e.g. a new sensor reading)
+ */
+void BacklightController::notifyActivity() {
+	m_lastActivityMs.store(nowMs(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Record activity and turn the backlight back on immediately
+ * @return true if the backlight was dimmed or off
+ */
+bool BacklightController::wake() {
+	notifyActivity();
+
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	const bool wasAsleep = (m_mode != Mode::Active);
+	if (wasAsleep) {
+		m_mode = Mode::Active;
+		fadeTo(m_brightness, WAKE_FADE_MS);
+	}
+	xSemaphoreGive(m_mutex);
+
+	if (wasAsleep) {
+		ESP_LOGI(TAG, "Backlight woken up");
+	}
+	return wasAsleep;
+}
+
+/**
+ * @brief Apply the inactivity timeouts
+ * @details Only compares timestamps. The dim and off ramps run in the LEDC
+ *          peripheral for SLEEP_FADE_MS after the mode change.
+ */
+void BacklightController::update() {
+	const uint32_t idleMs = nowMs() - m_lastActivityMs.load(std::memory_order_relaxed);
+
+	Mode mode = Mode::Active;
+	if (idleMs >= OFF_TIMEOUT_MS) {
+		mode = Mode::Off;
+	} else if (idleMs >= DIM_TIMEOUT_MS) {
+		mode = Mode::Dimmed;
+	}
+
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	const bool changed = (mode != m_mode);
+	if (changed) {
+		m_mode = mode;
+		fadeTo(levelFor(mode), mode == Mode::Active ? WAKE_FADE_MS : SLEEP_FADE_MS);
+	}
+	xSemaphoreGive(m_mutex);
+
+	if (changed) {
+		ESP_LOGI(TAG, "Backlight %s after %lu ms idle",
+				 mode == Mode::Active ? "active" : (mode == Mode::Dimmed ? "dimmed" : "off"),
+				 idleMs);
+	}
+}
+
+/**
+ * @brief Fade the backlight out (screen transition)
+ * @param durationMs Fade duration in milliseconds
+ */
+void BacklightController::fadeOut(uint32_t durationMs) {
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	fadeTo(0, durationMs);
+	xSemaphoreGive(m_mutex);
+}
+
+/**
+ * @brief Fade the backlight back to the level of the current mode
+ * @param durationMs Fade duration in milliseconds
+ * @details A screen switched while the backlight is off stays dark.
+ */
+void BacklightController::fadeIn(uint32_t durationMs) {
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	fadeTo(levelFor(m_mode), durationMs);
+	xSemaphoreGive(m_mutex);
+}
+
+/**
+ * @brief Get the brightness of a mode
+ * @param mode Inactivity state
+ * @return Brightness percentage (0-100)
+ */
+uint8_t BacklightController::levelFor(Mode mode) const {
+	switch (mode) {
+	case Mode::Dimmed:
+		return m_brightness < DIM_BRIGHTNESS ? m_brightness : DIM_BRIGHTNESS;
+	case Mode::Off:
+		return 0;
+	case Mode::Active:
+	default:
+		return m_brightness;
+	}
+}
+
+/**
+ * @brief Start a hardware fade
+ * @param brightness Target brightness percentage (0-100)
+ * @param durationMs Fade duration in milliseconds (0 = set immediately)
+ * @details A fade still in progress is stopped first, so the new fade starts
+ *          from the current duty instead of waiting for the old one to end.
+ *          The LEDC fader steps the duty linearly between the two table
+ *          values. ESP32-C3 has no hardware gamma-curve fade.
+ */
+void BacklightController::fadeTo(uint8_t brightness, uint32_t durationMs) {
+	const ledc_channel_t channel = static_cast<ledc_channel_t>(BACKLIGHT_CHANNEL);
+	const uint32_t duty = GAMMA_TABLE[brightness > 100 ? 100 : brightness];
+
+	ESP_ERROR_CHECK(ledc_fade_stop(SPEED_MODE, channel));
+	if (durationMs == 0) {
+		ESP_ERROR_CHECK(ledc_set_duty_and_update(SPEED_MODE, channel, duty, 0));
+		return;
+	}
+	ESP_ERROR_CHECK(ledc_set_fade_with_time(SPEED_MODE, channel, duty, durationMs));
+	ESP_ERROR_CHECK(ledc_fade_start(SPEED_MODE, channel, LEDC_FADE_NO_WAIT));
+}
@@ -0,0 +1,148 @@
+/**
+ * @file BacklightController.h
+ * @brief Backlight brightness, fades and inactivity dimming
+ * @details Drives the backlight PWM through the LEDC peripheral. Brightness
+ *          changes are hardware fades (ledc_set_fade_with_time/ledc_fade_start),
+ *          so ramping costs no CPU time in the control or LVGL task.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class BacklightController
+ * @brief LEDC backlight with perceptual brightness and auto-dim
+ * @details Singleton that:
+ *          - Maps brightness percentages to duty cycles through a CIE 1931
+ *            lightness table, so equal steps look equally large
+ *          - Fades every change in hardware
+ *          - Dims the backlight after DIM_TIMEOUT_MS and switches it off after
+ *            OFF_TIMEOUT_MS without activity (new sensor readings, button presses)
+ *          - Fades out/in around screen transitions
+ *
+ *          notifyActivity() may be called from any task. The other methods
+ *          are serialized with a mutex (control task and LVGL task).
+ */
+class BacklightController {
+public:
+	/**
+	 * @enum Mode
+	 * @brief Inactivity state of the backlight
+	 */
+	enum class Mode : uint8_t {
+		Active,  ///< Configured brightness
+		Dimmed,  ///< DIM_BRIGHTNESS after DIM_TIMEOUT_MS without activity
+		Off      ///< Backlight off after OFF_TIMEOUT_MS without activity
+	};
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the BacklightController singleton
+	 */
+	static BacklightController &instance();
+
+	/**
+	 * @brief Configure the LEDC timer/channel and the fade service
+	 * @details Leaves the backlight off, fadeIn() turns it on
+	 */
+	void init();
+
+	/**
+	 * @brief Set the configured brightness
+	 * @param brightness Perceived brightness percentage (0-100)
+	 * @details Fades to the new level (only while Active)
+	 */
+	void setBrightness(uint8_t brightness);
+
+	/**
+	 * @brief Get the configured brightness
+	 * @return Brightness percentage (0-100)
+	 */
+	uint8_t getBrightness() const { return m_brightness; }
+
+	/**
+	 * @brief Get the current inactivity state
+	 * @return Active, Dimmed or Off
+	 */
+	Mode getMode() const { return m_mode; }
+
+	/**
+	 * @brief Record activity (e.g. a new sensor reading)
+	 * @details Only stores a timestamp, safe to call from any task. The
+	 *          backlight comes back on in the next update().
+	 */
+	void notifyActivity();
+
+	/**
+	 * @brief Record activity and turn the backlight back on immediately
+	 * @return true if the backlight was dimmed or off
+	 * @details Used for button presses: a press that wakes the display
+	 *          should not also trigger its normal action.
+	 */
+	bool wake();
+
+	/**
+	 * @brief Apply the inactivity timeouts
+	 * @details Call periodically from the control task. Starts a fade when the
+	 *          mode changes, otherwise does nothing.
+	 */
+	void update();
+
+	/**
+	 * @brief Fade the backlight out (screen transition)
+	 * @param durationMs Fade duration in milliseconds
+	 */
+	void fadeOut(uint32_t durationMs);
+
+	/**
+	 * @brief Fade the backlight back to the level of the current mode
+	 * @param durationMs Fade duration in milliseconds
+	 */
+	void fadeIn(uint32_t durationMs);
+
+private:
+	BacklightController() = default;
+	~BacklightController() = default;
+
+	BacklightController(const BacklightController &) = delete;
+	BacklightController &operator=(const BacklightController &) = delete;
+
+	/**
+	 * @brief Get the brightness of a mode
+	 * @param mode Inactivity state
+	 * @return Brightness percentage (0-100)
+	 */
+	uint8_t levelFor(Mode mode) const;
+
+	/**
+	 * @brief Start a hardware fade (caller holds m_mutex)
+	 * @param brightness Target brightness percentage (0-100)
+	 * @param durationMs Fade duration in milliseconds (0 = set immediately)
+	 */
+	void fadeTo(uint8_t brightness, uint32_t durationMs);
+
+	SemaphoreHandle_t m_mutex = nullptr;        ///< Serializes LEDC access
+	std::atomic<uint32_t> m_lastActivityMs{0};  ///< Last activity timestamp
+	uint8_t m_brightness = 100;                 ///< Configured brightness (%)
+	Mode m_mode = Mode::Active;                 ///< Current inactivity state
+
+	// PWM configuration
+	static constexpr int BACKLIGHT_PIN = 3;            ///< GPIO pin for backlight control
+	static constexpr int BACKLIGHT_CHANNEL = 0;        ///< LEDC channel number
+	static constexpr int BACKLIGHT_FREQ = 5000;        ///< PWM frequency (5 kHz)
+	static constexpr int BACKLIGHT_RESOLUTION = 13;    ///< PWM resolution (13-bit: 0-8191)
+
+	// Inactivity behavior
+	static constexpr uint32_t DIM_TIMEOUT_MS = 60 * 1000;      ///< Inactivity before dimming
+	static constexpr uint32_t OFF_TIMEOUT_MS = 5 * 60 * 1000;  ///< Inactivity before switching off
+	static constexpr uint8_t DIM_BRIGHTNESS = 10;              ///< Dimmed level (%), capped at the configured level
+
+	// Fade durations
+	static constexpr uint32_t BRIGHTNESS_FADE_MS = 300;  ///< User brightness change
+	static constexpr uint32_t WAKE_FADE_MS = 300;        ///< Dimmed/off -> active
+	static constexpr uint32_t SLEEP_FADE_MS = 2000;      ///< Active -> dimmed -> off
+};
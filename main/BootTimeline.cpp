@@ -0,0 +1,132 @@
+/**
+ * @file BootTimeline.cpp
+ * @brief Boot phase timestamps implementation
+ */
+
+// The phase report is logged at INFO. The committed sdkconfig compiles out
+// everything below ERROR, so this file keeps its INFO lines.
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+
+#include "BootTimeline.h"
+#include <esp_log.h>
+#include <esp_timer.h>
+
+static const char *TAG = "BootTimeline";
+
+/// Phase names for the report, indexed by BootTimeline::Phase
+static const char *const PHASE_NAMES[] = {
+	"app start",
+	"panel init",
+	"boot splash",
+	"lvgl init",
+	"ui ready",
+	"config loaded",
+	"ble started",
+	"main screen",
+	"first reading",
+};
+static_assert(sizeof(PHASE_NAMES) / sizeof(PHASE_NAMES[0]) ==
+			  static_cast<size_t>(BootTimeline::Phase::Count),
+			  "PHASE_NAMES does not match BootTimeline::Phase");
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the BootTimeline singleton
+ */
+BootTimeline &BootTimeline::instance() {
+	static BootTimeline timeline;
+	return timeline;
+}
+
+/**
+ * @brief Store the current time in an unset slot
+ * @param slot Timestamp slot (0 = unset)
+ * @return true if this call stored the time
+ * @details esp_timer starts before app_main, so a stored time is never 0
+ */
+bool BootTimeline::store(std::atomic<uint32_t> &slot) {
+	if (slot.load(std::memory_order_relaxed) != 0) {
+		return false;
+	}
+	uint32_t expected = 0;
+	const uint32_t now = static_cast<uint32_t>(esp_timer_get_time());
+	return slot.compare_exchange_strong(expected, now, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Record the start of a phase
+ * @param phase Boot phase starting
+ */
+void BootTimeline::begin(Phase phase) {
+	store(m_startUs[static_cast<size_t>(phase)]);
+}
+
+/**
+ * @brief Record the end of a phase (or the time a milestone was reached)
+ * @param phase Boot phase reached
+ */
+void BootTimeline::mark(Phase phase) {
+	if (store(m_timeUs[static_cast<size_t>(phase)]) && phase == Phase::FirstReading) {
+		ESP_LOGI(TAG, "First sensor reading on screen %lu ms after reset",
+				 timeUs(phase) / 1000);
+	}
+}
+
+/**
+ * @brief Check whether a phase was reached
+ * @param phase Boot phase
+ * @return true once mark() was called for the phase
+ */
+bool BootTimeline::isReached(Phase phase) const {
+	return timeUs(phase) != 0;
+}
+
+/**
+ * @brief Get the timestamp of a phase
+ * @param phase Boot phase
+ * @return Microseconds since reset, 0 if not reached yet
+ */
+uint32_t BootTimeline::timeUs(Phase phase) const {
+	return m_timeUs[static_cast<size_t>(phase)].load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Log all phases
+ * @details Phases are listed in enum order with start, end and duration (ms
+ *          since reset). Milestones only have an end time. The last line
+ *          compares the summed phase durations with the wall time from the
+ *          first phase start to the last phase end: the difference is the
+ *          time saved by running the display and config/BLE tasks
+ *          concurrently.
+ */
+void BootTimeline::report() const {
+	ESP_LOGI(TAG, "Boot phases (ms since reset):   start     end  duration");
+	uint32_t busyUs = 0;
+	uint32_t firstStartUs = UINT32_MAX;
+	uint32_t lastEndUs = 0;
+	for (size_t i = 0; i < PHASE_COUNT; i++) {
+		const uint32_t startUs = m_startUs[i].load(std::memory_order_relaxed);
+		const uint32_t endUs = m_timeUs[i].load(std::memory_order_relaxed);
+		if (endUs == 0) {
+			ESP_LOGI(TAG, "  %-14s                       -", PHASE_NAMES[i]);
+			continue;
+		}
+		if (startUs == 0 || startUs > endUs) {
+			ESP_LOGI(TAG, "  %-14s                 %7.1f", PHASE_NAMES[i], endUs / 1000.0);
+			continue;
+		}
+		ESP_LOGI(TAG, "  %-14s         %7.1f %7.1f %9.1f", PHASE_NAMES[i],
+				 startUs / 1000.0, endUs / 1000.0, (endUs - startUs) / 1000.0);
+		busyUs += endUs - startUs;
+		if (startUs < firstStartUs) {
+			firstStartUs = startUs;
+		}
+		if (endUs > lastEndUs) {
+			lastEndUs = endUs;
+		}
+	}
+	if (lastEndUs > firstStartUs) {
+		ESP_LOGI(TAG, "Init phases: %.1f ms of work in %.1f ms", busyUs / 1000.0,
+				 (lastEndUs - firstStartUs) / 1000.0);
+	}
+}
@@ -0,0 +1,99 @@
+/**
+ * @file BootTimeline.h
+ * @brief Boot phase timestamps
+ * @details Records when each boot phase started and ended (microseconds
+ *          since reset, esp_timer_get_time()) and logs them as one table once
+ *          the main or pair screen is shown.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class BootTimeline
+ * @brief Timestamps of the boot phases
+ * @details Singleton. begin() and mark() may be called from any task, the
+ *          boot phases run concurrently (see Application::init()). The first
+ *          call for a phase wins, so repeated marks (e.g. every sensor update)
+ *          cost only an atomic load. Phases without begin() are milestones.
+ */
+class BootTimeline {
+public:
+	/**
+	 * @enum Phase
+	 * @brief Boot phases, grouped by the task that runs them
+	 */
+	enum class Phase : uint8_t {
+		AppStart,      ///< Application::init() entered (milestone)
+		PanelInit,     ///< Display task: LovyanGFX panel and DMA init
+		BootSplash,    ///< Display task: boot splash pushed, backlight on
+		LvglInit,      ///< Display task: lv_init() and display driver
+		UiReady,       ///< Display task: LVGL splash screen created and loaded
+		ConfigLoaded,  ///< Config task: NVS init and configuration load
+		BleStarted,    ///< Config task: NimBLE stack init and scan start
+		MainScreen,    ///< Main or pair screen shown (milestone)
+		FirstReading,  ///< First sensor reading drawn on the main screen (milestone)
+		Count
+	};
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the BootTimeline singleton
+	 */
+	static BootTimeline &instance();
+
+	/**
+	 * @brief Record the start of a phase
+	 * @param phase Boot phase starting
+	 * @details Only the first call per phase is stored
+	 */
+	void begin(Phase phase);
+
+	/**
+	 * @brief Record the end of a phase (or the time a milestone was reached)
+	 * @param phase Boot phase reached
+	 * @details Only the first call per phase is stored
+	 */
+	void mark(Phase phase);
+
+	/**
+	 * @brief Check whether a phase was reached
+	 * @param phase Boot phase
+	 * @return true once mark() was called for the phase
+	 */
+	bool isReached(Phase phase) const;
+
+	/**
+	 * @brief Get the timestamp of a phase
+	 * @param phase Boot phase
+	 * @return Microseconds since reset, 0 if not reached yet
+	 */
+	uint32_t timeUs(Phase phase) const;
+
+	/**
+	 * @brief Log all phases with start, end and duration, and how much of the
+	 *        init work overlapped
+	 */
+	void report() const;
+
+private:
+	BootTimeline() = default;
+	~BootTimeline() = default;
+
+	BootTimeline(const BootTimeline &) = delete;
+	BootTimeline &operator=(const BootTimeline &) = delete;
+
+	static constexpr size_t PHASE_COUNT = static_cast<size_t>(Phase::Count);
+
+	/**
+	 * @brief Store the current time in an unset slot
+	 * @param slot Timestamp slot (0 = unset)
+	 * @return true if this call stored the time
+	 */
+	static bool store(std::atomic<uint32_t> &slot);
+
+	std::atomic<uint32_t> m_startUs[PHASE_COUNT] = {};  ///< Phase start times (0 = milestone / not started)
+	std::atomic<uint32_t> m_timeUs[PHASE_COUNT] = {};   ///< Phase end times (0 = not reached)
+};
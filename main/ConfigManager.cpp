@@ -1,39 +1,114 @@
 /**
  * @file ConfigManager.cpp
- * @brief Implementation of JSON-based configuration management with NVS persistence
- * @details Provides persistent configuration storage using ESP32's Non-Volatile Storage
- *          and cJSON library for flexible data serialization
+ * @brief Implementation of typed binary configuration management with NVS persistence
+ * @details Stores the configuration as one CRC-checked binary record in ESP32's
+ *          Non-Volatile Storage. cJSON is only used once, to migrate the JSON
+ *          document written by earlier firmware.
  */
 
 #include "ConfigManager.h"
-#include <esp_log.h>   // ESP logging functions
-#include <cstring>     // String utilities
+#include <esp_log.h>     // ESP logging functions
+#include <esp_timer.h>   // Debounce deadlines
+#include <esp_rom_crc.h> // Record CRC32
+#include <cJSON.h>       // Migration of the old JSON document
+#include <cstdio>        // snprintf
+#include <cstring>       // String utilities
 
 /// Log tag for ConfigManager module
 static const char* TAG = "ConfigManager";
 
+/// NVS key of the JSON document stored by earlier firmware
+static const char* LEGACY_JSON_KEY = "config_json";
+
+/// JSON names of the string keys (also the keys of the old JSON document)
+static const char* const STRING_NAMES[] = {"front_address", "rear_address", "pressure_unit"};
+/// Defaults of the string keys
+static const char* const STRING_DEFAULTS[] = {"", "", "PSI"};
+static_assert(sizeof(STRING_NAMES) / sizeof(STRING_NAMES[0]) == static_cast<size_t>(ConfigString::Count),
+              "STRING_NAMES does not match ConfigString");
+static_assert(sizeof(STRING_DEFAULTS) / sizeof(STRING_DEFAULTS[0]) == static_cast<size_t>(ConfigString::Count),
+              "STRING_DEFAULTS does not match ConfigString");
+
+/// JSON names of the float keys
+static const char* const FLOAT_NAMES[] = {"front_ideal_psi", "rear_ideal_psi"};
+/// Defaults of the float keys
+static constexpr float FLOAT_DEFAULTS[] = {36.0f, 42.0f};
+static_assert(sizeof(FLOAT_NAMES) / sizeof(FLOAT_NAMES[0]) == static_cast<size_t>(ConfigFloat::Count),
+              "FLOAT_NAMES does not match ConfigFloat");
+static_assert(sizeof(FLOAT_DEFAULTS) / sizeof(FLOAT_DEFAULTS[0]) == static_cast<size_t>(ConfigFloat::Count),
+              "FLOAT_DEFAULTS does not match ConfigFloat");
+
+/// JSON names of the integer keys
+static const char* const INT_NAMES[] = {"brightness_index", "wifi_config_mode"};
+/// Defaults of the integer keys
+static constexpr int32_t INT_DEFAULTS[] = {4, 0};
+static_assert(sizeof(INT_NAMES) / sizeof(INT_NAMES[0]) == static_cast<size_t>(ConfigInt::Count),
+              "INT_NAMES does not match ConfigInt");
+static_assert(sizeof(INT_DEFAULTS) / sizeof(INT_DEFAULTS[0]) == static_cast<size_t>(ConfigInt::Count),
+              "INT_DEFAULTS does not match ConfigInt");
+
+/**
+ * @brief Copy a string into a fixed-size record field
+ * @param dst Record field (STRING_SIZE bytes)
+ * @param src String to copy
+ * @return false if src did not fit (dst is left unchanged)
+ */
+static bool copyField(char* dst, const char* src) {
+    const size_t len = strlen(src);
+    if (len >= ConfigManager::STRING_SIZE) {
+        return false;
+    }
+    memcpy(dst, src, len + 1);
+    return true;
+}
+
+/**
+ * @brief Append a JSON string literal, escaping quotes, backslashes and control characters
+ * @param json Output
+ * @param value String to append
+ */
+static void appendJsonString(std::string& json, const char* value) {
+    json += '"';
+    for (const char* p = value; *p != '\0'; p++) {
+        if (*p == '"' || *p == '\\') {
+            json += '\\';
+            json += *p;
+        } else if (static_cast<unsigned char>(*p) < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*p));
+            json += escaped;
+        } else {
+            json += *p;
+        }
+    }
+    json += '"';
+}
+
 /**
  * @brief Construct ConfigManager with namespace and key
  * @param namespaceName NVS namespace (partition) to use
- * @param key NVS key name for the JSON configuration string
+ * @param key NVS key name for the binary record
+ * @details The defaults are in effect until init() loads the stored record
  */
 ConfigManager::ConfigManager(const std::string& namespaceName, const std::string& key)
-    : m_isInitialized(false), m_nvsHandle(0), m_namespaceName(namespaceName), 
-      m_configKey(key), m_configJson(nullptr) {
+    : m_isInitialized(false), m_nvsHandle(0), m_namespaceName(namespaceName),
+      m_configKey(key), m_record(), m_mutex(xSemaphoreCreateRecursiveMutex()),
+      m_transactionDepth(0), m_dirty(false), m_saveDueUs(0), m_changed(0),
+      m_listeners(), m_listenerCount(0) {
+    setDefaults();
 }
 
 /**
- * @brief Destructor - cleanup JSON object and close NVS handle
+ * @brief Destructor - close NVS handle
  */
 ConfigManager::~ConfigManager() {
-    // Free cJSON object if allocated
-    if (m_configJson != nullptr) {
-        cJSON_Delete(m_configJson);
-    }
     // Close NVS handle if open
     if (m_isInitialized && m_nvsHandle != 0) {
         nvs_close(m_nvsHandle);
     }
+    if (m_mutex != nullptr) {
+        vSemaphoreDelete(m_mutex);
+    }
 }
 
 /**
@@ -41,418 +116,468 @@ ConfigManager::~ConfigManager() {
  * @details Performs:
  *          1. NVS flash initialization (erases if needed)
  *          2. Opens NVS namespace
- *          3. Loads existing config or creates empty JSON object
+ *          3. Loads the binary record, else migrates the old JSON document,
+ *             else keeps the defaults
  * @return true on successful initialization
  */
 bool ConfigManager::init() {
     // Initialize NVS flash partition
     esp_err_t err = nvs_flash_init();
-    
+
     // Handle NVS errors that require erasing
     if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
         ESP_LOGI(TAG, "NVS flash needs to be erased");
         nvs_flash_erase();
         err = nvs_flash_init();
     }
-    
+
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "NVS initialization failed: %s", esp_err_to_name(err));
         return false;
     }
-    
+
     // Open NVS namespace with read/write access
     err = nvs_open(m_namespaceName.c_str(), NVS_READWRITE, &m_nvsHandle);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "NVS open failed: %s", esp_err_to_name(err));
         return false;
     }
-    
+
     m_isInitialized = true;
-    
-    // Load existing configuration or create new empty object
-    if (!loadJsonFromNVS()) {
-        m_configJson = cJSON_CreateObject();
-        ESP_LOGI(TAG, "Created new JSON config");
+
+    // Load existing configuration, upgrade the JSON format or start from defaults
+    if (!loadRecord() && !migrateFromJson()) {
+        setDefaults();
+        ESP_LOGI(TAG, "Using default config");
     }
-    
+
     ESP_LOGI(TAG, "ConfigManager initialized successfully");
     return true;
 }
 
 /**
- * @brief Load JSON configuration from NVS
- * @details Reads JSON string from NVS and parses it into cJSON object
- * @return true if loaded or created new config
+ * @brief Set all keys to their defaults (RAM only)
  */
-bool ConfigManager::loadJsonFromNVS() {
+void ConfigManager::setDefaults() {
+    memset(&m_record, 0, sizeof(m_record));
+    for (size_t i = 0; i < STRING_COUNT; i++) {
+        copyField(m_record.strings[i], STRING_DEFAULTS[i]);
+    }
+    for (size_t i = 0; i < FLOAT_COUNT; i++) {
+        m_record.floats[i] = FLOAT_DEFAULTS[i];
+    }
+    for (size_t i = 0; i < INT_COUNT; i++) {
+        m_record.ints[i] = INT_DEFAULTS[i];
+    }
+}
+
+/**
+ * @brief Load the binary record from NVS
+ * @details Reads header and record in one blob and checks magic, layout
+ *          version, size and CRC. m_record is only replaced by a valid record.
+ * @return true if a valid record was loaded
+ */
+bool ConfigManager::loadRecord() {
     if (!m_isInitialized) return false;
-    
-    // Query required buffer size
-    size_t requiredSize = 0;
-    esp_err_t err = nvs_get_str(m_nvsHandle, m_configKey.c_str(), nullptr, &requiredSize);
-    
-    // If no config exists, create new empty object
+
+    uint8_t blob[sizeof(Header) + sizeof(Record)];
+    size_t size = sizeof(blob);
+    esp_err_t err = nvs_get_blob(m_nvsHandle, m_configKey.c_str(), blob, &size);
     if (err == ESP_ERR_NVS_NOT_FOUND) {
         ESP_LOGI(TAG, "No existing config found");
-        m_configJson = cJSON_CreateObject();
-        return true;
-    }
-    
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to get config size: %s", esp_err_to_name(err));
         return false;
     }
-    
-    // Allocate buffer for JSON string
-    char* buffer = (char*)malloc(requiredSize);
-    if (buffer == nullptr) {
-        ESP_LOGE(TAG, "Failed to allocate memory for config");
+    // A record of another size fails with ESP_ERR_NVS_INVALID_LENGTH
+    if (err != ESP_OK || size != sizeof(blob)) {
+        ESP_LOGE(TAG, "Failed to get config: %s", esp_err_to_name(err));
         return false;
     }
-    
-    // Read JSON string from NVS
-    err = nvs_get_str(m_nvsHandle, m_configKey.c_str(), buffer, &requiredSize);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to get config: %s", esp_err_to_name(err));
-        free(buffer);
+
+    Header header;
+    Record record;
+    memcpy(&header, blob, sizeof(header));
+    memcpy(&record, blob + sizeof(header), sizeof(record));
+
+    if (header.magic != RECORD_MAGIC || header.size != sizeof(Record)) {
+        ESP_LOGE(TAG, "Config record has an unknown format");
         return false;
     }
-    
-    // Delete old JSON object if exists
-    if (m_configJson != nullptr) {
-        cJSON_Delete(m_configJson);
+    // Migrations from older layouts go here once RECORD_VERSION is raised
+    if (header.version != RECORD_VERSION) {
+        ESP_LOGE(TAG, "Config record version %u not supported", header.version);
+        return false;
     }
-    
-    // Parse JSON string
-    m_configJson = cJSON_Parse(buffer);
-    free(buffer);
-    
-    // Handle parse errors
-    if (m_configJson == nullptr) {
-        ESP_LOGE(TAG, "Failed to parse JSON config");
-        m_configJson = cJSON_CreateObject();
+    const uint32_t crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(&record), sizeof(record));
+    if (crc != header.crc) {
+        ESP_LOGE(TAG, "Config record CRC mismatch");
         return false;
     }
-    
+
+    // Never trust a stored string to be terminated
+    for (size_t i = 0; i < STRING_COUNT; i++) {
+        record.strings[i][STRING_SIZE - 1] = '\0';
+    }
+    m_record = record;
     ESP_LOGI(TAG, "Config loaded from NVS");
     return true;
 }
 
 /**
- * @brief Save JSON configuration to NVS
- * @details Serializes cJSON object to string and writes to NVS with commit
+ * @brief Save the binary record to NVS
+ * @details Writes header and record as one blob with commit. Clears any
+ *          pending debounced write, the whole record is written.
  * @return true if saved successfully
  */
-bool ConfigManager::saveJsonToNVS() {
-    if (!m_isInitialized || m_configJson == nullptr) return false;
-    
-    // Convert JSON object to formatted string
-    char* jsonString = cJSON_Print(m_configJson);
-    if (jsonString == nullptr) {
-        ESP_LOGE(TAG, "Failed to convert JSON to string");
-        return false;
-    }
-    
-    // Write string to NVS
-    esp_err_t err = nvs_set_str(m_nvsHandle, m_configKey.c_str(), jsonString);
-    free(jsonString);
-    
+bool ConfigManager::saveRecord() {
+    if (!m_isInitialized) return false;
+
+    Header header;
+    header.magic = RECORD_MAGIC;
+    header.version = RECORD_VERSION;
+    header.size = sizeof(Record);
+    header.crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(&m_record), sizeof(m_record));
+
+    uint8_t blob[sizeof(Header) + sizeof(Record)];
+    memcpy(blob, &header, sizeof(header));
+    memcpy(blob + sizeof(header), &m_record, sizeof(m_record));
+
+    // Write blob to NVS
+    esp_err_t err = nvs_set_blob(m_nvsHandle, m_configKey.c_str(), blob, sizeof(blob));
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to save config to NVS: %s", esp_err_to_name(err));
         return false;
     }
-    
+
     // Commit changes to flash
     err = nvs_commit(m_nvsHandle);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to commit NVS: %s", esp_err_to_name(err));
         return false;
     }
-    
+
+    m_dirty = false;
+    m_saveDueUs = 0;
     ESP_LOGI(TAG, "Config saved to NVS");
     return true;
 }
 
 /**
- * @brief Public wrapper for loading config from NVS
+ * @brief Import the JSON document of earlier firmware
+ * @details Keys missing from the document or of the wrong type keep their
+ *          defaults. The old key is erased once the record is saved, so the
+ *          migration runs once.
+ * @return true if a JSON document was found and imported
  */
-bool ConfigManager::loadConfig() {
-    return loadJsonFromNVS();
+bool ConfigManager::migrateFromJson() {
+    size_t requiredSize = 0;
+    esp_err_t err = nvs_get_str(m_nvsHandle, LEGACY_JSON_KEY, nullptr, &requiredSize);
+    if (err != ESP_OK) {
+        return false;
+    }
+
+    char* buffer = static_cast<char*>(malloc(requiredSize));
+    if (buffer == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate memory for config migration");
+        return false;
+    }
+    err = nvs_get_str(m_nvsHandle, LEGACY_JSON_KEY, buffer, &requiredSize);
+    cJSON* json = (err == ESP_OK) ? cJSON_Parse(buffer) : nullptr;
+    free(buffer);
+    if (json == nullptr) {
+        ESP_LOGE(TAG, "Failed to parse old JSON config, not migrated");
+        return false;
+    }
+
+    setDefaults();
+    for (size_t i = 0; i < STRING_COUNT; i++) {
+        const cJSON* item = cJSON_GetObjectItemCaseSensitive(json, STRING_NAMES[i]);
+        if (cJSON_IsString(item) && !copyField(m_record.strings[i], item->valuestring)) {
+            ESP_LOGW(TAG, "Old config value of %s too long, using default", STRING_NAMES[i]);
+        }
+    }
+    for (size_t i = 0; i < FLOAT_COUNT; i++) {
+        const cJSON* item = cJSON_GetObjectItemCaseSensitive(json, FLOAT_NAMES[i]);
+        if (cJSON_IsNumber(item)) {
+            m_record.floats[i] = static_cast<float>(item->valuedouble);
+        }
+    }
+    for (size_t i = 0; i < INT_COUNT; i++) {
+        const cJSON* item = cJSON_GetObjectItemCaseSensitive(json, INT_NAMES[i]);
+        if (cJSON_IsNumber(item)) {
+            m_record.ints[i] = static_cast<int32_t>(item->valuedouble);
+        }
+    }
+    cJSON_Delete(json);
+
+    if (!saveRecord()) {
+        return true;  // Imported for this boot, migrated again on the next one
+    }
+    nvs_erase_key(m_nvsHandle, LEGACY_JSON_KEY);
+    nvs_commit(m_nvsHandle);
+    ESP_LOGI(TAG, "Migrated JSON config to binary record");
+    return true;
 }
 
 /**
- * @brief Public wrapper for saving config to NVS
+ * @brief Start a transaction
+ * @details Holds m_mutex until the outermost commit(), so a transaction on
+ *          the web server task and a setter on the control task never mix
  */
-bool ConfigManager::saveConfig() {
-    return saveJsonToNVS();
+void ConfigManager::begin() {
+    xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+    m_transactionDepth++;
 }
 
 /**
- * @brief Set integer value in config
- * @param key Configuration key
- * @param value Integer value to store
- * @return true if saved successfully
+ * @brief End a transaction and write the changes to NVS
+ * @return true if nothing changed, the write was deferred (nested
+ *         transaction) or the write succeeded
  */
-bool ConfigManager::setInt(const std::string& key, int value) {
-    if (m_configJson == nullptr) return false;
-    
-    // Remove existing item and add new value
-    cJSON_DeleteItemFromObject(m_configJson, key.c_str());
-    cJSON_AddNumberToObject(m_configJson, key.c_str(), value);
-    
-    return saveJsonToNVS();
+bool ConfigManager::commit() {
+    bool ok = true;
+    if (--m_transactionDepth > 0) {
+        xSemaphoreGiveRecursive(m_mutex);
+        return ok;
+    }
+    if (m_dirty) {
+        ok = saveRecord();
+    }
+    endTransaction();
+    return ok;
 }
 
 /**
- * @brief Set double value in config
- * @param key Configuration key
- * @param value Double value to store
- * @return true if saved successfully
+ * @brief End a transaction and write the changes after SAVE_DEBOUNCE_MS
+ * @details Inside an outer transaction the outer commit() decides
  */
-bool ConfigManager::setDouble(const std::string& key, double value) {
-    if (!m_isInitialized || !m_configJson) return false;
-    
-    // Update existing item or add new one
-    cJSON* item = cJSON_GetObjectItem(m_configJson, key.c_str());
-    if (item) {
-        cJSON_SetNumberValue(item, value);
-    } else {
-        cJSON_AddNumberToObject(m_configJson, key.c_str(), value);
+void ConfigManager::commitDebounced() {
+    if (--m_transactionDepth > 0) {
+        xSemaphoreGiveRecursive(m_mutex);
+        return;
     }
-    
-    return saveJsonToNVS();
+    if (m_dirty) {
+        m_saveDueUs = esp_timer_get_time() + SAVE_DEBOUNCE_MS * 1000;
+    }
+    endTransaction();
 }
 
 /**
- * @brief Set float value in config
- * @param key Configuration key
- * @param value Float value to store
- * @return true if saved successfully
+ * @brief End the outermost transaction: release the mutex and notify the listeners
+ * @details The listeners run without the mutex, so one that waits for another
+ *          task using ConfigManager cannot deadlock. The new values are
+ *          applied even if their write is debounced or failed.
  */
-bool ConfigManager::setFloat(const std::string& key, float value) {
-    if (!m_isInitialized || !m_configJson) return false;
-    
-    // Update existing item or add new one (cast to double for cJSON)
-    cJSON* item = cJSON_GetObjectItem(m_configJson, key.c_str());
-    if (item) {
-        cJSON_SetNumberValue(item, static_cast<double>(value));
-    } else {
-        cJSON_AddNumberToObject(m_configJson, key.c_str(), static_cast<double>(value));
+void ConfigManager::endTransaction() {
+    const uint32_t changed = m_changed;
+    m_changed = 0;
+    const size_t count = m_listenerCount;
+    xSemaphoreGiveRecursive(m_mutex);
+
+    if (changed == 0) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        m_listeners[i].listener(changed, m_listeners[i].ctx);
     }
-    
-    return saveJsonToNVS();
 }
 
 /**
- * @brief Set string value in config
- * @param key Configuration key
- * @param value String value to store
- * @return true if saved successfully
+ * @brief Register a change listener
+ * @param listener Called after every outermost commit that changed keys
+ * @param ctx Passed to the listener
+ * @return false if MAX_LISTENERS are registered already
  */
-bool ConfigManager::setString(const std::string& key, const std::string& value) {
-    if (!m_isInitialized || !m_configJson) return false;
-    
-    // Update existing item or add new one
-    cJSON* item = cJSON_GetObjectItem(m_configJson, key.c_str());
-    if (item) {
-        cJSON_SetValuestring(item, value.c_str());
+bool ConfigManager::addListener(Listener listener, void *ctx) {
+    xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+    const bool ok = m_listenerCount < MAX_LISTENERS;
+    if (ok) {
+        m_listeners[m_listenerCount++] = {listener, ctx};
     } else {
-        cJSON_AddStringToObject(m_configJson, key.c_str(), value.c_str());
+        ESP_LOGE(TAG, "Too many config listeners");
     }
-    
-    return saveJsonToNVS();
+    xSemaphoreGiveRecursive(m_mutex);
+    return ok;
 }
 
 /**
- * @brief Set boolean value in config
- * @param key Configuration key
- * @param value Boolean value to store
- * @return true if saved successfully
+ * @brief Write debounced changes whose delay has elapsed
+ * @return false if a due write failed
  */
-bool ConfigManager::setBool(const std::string& key, bool value) {
-    if (m_configJson == nullptr) return false;
-    
-    // Remove existing item and add new value
-    cJSON_DeleteItemFromObject(m_configJson, key.c_str());
-    cJSON_AddBoolToObject(m_configJson, key.c_str(), value);
-    
-    return saveJsonToNVS();
+bool ConfigManager::update() {
+    if (m_saveDueUs == 0 || esp_timer_get_time() < m_saveDueUs) {
+        return true;
+    }
+    return flush();
 }
 
 /**
- * @brief Get integer value from config
- * @param key Configuration key
- * @param value Output parameter for retrieved value
- * @param defaultValue Default value if key not found
- * @return true if successful (even if using default)
+ * @brief Write debounced changes now
+ * @return true if nothing was pending or the write succeeded
  */
-bool ConfigManager::getInt(const std::string& key, int& value, int defaultValue) const {
-    if (m_configJson == nullptr) {
-        value = defaultValue;
-        return false;
+bool ConfigManager::flush() {
+    xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+    bool ok = true;
+    if (m_transactionDepth == 0 && m_saveDueUs != 0 && m_dirty) {
+        ok = saveRecord();
     }
-    
-    // Search for key (case-sensitive)
-    cJSON* item = cJSON_GetObjectItemCaseSensitive(m_configJson, key.c_str());
-    if (item == nullptr || !cJSON_IsNumber(item)) {
-        value = defaultValue;
-        return true;  // Return true even with default value
+    xSemaphoreGiveRecursive(m_mutex);
+    return ok;
+}
+
+/**
+ * @brief Public wrapper for loading config from NVS
+ * @details Falls back to the defaults if no valid record is stored
+ */
+bool ConfigManager::loadConfig() {
+    xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+    const bool ok = loadRecord();
+    if (!ok) {
+        setDefaults();
     }
-    
-    value = (int)item->valuedouble;
-    return true;
+    xSemaphoreGiveRecursive(m_mutex);
+    return ok;
 }
 
 /**
- * @brief Get double value from config
+ * @brief Public wrapper for saving config to NVS
+ */
+bool ConfigManager::saveConfig() {
+    xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+    const bool ok = saveRecord();
+    xSemaphoreGiveRecursive(m_mutex);
+    return ok;
+}
+
+/**
+ * @brief Set string value in config
  * @param key Configuration key
- * @param value Output parameter for retrieved value
- * @param defaultValue Default value if key not found
- * @return true if key exists, false if using default
+ * @param value String value to store
+ * @return true if saved successfully, false if too long or not saved
+ * @details Each setter is a transaction of its own: it saves immediately, or
+ *          at the commit() of an enclosing transaction. Unchanged values are
+ *          not written and not notified.
  */
-bool ConfigManager::getDouble(const std::string& key, double& value, double defaultValue) const {
-    if (!m_isInitialized || !m_configJson) {
-        value = defaultValue;
+bool ConfigManager::setString(ConfigString key, const std::string& value) {
+    const size_t i = static_cast<size_t>(key);
+    if (value.size() >= STRING_SIZE) {
+        ESP_LOGE(TAG, "Value of %s too long (%u bytes)", STRING_NAMES[i],
+                 static_cast<unsigned>(value.size()));
         return false;
     }
-    
-    cJSON* item = cJSON_GetObjectItem(m_configJson, key.c_str());
-    if (item && cJSON_IsNumber(item)) {
-        value = item->valuedouble;
-        return true;
+
+    begin();
+    if (value != m_record.strings[i]) {
+        copyField(m_record.strings[i], value.c_str());
+        m_dirty = true;
+        m_changed |= keyBit(key);
     }
-    
-    value = defaultValue;
-    return false;
+    return commit();
 }
 
 /**
- * @brief Get float value from config
+ * @brief Set float value in config
  * @param key Configuration key
- * @param value Output parameter for retrieved value
- * @param defaultValue Default value if key not found
- * @return true if key exists, false if using default
+ * @param value Float value to store
+ * @return true if saved successfully
  */
-bool ConfigManager::getFloat(const std::string& key, float& value, float defaultValue) const {
-    if (!m_isInitialized || !m_configJson) {
-        value = defaultValue;
-        return false;
+bool ConfigManager::setFloat(ConfigFloat key, float value) {
+    const size_t i = static_cast<size_t>(key);
+    begin();
+    if (m_record.floats[i] != value) {
+        m_record.floats[i] = value;
+        m_dirty = true;
+        m_changed |= keyBit(key);
     }
-    
-    cJSON* item = cJSON_GetObjectItem(m_configJson, key.c_str());
-    if (item && cJSON_IsNumber(item)) {
-        value = static_cast<float>(item->valuedouble);
-        return true;
+    return commit();
+}
+
+/**
+ * @brief Set integer value in config
+ * @param key Configuration key
+ * @param value Integer value to store
+ * @return true if saved successfully
+ */
+bool ConfigManager::setInt(ConfigInt key, int value) {
+    const size_t i = static_cast<size_t>(key);
+    begin();
+    if (m_record.ints[i] != value) {
+        m_record.ints[i] = value;
+        m_dirty = true;
+        m_changed |= keyBit(key);
     }
-    
-    value = defaultValue;
-    return false;
+    return commit();
 }
 
 /**
  * @brief Get string value from config
  * @param key Configuration key
- * @param value Output parameter for retrieved value
- * @param defaultValue Default value if key not found
- * @return true if key exists, false if using default
+ * @return Stored value or the key's default
+ * @details Copied under the mutex, a concurrent setter may rewrite the field
  */
-bool ConfigManager::getString(const std::string& key, std::string& value, const std::string& defaultValue) const {
-    if (!m_isInitialized || !m_configJson) {
-        value = defaultValue;
-        return false;
-    }
-    
-    cJSON* item = cJSON_GetObjectItem(m_configJson, key.c_str());
-    if (item && cJSON_IsString(item)) {
-        value = item->valuestring;
-        return true;
-    }
-    
-    value = defaultValue;
-    return false;
+std::string ConfigManager::getString(ConfigString key) const {
+    xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+    std::string value(m_record.strings[static_cast<size_t>(key)]);
+    xSemaphoreGiveRecursive(m_mutex);
+    return value;
 }
 
 /**
- * @brief Get boolean value from config
+ * @brief Get float value from config
  * @param key Configuration key
- * @param value Output parameter for retrieved value
- * @param defaultValue Default value if key not found
- * @return true if successful (even if using default)
+ * @return Stored value or the key's default
  */
-bool ConfigManager::getBool(const std::string& key, bool& value, bool defaultValue) const {
-    if (m_configJson == nullptr) {
-        value = defaultValue;
-        return false;
-    }
-    
-    cJSON* item = cJSON_GetObjectItemCaseSensitive(m_configJson, key.c_str());
-    if (item == nullptr || !cJSON_IsBool(item)) {
-        value = defaultValue;
-        return true;  // Return true even with default value
-    }
-    
-    value = cJSON_IsTrue(item);
-    return true;
+float ConfigManager::getFloat(ConfigFloat key) const {
+    return m_record.floats[static_cast<size_t>(key)];
 }
 
 /**
- * @brief Delete a key from configuration
- * @param key Configuration key to remove
- * @return true if saved successfully
+ * @brief Get integer value from config
+ * @param key Configuration key
+ * @return Stored value or the key's default
  */
-bool ConfigManager::deleteKey(const std::string& key) {
-    if (m_configJson == nullptr) return false;
-    
-    cJSON_DeleteItemFromObject(m_configJson, key.c_str());
-    return saveJsonToNVS();
+int ConfigManager::getInt(ConfigInt key) const {
+    return m_record.ints[static_cast<size_t>(key)];
 }
 
 /**
- * @brief Erase all configuration data
+ * @brief Reset all keys to their defaults and save
  * @return true if saved successfully
  */
 bool ConfigManager::eraseAll() {
-    // Delete old JSON object
-    if (m_configJson != nullptr) {
-        cJSON_Delete(m_configJson);
-    }
-    // Create new empty object
-    m_configJson = cJSON_CreateObject();
-    return saveJsonToNVS();
+    begin();
+    setDefaults();
+    m_dirty = true;
+    m_changed = ALL_KEYS;
+    return commit();
 }
 
 /**
  * @brief Get entire configuration as JSON string
- * @return Formatted JSON string representation
+ * @return Compact JSON object, one member per key
+ * @details Built on demand, nothing is kept
  */
-std::string ConfigManager::getJsonString() const {
-    if (m_configJson == nullptr) return "{}";
-    
-    // Convert to formatted JSON string
-    char* jsonString = cJSON_Print(m_configJson);
-    std::string result(jsonString);
-    free(jsonString);
-    return result;
-}
+std::string ConfigManager::toJSON() const {
+    std::string json;
+    json.reserve(192);
+    char buf[48];
 
-/**
- * @brief Set entire configuration from JSON string
- * @param jsonString JSON string to parse and store
- * @return true if parsed and saved successfully
- */
-bool ConfigManager::setJsonString(const std::string& jsonString) {
-    // Parse JSON string
-    cJSON* newJson = cJSON_Parse(jsonString.c_str());
-    if (newJson == nullptr) {
-        ESP_LOGE(TAG, "Failed to parse JSON string");
-        return false;
+    xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+    json += '{';
+    for (size_t i = 0; i < STRING_COUNT; i++) {
+        if (i > 0) json += ',';
+        appendJsonString(json, STRING_NAMES[i]);
+        json += ':';
+        appendJsonString(json, m_record.strings[i]);
     }
-    
-    // Delete old JSON object
-    if (m_configJson != nullptr) {
-        cJSON_Delete(m_configJson);
+    for (size_t i = 0; i < FLOAT_COUNT; i++) {
+        snprintf(buf, sizeof(buf), ",\"%s\":%g", FLOAT_NAMES[i], static_cast<double>(m_record.floats[i]));
+        json += buf;
     }
-    m_configJson = newJson;
-    
-    return saveJsonToNVS();
-}
\ No newline at end of file
+    for (size_t i = 0; i < INT_COUNT; i++) {
+        snprintf(buf, sizeof(buf), ",\"%s\":%ld", INT_NAMES[i], static_cast<long>(m_record.ints[i]));
+        json += buf;
+    }
+    json += '}';
+    xSemaphoreGiveRecursive(m_mutex);
+    return json;
+}
@@ -1,91 +1,194 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
+#include <cstdint>
 #include <nvs_flash.h>
 #include <nvs.h>
-#include <cJSON.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+/**
+ * @enum ConfigString
+ * @brief String configuration keys
+ */
+enum class ConfigString : uint8_t {
+	FrontAddress,   ///< Front sensor MAC address, "" = not paired
+	RearAddress,    ///< Rear sensor MAC address, "" = not paired
+	PressureUnit,   ///< "PSI" or "BAR"
+	Count
+};
+
+/**
+ * @enum ConfigFloat
+ * @brief Floating point configuration keys
+ */
+enum class ConfigFloat : uint8_t {
+	FrontIdealPsi,  ///< Target pressure of the front tire
+	RearIdealPsi,   ///< Target pressure of the rear tire
+	Count
+};
+
+/**
+ * @enum ConfigInt
+ * @brief Integer configuration keys
+ */
+enum class ConfigInt : uint8_t {
+	BrightnessIndex,  ///< Index into Application::BRIGHTNESS_LEVELS
+	WiFiConfigMode,   ///< 1 = WiFi configuration mode (also after a reboot)
+	Count
+};
 
 /**
  * @class ConfigManager
- * @brief Manages application configuration storage in NVS using JSON format
- * @details Provides a JSON-based configuration system that persists to
- *          ESP32's Non-Volatile Storage (NVS). All configuration is stored
- *          as a single JSON object, making it easy to backup and restore.
- * 
+ * @brief Manages application configuration storage in NVS as a typed binary record
+ * @details All configuration lives in one fixed-layout record, stored as a
+ *          single NVS blob behind a header with magic, layout version, size
+ *          and CRC32. Keys are enum values, so a misspelled key or a type
+ *          mismatch does not compile, and a get is an array access.
+ *
  * Features:
- * - Type-safe getters and setters for common types
- * - Automatic JSON serialization/deserialization
- * - Persistent storage in NVS flash
- * - Default value support for missing keys
+ * - Defaults for every key, used when no valid record is stored
+ * - One-time migration of the JSON document stored by earlier firmware
+ * - JSON produced on demand only (toJSON())
+ * - Transactions: setters between begin() and commit() are written to flash
+ *   once, at commit()
+ * - Debounced saves for values that change in quick succession (commitDebounced())
+ * - Change notifications: listeners get the keys changed by each outermost
+ *   commit, so the application reconfigures in place instead of rebooting
  */
 class ConfigManager {
 public:
+	static constexpr size_t STRING_SIZE = 18;  ///< String capacity including the terminator (MAC address)
+	static constexpr size_t MAX_LISTENERS = 4; ///< Change listeners that can be registered
+
+	/**
+	 * @brief Change listener
+	 * @param changed Keys changed by the commit, see keyBit()
+	 * @param ctx User context passed to addListener()
+	 * @details Runs on the task that committed, after the mutex is released.
+	 *          Getters may be used; long work belongs to the listener's own task.
+	 */
+	using Listener = void (*)(uint32_t changed, void *ctx);
+
+	/** @brief Change mask bit of a string key */
+	static constexpr uint32_t keyBit(ConfigString key) {
+		return 1UL << static_cast<size_t>(key);
+	}
+
+	/** @brief Change mask bit of a float key */
+	static constexpr uint32_t keyBit(ConfigFloat key) {
+		return 1UL << (static_cast<size_t>(ConfigString::Count) + static_cast<size_t>(key));
+	}
+
+	/** @brief Change mask bit of an integer key */
+	static constexpr uint32_t keyBit(ConfigInt key) {
+		return 1UL << (static_cast<size_t>(ConfigString::Count) + static_cast<size_t>(ConfigFloat::Count) +
+					   static_cast<size_t>(key));
+	}
+
+	/// Change mask of all keys
+	static constexpr uint32_t ALL_KEYS = (1UL << (static_cast<size_t>(ConfigString::Count) +
+												  static_cast<size_t>(ConfigFloat::Count) +
+												  static_cast<size_t>(ConfigInt::Count))) - 1;
+
 	/**
 	 * @brief Constructor
 	 * @param namespaceName NVS namespace to use for storage
-	 * @param key Key name for the JSON config string in NVS
+	 * @param key Key name for the binary record in NVS
 	 */
-	ConfigManager(const std::string& namespaceName = "config", const std::string& key = "config_json");
+	ConfigManager(const std::string& namespaceName = "config", const std::string& key = "config_bin");
 	~ConfigManager();
 
 	/**
 	 * @brief Initialize NVS and load existing configuration
+	 * @details Without a valid record the JSON document of earlier firmware
+	 *          is migrated, or the defaults are used
 	 * @return true if successful, false otherwise
 	 */
 	bool init();
-	
+
 	/**
 	 * @brief Reload configuration from NVS
-	 * @return true if successful, false otherwise
+	 * @return true if a valid record was loaded, false if the defaults are used
 	 */
 	bool loadConfig();
-	
+
 	/**
 	 * @brief Save current configuration to NVS
 	 * @return true if successful, false otherwise
 	 */
 	bool saveConfig();
-	
-	// Setters for different data types (auto-save to NVS)
-	bool setInt(const std::string& key, int value);
-	bool setDouble(const std::string& key, double value);
-	bool setFloat(const std::string& key, float value);
-	bool setString(const std::string& key, const std::string& value);
-	bool setBool(const std::string& key, bool value);
-	
-	// Getters for different data types (with default value support)
-	bool getInt(const std::string& key, int& value, int defaultValue = 0) const;
-	bool getDouble(const std::string& key, double& value, double defaultValue = 0.0) const;
-	bool getFloat(const std::string& key, float& value, float defaultValue = 0.0f) const;
-	bool getString(const std::string& key, std::string& value, const std::string& defaultValue = "") const;
-	bool getBool(const std::string& key, bool& value, bool defaultValue = false) const;
-	
-	/**
-	 * @brief Delete a key from configuration
-	 * @param key Key to delete
-	 * @return true if successful, false otherwise
+
+	/**
+	 * @brief Start a transaction
+	 * @details Setters called until the matching commit() only change the
+	 *          configuration in RAM. Transactions nest; other tasks calling
+	 *          into ConfigManager wait until the outermost commit().
 	 */
-	bool deleteKey(const std::string& key);
-	
+	void begin();
+
 	/**
-	 * @brief Erase all configuration data
-	 * @return true if successful, false otherwise
+	 * @brief End a transaction and write the changes to NVS
+	 * @return true if nothing changed, the write was deferred (nested
+	 *         transaction) or the write succeeded
 	 */
-	bool eraseAll();
-	
+	bool commit();
+
 	/**
-	 * @brief Get entire configuration as JSON string
-	 * @return JSON string representation of configuration
+	 * @brief End a transaction and write the changes after SAVE_DEBOUNCE_MS
+	 * @details For values the user steps through (brightness): every further
+	 *          change restarts the delay, so a burst of changes costs one
+	 *          write. The write is done by update(); any immediate save
+	 *          writes the pending changes too.
+	 */
+	void commitDebounced();
+
+	/**
+	 * @brief Write debounced changes whose delay has elapsed
+	 * @details Call periodically (control loop)
+	 * @return false if a due write failed
 	 */
-	std::string getJsonString() const;
-	
+	bool update();
+
+	/**
+	 * @brief Write debounced changes now
+	 * @details Call before a restart
+	 * @return true if nothing was pending or the write succeeded
+	 */
+	bool flush();
+
 	/**
-	 * @brief Set entire configuration from JSON string
-	 * @param jsonString JSON string to parse and save
+	 * @brief Register a change listener
+	 * @param listener Called after every outermost commit that changed keys
+	 * @param ctx Passed to the listener
+	 * @return false if MAX_LISTENERS are registered already
+	 */
+	bool addListener(Listener listener, void *ctx);
+
+	// Setters (save to NVS unless in a transaction). setString fails for
+	// values longer than STRING_SIZE - 1.
+	bool setString(ConfigString key, const std::string& value);
+	bool setFloat(ConfigFloat key, float value);
+	bool setInt(ConfigInt key, int value);
+
+	// Getters (stored value or the key's default)
+	std::string getString(ConfigString key) const;
+	float getFloat(ConfigFloat key) const;
+	int getInt(ConfigInt key) const;
+
+	/**
+	 * @brief Reset all keys to their defaults and save
 	 * @return true if successful, false otherwise
 	 */
-	bool setJsonString(const std::string& jsonString);
-	
+	bool eraseAll();
+
+	/**
+	 * @brief Get entire configuration as JSON string
+	 * @return Compact JSON object, one member per key
+	 */
+	std::string toJSON() const;
+
 	/**
 	 * @brief Check if ConfigManager is initialized
 	 * @return true if initialized, false otherwise
@@ -93,21 +196,86 @@ public:
 	bool isInitialized() const { return m_isInitialized; }
 
 private:
+	static constexpr size_t STRING_COUNT = static_cast<size_t>(ConfigString::Count);
+	static constexpr size_t FLOAT_COUNT = static_cast<size_t>(ConfigFloat::Count);
+	static constexpr size_t INT_COUNT = static_cast<size_t>(ConfigInt::Count);
+
 	/**
-	 * @brief Load JSON configuration from NVS
-	 * @return true if successful, false otherwise
+	 * @struct Record
+	 * @brief The configuration, stored as is in NVS
+	 * @details Changing the layout (including adding a key) needs a new
+	 *          RECORD_VERSION and a migration in loadRecord().
 	 */
-	bool loadJsonFromNVS();
-	
+	struct Record {
+		char strings[STRING_COUNT][STRING_SIZE];  ///< Indexed by ConfigString
+		float floats[FLOAT_COUNT];                ///< Indexed by ConfigFloat
+		int32_t ints[INT_COUNT];                  ///< Indexed by ConfigInt
+	};
+
 	/**
-	 * @brief Save JSON configuration to NVS
-	 * @return true if successful, false otherwise
+	 * @struct Header
+	 * @brief Precedes the record in the NVS blob
+	 */
+	struct Header {
+		uint32_t magic;    ///< RECORD_MAGIC
+		uint16_t version;  ///< Record layout version
+		uint16_t size;     ///< sizeof(Record) when written
+		uint32_t crc;      ///< CRC32 of the record
+	};
+
+	static constexpr uint32_t RECORD_MAGIC = 0x47464354;  ///< "TCFG"
+	static constexpr uint16_t RECORD_VERSION = 1;         ///< Current Record layout
+	static constexpr int64_t SAVE_DEBOUNCE_MS = 3000;     ///< Quiet time before a debounced write
+
+	/**
+	 * @brief Load the binary record from NVS
+	 * @return true if a record with valid magic, version, size and CRC was loaded
+	 */
+	bool loadRecord();
+
+	/**
+	 * @brief Save the binary record to NVS
+	 * @return true if saved successfully
+	 */
+	bool saveRecord();
+
+	/**
+	 * @brief Import the JSON document of earlier firmware
+	 * @details Reads the old key, fills the record from it, saves the record
+	 *          and erases the old key
+	 * @return true if a JSON document was found and imported
+	 */
+	bool migrateFromJson();
+
+	/**
+	 * @brief Set all keys to their defaults (RAM only)
+	 */
+	void setDefaults();
+
+	/**
+	 * @brief End the outermost transaction: release the mutex and notify the listeners
+	 */
+	void endTransaction();
+
+	/**
+	 * @struct ListenerEntry
+	 * @brief A registered change listener
 	 */
-	bool saveJsonToNVS();
+	struct ListenerEntry {
+		Listener listener;  ///< Callback
+		void *ctx;          ///< User context
+	};
 
 	bool m_isInitialized;           ///< Initialization state flag
 	nvs_handle_t m_nvsHandle;       ///< NVS handle for storage operations
 	std::string m_namespaceName;    ///< NVS namespace name
-	std::string m_configKey;        ///< Key for JSON config in NVS
-	cJSON* m_configJson;            ///< cJSON object for configuration data
-};
\ No newline at end of file
+	std::string m_configKey;        ///< Key for the binary record in NVS
+	Record m_record;                ///< Current configuration
+	mutable SemaphoreHandle_t m_mutex;  ///< Recursive, held by accessors and open transactions
+	int m_transactionDepth;         ///< Nesting level of begin()
+	bool m_dirty;                   ///< Changed since the last write to NVS
+	int64_t m_saveDueUs;            ///< Debounced write time (esp_timer), 0 = none pending
+	uint32_t m_changed;             ///< Keys changed in the open transaction, see keyBit()
+	ListenerEntry m_listeners[MAX_LISTENERS];  ///< Registered change listeners
+	size_t m_listenerCount;         ///< Entries used in m_listeners
+};
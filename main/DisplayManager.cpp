@@ -1,8 +1,22 @@
+// Benchmark builds log the render statistics at INFO. The committed sdkconfig
+// compiles out everything below ERROR, so this file keeps its INFO lines then.
+#if defined(DISPLAY_RENDER_BENCHMARK) && DISPLAY_RENDER_BENCHMARK
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+#endif
+
 #include "DisplayManager.h"
+#include "BacklightController.h"
+#include "BootTimeline.h"
+#include "ImageCache.h"
+#include "LatencyTracker.h"
+#include "Profiler.h"
 #include "UI/ui.h"
+#include "UIController.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include <cstring>
 #include <driver/gpio.h>
-#include <driver/ledc.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 
 // Display resolution configuration
 #define TFT_HOR_RES 240
@@ -10,17 +24,36 @@
 #define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565))
 #define TFT_ROTATION LV_DISPLAY_ROTATION_0
 
+#if DISPLAY_DIRECT_MODE
+// LVGL draw buffer - one persistent full-screen frame (115 KB RGB565)
+#define DRAW_BUF_SIZE (TFT_HOR_RES * TFT_VER_RES * BYTES_PER_PIXEL)
+
+// DMA staging band for dirty rectangles - 1/10th of the screen per transfer
+#define FLUSH_BAND_PIXELS ((TFT_HOR_RES * TFT_VER_RES) / 10)
+#else
 // LVGL draw buffer size - allocated for 1/10th of the screen
 #define DRAW_BUF_SIZE                                                          \
 	(TFT_HOR_RES * TFT_VER_RES * BYTES_PER_PIXEL) /                            \
 		10 // buffer for 1/5 of the screen
+#endif
 
-// LVGL draw buffers (double buffering for smoother rendering)
+// LVGL draw buffers (double buffering for smoother rendering, single
+// persistent frame in direct mode)
 static unsigned char *lv_draw_buf_mem = nullptr;
+#if !DISPLAY_DIRECT_MODE
 static unsigned char *lv_draw_buf_mem2 = nullptr;
+#endif
 
 static const char *TAG = "DisplayManager";
 
+// Boot splash frame (UI/images/ui_img_boot_splash.c, squareline/gen_boot_splash.py)
+extern "C" {
+extern const uint16_t ui_img_boot_splash_width;
+extern const uint16_t ui_img_boot_splash_height;
+extern const uint32_t ui_img_boot_splash_rle_size;
+extern const uint8_t ui_img_boot_splash_rle[];
+}
+
 // Singleton instance pointer
 DisplayManager *DisplayManager::s_instance = nullptr;
 
@@ -40,90 +73,293 @@ extern "C" void my_disp_flush(lv_display_t *disp, const lv_area_t *area,
 	}
 }
 
+/**
+ * @brief Copy RGB565 pixels while swapping the byte order for the panel
+ * @param dst Destination pixels (may equal src for an in-place swap)
+ * @param src Source pixels
+ * @param pixels Number of pixels to copy
+ * @details Processes 2 pixels (one 32-bit word) per iteration when both
+ *          pointers share the same 4-byte alignment, 1 pixel otherwise
+ */
+static void copySwapRGB565(uint16_t *dst, const uint16_t *src, size_t pixels) {
+	// 32-bit path only if dst and src can be word-aligned together
+	if ((((uintptr_t)dst ^ (uintptr_t)src) & 2U) == 0) {
+		// Leading pixel to reach word alignment
+		if (((uintptr_t)src & 2U) && pixels > 0) {
+			*dst++ = lv_swap_bytes_16(*src++);
+			pixels--;
+		}
+
+		uint32_t *dst32 = reinterpret_cast<uint32_t *>(dst);
+		const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src);
+		const size_t words = pixels / 2;
+		for (size_t i = 0; i < words; i++) {
+			// Swap bytes in both pixels: AABB -> BBAA for each 16-bit word
+			uint32_t val = src32[i];
+			dst32[i] = ((val & 0x00FF00FF) << 8) | ((val & 0xFF00FF00) >> 8);
+		}
+
+		// Handle remaining pixel if odd count
+		if (pixels & 1UL) {
+			dst[pixels - 1] = lv_swap_bytes_16(src[pixels - 1]);
+		}
+		return;
+	}
+
+	for (size_t i = 0; i < pixels; i++) {
+		dst[i] = lv_swap_bytes_16(src[i]);
+	}
+}
+
 /**
  * @brief Flush screen buffer to display via DMA
- * @details Swaps byte order and pushes pixel data to the display using DMA
- *          Optimized: Uses 32-bit word swapping to reduce byte swap overhead
+ * @details Partial mode: swaps byte order in place and pushes the rendered band.
+ *          Direct mode: px_map is the persistent frame, only the dirty
+ *          rectangle is copied out and pushed (the frame itself stays in
+ *          LVGL byte order so later redraws can blend onto it).
  * @param disp LVGL display object
  * @param area Screen area to update
  * @param px_map Pixel data buffer
  */
 void DisplayManager::flushScreen(lv_display_t *disp, const lv_area_t *area,
 								 uint8_t *px_map) {
+	LV_PROFILER_BEGIN_TAG("flush_dma");
+	const int64_t flushStartUs = esp_timer_get_time();
+
 	// End any ongoing write operation
 	if (m_tft.getStartCount() == 0) {
 		m_tft.endWrite();
 	}
 
 	// Calculate area dimensions
-	const uint32_t w = lv_area_get_width(area);
-	const uint32_t h = lv_area_get_height(area);
+	[[maybe_unused]] const uint32_t w = lv_area_get_width(area);
+	[[maybe_unused]] const uint32_t h = lv_area_get_height(area);
 
+#if DISPLAY_DIRECT_MODE
+	flushDirtyArea(area, reinterpret_cast<const uint16_t *>(px_map));
+#else
 	// Prepare pixel buffer
 	uint16_t *src16 = reinterpret_cast<uint16_t *>(px_map);
 	const size_t pixels = (size_t)w * (size_t)h;
 
 	// Swap bytes for correct color display (RGB565 byte order)
-	// Optimized: Process 2 pixels (4 bytes) at once using 32-bit swaps
-	const size_t pixels_aligned = pixels & ~1UL;  // Align to even number
-	
-	for (size_t i = 0; i < pixels_aligned; i += 2) {
-		// Process 2 pixels at once (4 bytes = 1 uint32_t)
-		uint32_t *p32 = reinterpret_cast<uint32_t *>(&src16[i]);
-		uint32_t val = *p32;
-		
-		// Swap bytes in both pixels: AABB -> BBAA for each 16-bit word
-		uint32_t swapped = ((val & 0x00FF00FF) << 8) | ((val & 0xFF00FF00) >> 8);
-		*p32 = swapped;
-	}
-	
-	// Handle remaining pixel if odd count
-	if (pixels & 1UL) {
-		src16[pixels - 1] = lv_swap_bytes_16(src16[pixels - 1]);
-	}
+	copySwapRGB565(src16, src16, pixels);
 	
 	// Push image data to display via DMA
 	m_tft.pushImageDMA(area->x1, area->y1, w, h, src16);
+#endif
+
+#if DISPLAY_RENDER_BENCHMARK
+	m_stats.areas++;
+	m_stats.pixels += (uint64_t)w * h;
+	m_stats.flushTimeUs += esp_timer_get_time() - flushStartUs;
+#endif
+
+	LV_PROFILER_END_TAG("flush_dma");
+
+	// The last flush of a frame puts the readings applied before it on glass
+	LatencyTracker::instance().onFlush(flushStartUs, esp_timer_get_time(),
+									   lv_display_flush_is_last(disp));
 
 	// Notify LVGL that flushing is complete
 	lv_disp_flush_ready(disp);
 }
 
+#if DISPLAY_DIRECT_MODE
+/**
+ * @brief Push one dirty rectangle of the persistent frame to the panel
+ * @param area Dirty area (screen coordinates)
+ * @param frame Start of the full-screen frame buffer
+ * @details The rectangle rows are not contiguous in the frame (stride is the
+ *          full screen width), so they are gathered into a staging band.
+ *          pushImageDMA() waits for the previous transfer before starting,
+ *          which makes the other staging buffer free to fill meanwhile.
+ */
+void DisplayManager::flushDirtyArea(const lv_area_t *area, const uint16_t *frame) {
+	const uint32_t w = lv_area_get_width(area);
+	const uint32_t h = lv_area_get_height(area);
+	const uint32_t rowsPerBand = (w < FLUSH_BAND_PIXELS) ? FLUSH_BAND_PIXELS / w : 1;
+
+	const uint16_t *src = frame + (size_t)area->y1 * TFT_HOR_RES + area->x1;
+
+	for (uint32_t y = 0; y < h; y += rowsPerBand) {
+		const uint32_t rows = (h - y < rowsPerBand) ? (h - y) : rowsPerBand;
+		uint16_t *band = m_flushBand[m_flushBandIndex];
+		m_flushBandIndex ^= 1;
+
+		// Gather rows of the rectangle into the staging band
+		uint16_t *dst = band;
+		for (uint32_t row = 0; row < rows; row++) {
+			copySwapRGB565(dst, src, w);
+			dst += w;
+			src += TFT_HOR_RES;
+		}
+
+		m_tft.pushImageDMA(area->x1, area->y1 + y, w, rows, band);
+	}
+}
+#endif
+
+/**
+ * @brief Draw the pre-rendered boot splash directly to the panel
+ * @details RLE format of squareline/compress_images.py with 2-byte blocks:
+ *          a control byte with bit 7 set is followed by (ctrl & 0x7F) literal
+ *          pixels, otherwise the next pixel is repeated ctrl times. The pixels
+ *          are stored in panel byte order, so they are pushed unchanged.
+ *          Runs may span band boundaries, the decoder state carries over.
+ */
+void DisplayManager::drawBootSplash() {
+	const uint32_t width = ui_img_boot_splash_width;
+	const uint32_t height = ui_img_boot_splash_height;
+	const uint32_t bandPixels = width * BOOT_SPLASH_BAND_ROWS;
+
+	uint16_t *band = (uint16_t *)heap_caps_malloc(bandPixels * BYTES_PER_PIXEL,
+												   MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+	if (!band) {
+		ESP_LOGE(TAG, "Failed to allocate boot splash band");
+		return;
+	}
+
+	const uint8_t *in = ui_img_boot_splash_rle;
+	const uint8_t *const end = in + ui_img_boot_splash_rle_size;
+	uint32_t runLeft = 0;       // Pixels left in the current run
+	bool literal = false;       // Current run copies pixels instead of repeating one
+	uint16_t repeat = 0;        // Pixel of the current repeat run
+
+	for (uint32_t y = 0; y < height; y += BOOT_SPLASH_BAND_ROWS) {
+		const uint32_t rows = (height - y < BOOT_SPLASH_BAND_ROWS) ? height - y : BOOT_SPLASH_BAND_ROWS;
+		uint8_t *out = reinterpret_cast<uint8_t *>(band);
+		uint32_t left = width * rows;
+
+		while (left > 0) {
+			if (runLeft == 0) {
+				if (in >= end) {
+					ESP_LOGE(TAG, "Boot splash data truncated");
+					heap_caps_free(band);
+					return;
+				}
+				const uint8_t ctrl = *in++;
+				literal = (ctrl & 0x80) != 0;
+				runLeft = ctrl & 0x7F;
+				if (!literal) {
+					memcpy(&repeat, in, sizeof(repeat));
+					in += sizeof(repeat);
+				}
+				continue;
+			}
+
+			const uint32_t n = (runLeft < left) ? runLeft : left;
+			if (literal) {
+				memcpy(out, in, n * sizeof(uint16_t));
+				in += n * sizeof(uint16_t);
+			} else {
+				uint16_t *out16 = reinterpret_cast<uint16_t *>(out);
+				for (uint32_t i = 0; i < n; i++) {
+					out16[i] = repeat;
+				}
+			}
+			out += n * sizeof(uint16_t);
+			runLeft -= n;
+			left -= n;
+		}
+
+		m_tft.pushImage(0, y, width, rows, band);
+	}
+
+	heap_caps_free(band);
+}
+
+/**
+ * @brief Display event callback marking the frame start for LatencyTracker
+ * @param e LVGL event (LV_EVENT_RENDER_START)
+ */
+void DisplayManager::latencyRenderStartCallback(lv_event_t *e) {
+	LatencyTracker::instance().onRenderStart();
+}
+
+#if DISPLAY_RENDER_BENCHMARK
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+/**
+ * @brief Log hit rate and memory of LVGL's arc coverage cache (battery gauges)
+ */
+static void logArcCacheStats() {
+	lv_draw_sw_arc_cache_stats_t stats;
+	lv_draw_sw_arc_cache_get_stats(&stats);
+	const uint32_t lookups = stats.hits + stats.misses;
+	ESP_LOGI(TAG, "Arc cache: %lu hits, %lu misses (%.1f%% hit rate), %lu too large, "
+			 "%lu evictions, %lu arcs in %lu/%u bytes",
+			 stats.hits, stats.misses,
+			 lookups ? 100.0 * stats.hits / lookups : 0.0,
+			 stats.bypasses, stats.evictions, stats.entry_cnt, stats.size,
+			 (unsigned)LV_DRAW_SW_ARC_CACHE_SIZE);
+}
+#endif
+
+/**
+ * @brief Collect render timing and log statistics every STATS_PERIOD_MS
+ * @param e LVGL display event (LV_EVENT_RENDER_START / LV_EVENT_RENDER_READY)
+ * @details A refresh spans from RENDER_START to RENDER_READY and includes
+ *          all render passes and flushes for the invalidated areas. Logs are
+ *          comparable between partial and direct builds of the same screens.
+ */
+void DisplayManager::renderStatsEventCallback(lv_event_t *e) {
+	DisplayManager *self = static_cast<DisplayManager *>(lv_event_get_user_data(e));
+	RenderStats &stats = self->m_stats;
+	const int64_t now = esp_timer_get_time();
+
+	if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+		stats.renderStartUs = now;
+		return;
+	}
+
+	const uint32_t renderTimeUs = static_cast<uint32_t>(now - stats.renderStartUs);
+	stats.refreshes++;
+	stats.renderTimeUs += renderTimeUs;
+	if (renderTimeUs > stats.maxRenderTimeUs) {
+		stats.maxRenderTimeUs = renderTimeUs;
+	}
+
+	if (now - stats.periodStartUs < (int64_t)STATS_PERIOD_MS * 1000) {
+		return;
+	}
+
+	if (stats.refreshes > 0) {
+		ESP_LOGI(TAG, "Render stats (%s): %lu refreshes, avg %lu us (max %lu us), "
+				 "flush %lu us/refresh, %.1f areas/refresh, %lu px/refresh",
+				 DISPLAY_DIRECT_MODE ? "direct" : "partial",
+				 stats.refreshes,
+				 (uint32_t)(stats.renderTimeUs / stats.refreshes),
+				 stats.maxRenderTimeUs,
+				 (uint32_t)(stats.flushTimeUs / stats.refreshes),
+				 (double)stats.areas / stats.refreshes,
+				 (uint32_t)(stats.pixels / stats.refreshes));
+	}
+	ImageCache::instance().logStats();
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+	logArcCacheStats();
+#endif
+
+	stats = RenderStats();
+	stats.periodStartUs = now;
+}
+#endif
+
 /**
  * @brief Initialize display hardware and LVGL library
- * @details Sets up PWM backlight control, initializes TFT display driver,
- *          allocates LVGL draw buffers, and initializes UI
+ * @details Sets up the backlight, initializes TFT display driver, draws the
+ *          boot splash and turns the backlight on, then allocates LVGL draw
+ *          buffers and initializes UI. LVGL's first frame of the splash screen
+ *          only adds the version label and spinner to the boot splash.
  */
 void DisplayManager::init() {
     // Set singleton instance pointer
     DisplayManager::s_instance = this;
+
+	BootTimeline &boot = BootTimeline::instance();
+	boot.begin(BootTimeline::Phase::PanelInit);
 	
-	// Configure LEDC timer for PWM backlight control
-	ledc_timer_config_t ledc_timer = {
-		.speed_mode = LEDC_LOW_SPEED_MODE,
-		.duty_resolution = static_cast<ledc_timer_bit_t>(BACKLIGHT_RESOLUTION),
-		.timer_num = LEDC_TIMER_0,
-		.freq_hz = BACKLIGHT_FREQ,
-		.clk_cfg = LEDC_AUTO_CLK,
-		.deconfigure = false
-	};
-	ESP_ERROR_CHECK(ledc_timer_config(&ledc_timer));
-	
-	// Configure LEDC channel for backlight pin
-	ledc_channel_config_t ledc_channel = {
-		.gpio_num = BACKLIGHT_PIN,
-		.speed_mode = LEDC_LOW_SPEED_MODE,
-		.channel = static_cast<ledc_channel_t>(BACKLIGHT_CHANNEL),
-		.intr_type = LEDC_INTR_DISABLE,
-		.timer_sel = LEDC_TIMER_0,
-		.duty = 0,
-		.hpoint = 0,
-		.flags = {}
-	};
-	ESP_ERROR_CHECK(ledc_channel_config(&ledc_channel));
-	
-	// Set initial brightness to maximum (100%)
-	setBacklightBrightness(100);
+	// Backlight PWM and fade service, off until the boot splash is on the panel
+	BacklightController::instance().init();
 	
     // Initialize TFT display driver
     if (!m_tft.init()) {
@@ -144,6 +380,16 @@ void DisplayManager::init() {
         ESP_LOGW(TAG, "Skipping initDMA because panel is null");
     }
 
+	boot.mark(BootTimeline::Phase::PanelInit);
+
+	// Logo on screen before LVGL, NVS and BLE are up
+	boot.begin(BootTimeline::Phase::BootSplash);
+	drawBootSplash();
+	BacklightController::instance().fadeIn(0);
+	boot.mark(BootTimeline::Phase::BootSplash);
+
+	boot.begin(BootTimeline::Phase::LvglInit);
+
     // Start write transaction and clear screen
     m_tft.startWrite();
     m_tft.setColor(0, 0, 0);
@@ -151,6 +397,31 @@ void DisplayManager::init() {
     // Initialize LVGL library
     lv_init();
 
+	// Profiler on esp_timer ticks with a ring buffer (UI_PROFILER builds only)
+	Profiler::instance().init();
+
+	// Decoder/allocator hooks for the compressed images (before any image is used)
+	ImageCache::instance().init();
+
+#if DISPLAY_DIRECT_MODE
+	// Allocate the persistent frame (LVGL-only access, no DMA capability needed)
+	lv_draw_buf_mem = (unsigned char *)heap_caps_malloc(
+		DRAW_BUF_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (!lv_draw_buf_mem) {
+		ESP_LOGE(TAG, "Failed to allocate LVGL frame buffer");
+		return;
+	}
+
+	// Allocate the two DMA staging bands used to push dirty rectangles
+	for (auto &band : m_flushBand) {
+		band = (uint16_t *)heap_caps_malloc(
+			FLUSH_BAND_PIXELS * BYTES_PER_PIXEL, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+		if (!band) {
+			ESP_LOGE(TAG, "Failed to allocate flush staging buffer");
+			return;
+		}
+	}
+#else
 	// Allocate first LVGL draw buffer (DMA capable memory)
 	lv_draw_buf_mem = (unsigned char *)heap_caps_malloc(
 		DRAW_BUF_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
@@ -166,39 +437,39 @@ void DisplayManager::init() {
 		ESP_LOGE(TAG, "Failed to allocate LVGL draw buffer");
 		return;
 	}
+#endif
 
 	// Create LVGL display object and configure buffers
 	lv_display_t *disp;
 	disp = lv_display_create(TFT_HOR_RES, TFT_VER_RES);
 	lv_display_set_flush_cb(disp, my_disp_flush);
+#if DISPLAY_DIRECT_MODE
+	lv_display_set_buffers(disp, lv_draw_buf_mem, nullptr,
+						   DRAW_BUF_SIZE, LV_DISPLAY_RENDER_MODE_DIRECT);
+#else
 	lv_display_set_buffers(disp, lv_draw_buf_mem, lv_draw_buf_mem2,
 						   DRAW_BUF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+#endif
+
+	// Sensor-to-pixel latency: readings applied before a frame wait for its end
+	lv_display_add_event_cb(disp, latencyRenderStartCallback, LV_EVENT_RENDER_START, nullptr);
 
-	// Initialize SquareLine Studio generated UI
+#if DISPLAY_RENDER_BENCHMARK
+	// Time every refresh for partial vs. direct mode comparison
+	m_stats.periodStartUs = esp_timer_get_time();
+	lv_display_add_event_cb(disp, renderStatsEventCallback, LV_EVENT_RENDER_START, this);
+	lv_display_add_event_cb(disp, renderStatsEventCallback, LV_EVENT_RENDER_READY, this);
+#endif
+	boot.mark(BootTimeline::Phase::LvglInit);
+
+	// Initialize SquareLine Studio generated UI (theme only, screens are created on demand)
+	boot.begin(BootTimeline::Phase::UiReady);
 	ui_init();
+	lv_screen_load(UIController::instance().createScreen(UIController::Screen::Splash));
+
+	// The splash logo is only shown once, free its decoded copy afterwards
+	ImageCache::instance().dropOnUnload(ui_Splash, &ui_img_942102620);
+	boot.mark(BootTimeline::Phase::UiReady);
 
 	ESP_LOGI(TAG, "Display setup done");
 }
-
-/**
- * @brief Set display backlight brightness via PWM
- * @param brightness Brightness level in percentage (0-100%)
- */
-void DisplayManager::setBacklightBrightness(uint8_t brightness) {
-	// Clamp brightness to valid range (0-100%)
-	if (brightness > 100) {
-		brightness = 100;
-	}
-	
-	// Convert percentage to duty cycle (0-255 for 8-bit resolution)
-	uint32_t duty = (brightness * 255) / 100;
-	
-	// Update PWM duty cycle for backlight control
-	ESP_ERROR_CHECK(ledc_set_duty(LEDC_LOW_SPEED_MODE, 
-	                               static_cast<ledc_channel_t>(BACKLIGHT_CHANNEL), 
-	                               duty));
-	ESP_ERROR_CHECK(ledc_update_duty(LEDC_LOW_SPEED_MODE, 
-	                                  static_cast<ledc_channel_t>(BACKLIGHT_CHANNEL)));
-	
-	ESP_LOGI(TAG, "Backlight brightness set to %d%% (duty: %lu/255)", brightness, duty);
-}
\ No newline at end of file
@@ -2,14 +2,29 @@
 
 #include "LGFX_driver.h"
 
+#ifndef DISPLAY_DIRECT_MODE
+#define DISPLAY_DIRECT_MODE 0       ///< 1 = persistent full frame, dirty-rectangle flush
+#endif
+
+#ifndef DISPLAY_RENDER_BENCHMARK
+#define DISPLAY_RENDER_BENCHMARK 0  ///< 1 = log render/flush statistics periodically
+#endif
+
 /**
  * @class DisplayManager
  * @brief Manages LCD display initialization and rendering
  * @details Singleton class that handles:
  *          - TFT display initialization via LovyanGFX
+ *          - Boot splash drawn straight to the panel before LVGL starts
  *          - LVGL integration and buffer management
- *          - PWM backlight control
+ *          - Backlight initialization (see BacklightController)
  *          - Display flush operations for LVGL
+ *
+ * Render modes (selected at build time with DISPLAY_DIRECT_MODE):
+ * - Partial (default): two 1/10-screen buffers, large invalidations are
+ *   rendered and flushed in several bands
+ * - Direct: one persistent 240x240 RGB565 frame, LVGL redraws only the
+ *   invalidated areas into it and only those dirty rectangles go to the panel
  */
 class DisplayManager {
 public:
@@ -37,12 +52,6 @@ public:
 		}
 		return s_instance;
 	}
-	
-	/**
-	 * @brief Set display backlight brightness
-	 * @param brightness Brightness percentage (0-100)
-	 */
-	void setBacklightBrightness(uint8_t brightness);
 
 private:
 	DisplayManager() = default;
@@ -52,12 +61,64 @@ private:
 	DisplayManager(const DisplayManager&) = delete;
 	DisplayManager& operator=(const DisplayManager&) = delete;
 
+	/**
+	 * @brief Draw the pre-rendered boot splash directly to the panel
+	 * @details Runs right after the panel is initialized, before lv_init().
+	 *          The frame (ui_img_boot_splash, see squareline/gen_boot_splash.py)
+	 *          is RLE-decoded band by band from flash and pushed with
+	 *          pushImage(). Only BOOT_SPLASH_BAND_ROWS rows are buffered.
+	 */
+	void drawBootSplash();
+
+	/**
+	 * @brief Push one dirty rectangle of the persistent frame to the panel
+	 * @param area Dirty area (screen coordinates)
+	 * @param frame Start of the full-screen frame buffer
+	 * @details Copies the rectangle row band by row band into a DMA staging
+	 *          buffer (byte-swapping on the way) and alternates between two
+	 *          staging buffers so copying overlaps the previous DMA transfer
+	 */
+	void flushDirtyArea(const lv_area_t *area, const uint16_t *frame);
+
+	/**
+	 * @brief Display event callback marking the frame start for LatencyTracker
+	 * @param e LVGL event (LV_EVENT_RENDER_START)
+	 */
+	static void latencyRenderStartCallback(lv_event_t *e);
+
+#if DISPLAY_RENDER_BENCHMARK
+	/**
+	 * @brief Display event callback collecting render timing statistics
+	 * @param e LVGL event (LV_EVENT_RENDER_START / LV_EVENT_RENDER_READY)
+	 */
+	static void renderStatsEventCallback(lv_event_t *e);
+
+	/**
+	 * @struct RenderStats
+	 * @brief Render/flush counters, logged and reset every STATS_PERIOD_MS
+	 */
+	struct RenderStats {
+		uint32_t refreshes = 0;      ///< Refreshes with at least one dirty area
+		uint32_t areas = 0;          ///< Flushed areas (flush_cb calls)
+		uint64_t pixels = 0;         ///< Pixels pushed to the panel
+		uint64_t renderTimeUs = 0;   ///< Total render + flush time
+		uint32_t maxRenderTimeUs = 0;///< Slowest single refresh
+		uint64_t flushTimeUs = 0;    ///< Time spent inside flushScreen
+		int64_t renderStartUs = 0;   ///< Start of the refresh in progress
+		int64_t periodStartUs = 0;   ///< Start of the current statistics period
+	};
+	RenderStats m_stats;             ///< Benchmark counters
+
+	static constexpr uint32_t STATS_PERIOD_MS = 5000;  ///< Statistics log period
+#endif
+
+	static constexpr uint32_t BOOT_SPLASH_BAND_ROWS = 24;  ///< Rows decoded per boot splash push
+
 	LGFX_driver m_tft;                      ///< LovyanGFX display driver instance
 	static DisplayManager *s_instance;      ///< Singleton instance pointer
 
-	// PWM backlight configuration constants
-	static constexpr int BACKLIGHT_PIN = 3;           ///< GPIO pin for backlight control
-	static constexpr int BACKLIGHT_CHANNEL = 0;       ///< LEDC channel number
-	static constexpr int BACKLIGHT_FREQ = 5000;       ///< PWM frequency (5 kHz)
-	static constexpr int BACKLIGHT_RESOLUTION = 8;    ///< PWM resolution (8-bit: 0-255)
+#if DISPLAY_DIRECT_MODE
+	uint16_t *m_flushBand[2] = {nullptr, nullptr};  ///< DMA staging buffers for dirty rectangles
+	uint8_t m_flushBandIndex = 0;                   ///< Staging buffer to fill next
+#endif
 };
\ No newline at end of file
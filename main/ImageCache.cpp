@@ -0,0 +1,181 @@
+/**
+ * @file ImageCache.cpp
+ * @brief Decoded image cache implementation
+ * @details Wraps LVGL's bin decoder for compressed images to count image
+ *          cache hits and misses, and moves decoded image buffers to the
+ *          system heap.
+ */
+
+// Benchmark builds log the cache statistics at INFO. The committed sdkconfig
+// compiles out everything below ERROR, so this file keeps its INFO lines then.
+#if defined(DISPLAY_RENDER_BENCHMARK) && DISPLAY_RENDER_BENCHMARK
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+#endif
+
+#include "ImageCache.h"
+#include "src/draw/lv_draw_buf_private.h"
+#include "src/draw/lv_image_decoder_private.h"
+#include "src/misc/cache/instance/lv_image_cache.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "ImageCache";
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the ImageCache singleton
+ */
+ImageCache &ImageCache::instance() {
+	static ImageCache instance;
+	return instance;
+}
+
+/**
+ * @brief Install the decoder and allocator hooks
+ * @details Decoders are tried newest first, so the wrapper created here sees
+ *          every image before the bin decoder. It only accepts compressed
+ *          images; everything else falls through to the bin decoder.
+ *          The remaining image cache draw buffer handlers (alignment, stride)
+ *          keep their defaults.
+ */
+void ImageCache::init() {
+	lv_draw_buf_handlers_t *handlers = lv_draw_buf_get_image_handlers();
+	handlers->buf_malloc_cb = bufMalloc;
+	handlers->buf_free_cb = bufFree;
+
+	lv_image_decoder_t *decoder = lv_image_decoder_create();
+	if (decoder == nullptr) {
+		ESP_LOGE(TAG, "Failed to create image decoder");
+		return;
+	}
+	lv_image_decoder_set_info_cb(decoder, infoCallback);
+	lv_image_decoder_set_open_cb(decoder, openCallback);
+	lv_image_decoder_set_get_area_cb(decoder, lv_bin_decoder_get_area);
+	lv_image_decoder_set_close_cb(decoder, closeCallback);
+
+	ESP_LOGI(TAG, "Image cache: %d bytes", LV_CACHE_DEF_SIZE);
+}
+
+/**
+ * @brief Drop an image from the cache once a screen is unloaded
+ * @param screen Screen showing the image
+ * @param src Image to drop
+ * @details LV_EVENT_SCREEN_UNLOADED arrives after the screen load animation,
+ *          so the image is still cached while it fades out.
+ */
+void ImageCache::dropOnUnload(lv_obj_t *screen, const void *src) {
+	lv_obj_add_event_cb(screen, screenUnloadedCallback, LV_EVENT_SCREEN_UNLOADED,
+						const_cast<void *>(src));
+}
+
+/**
+ * @brief Drop the image registered with dropOnUnload()
+ * @param e LVGL event (SCREEN_UNLOADED), user data is the image source
+ */
+void ImageCache::screenUnloadedCallback(lv_event_t *e) {
+	const void *src = lv_event_get_user_data(e);
+	lv_image_cache_drop(src);
+	ESP_LOGI(TAG, "Dropped %p from image cache, %lu bytes resident",
+			 src, instance().m_stats.residentBytes);
+}
+
+/**
+ * @brief Get cache counters
+ * @return Counters since init()
+ * @details Every successful open is closed again, on a hit as well as on a
+ *          miss, so hits are the closes that did not follow a decompression.
+ */
+ImageCache::Stats ImageCache::getStats() const {
+	Stats stats = m_stats;
+	stats.hits = m_closes > stats.misses ? m_closes - stats.misses : 0;
+	return stats;
+}
+
+/**
+ * @brief Log hit rate, decode cost and resident memory
+ */
+void ImageCache::logStats() const {
+	const Stats stats = getStats();
+	const uint32_t lookups = stats.hits + stats.misses;
+	ESP_LOGI(TAG, "Image cache: %lu hits, %lu misses (%.1f%% hit rate), "
+			 "decode avg %lu us (max %lu us), %lu bytes resident",
+			 stats.hits, stats.misses,
+			 lookups ? 100.0 * stats.hits / lookups : 0.0,
+			 stats.misses ? (uint32_t)(stats.decodeTimeUs / stats.misses) : 0,
+			 stats.maxDecodeTimeUs, stats.residentBytes);
+}
+
+/**
+ * @brief Accept compressed C-array images only
+ * @return LV_RESULT_OK for compressed images, LV_RESULT_INVALID otherwise
+ *         (the next decoder in the list is tried)
+ */
+lv_result_t ImageCache::infoCallback(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc,
+									 lv_image_header_t *header) {
+	if (dsc->src_type != LV_IMAGE_SRC_VARIABLE) {
+		return LV_RESULT_INVALID;
+	}
+	const lv_image_dsc_t *image = static_cast<const lv_image_dsc_t *>(dsc->src);
+	if (!(image->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) {
+		return LV_RESULT_INVALID;
+	}
+	return lv_bin_decoder_info(decoder, dsc, header);
+}
+
+/**
+ * @brief Decompress an image that is not in the cache (cache miss)
+ * @details Hits are served by lv_image_decoder_open() from the cache without
+ *          calling the decoder.
+ */
+lv_result_t ImageCache::openCallback(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+	const int64_t startUs = esp_timer_get_time();
+	const lv_result_t res = lv_bin_decoder_open(decoder, dsc);
+	const uint32_t decodeUs = static_cast<uint32_t>(esp_timer_get_time() - startUs);
+
+	Stats &stats = instance().m_stats;
+	stats.misses++;
+	stats.decodeTimeUs += decodeUs;
+	if (decodeUs > stats.maxDecodeTimeUs) {
+		stats.maxDecodeTimeUs = decodeUs;
+	}
+	if (res != LV_RESULT_OK) {
+		ESP_LOGE(TAG, "Failed to decode %p", dsc->src);
+	}
+	return res;
+}
+
+/**
+ * @brief Release a decoded image (after a hit or a miss)
+ */
+void ImageCache::closeCallback(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+	instance().m_closes++;
+	lv_bin_decoder_close(decoder, dsc);
+}
+
+/**
+ * @brief Allocate a decoded image buffer from the system heap
+ * @param size Buffer size in bytes
+ * @param cf Color format (unused)
+ * @return Buffer with room for LV_DRAW_BUF_ALIGN alignment, or nullptr
+ */
+void *ImageCache::bufMalloc(size_t size, lv_color_format_t cf) {
+	(void)cf;
+	void *buf = heap_caps_malloc(size + LV_DRAW_BUF_ALIGN - 1, MALLOC_CAP_8BIT);
+	if (buf != nullptr) {
+		instance().m_stats.residentBytes += heap_caps_get_allocated_size(buf);
+	}
+	return buf;
+}
+
+/**
+ * @brief Free a decoded image buffer
+ * @param buf Buffer returned by bufMalloc()
+ */
+void ImageCache::bufFree(void *buf) {
+	if (buf == nullptr) {
+		return;
+	}
+	instance().m_stats.residentBytes -= heap_caps_get_allocated_size(buf);
+	heap_caps_free(buf);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file ImageCache.h
+ * @brief Decoded image cache for the RLE-compressed UI images
+ * @details The SquareLine images are stored RLE-compressed in flash (see
+ *          squareline/compress_images.py). LVGL's bin decoder decompresses
+ *          an image on first use and keeps the result in the image cache
+ *          (LV_CACHE_DEF_SIZE), so later draws reuse the decoded pixels.
+ */
+
+#pragma once
+
+#include "lvgl.h"
+#include <cstdint>
+
+/**
+ * @class ImageCache
+ * @brief Instrumented decoder front-end and allocator for decoded images
+ * @details Singleton that:
+ *          - Registers a decoder for compressed images in front of LVGL's bin
+ *            decoder, delegating to it and counting cache hits/misses and
+ *            decompression time
+ *          - Allocates decoded images from the system heap instead of the
+ *            64 KB LVGL heap (the splash logo alone decodes to 52 KB)
+ *          - Drops images from the cache when the screen showing them is
+ *            unloaded (splash logo)
+ *
+ *          Uncompressed images are drawn directly from flash and never reach
+ *          this decoder.
+ */
+class ImageCache {
+public:
+	/**
+	 * @struct Stats
+	 * @brief Cache counters since init()
+	 */
+	struct Stats {
+		uint32_t hits = 0;           ///< Decoder opens served from the cache
+		uint32_t misses = 0;         ///< Decoder opens that had to decompress
+		uint64_t decodeTimeUs = 0;   ///< Total decompression time
+		uint32_t maxDecodeTimeUs = 0;///< Slowest single decompression
+		uint32_t residentBytes = 0;  ///< Decoded image memory currently allocated
+	};
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the ImageCache singleton
+	 */
+	static ImageCache &instance();
+
+	/**
+	 * @brief Install the decoder and allocator hooks
+	 * @details Call after lv_init() and before any image is created
+	 */
+	void init();
+
+	/**
+	 * @brief Drop an image from the cache once a screen is unloaded
+	 * @param screen Screen showing the image
+	 * @param src Image to drop (e.g. a one-time splash logo)
+	 */
+	void dropOnUnload(lv_obj_t *screen, const void *src);
+
+	/**
+	 * @brief Get cache counters
+	 * @return Counters since init()
+	 */
+	Stats getStats() const;
+
+	/**
+	 * @brief Log hit rate, decode cost and resident memory
+	 */
+	void logStats() const;
+
+private:
+	ImageCache() = default;
+	~ImageCache() = default;
+
+	ImageCache(const ImageCache &) = delete;
+	ImageCache &operator=(const ImageCache &) = delete;
+
+	// Decoder callbacks (delegate to the bin decoder)
+	static lv_result_t infoCallback(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc,
+									lv_image_header_t *header);
+	static lv_result_t openCallback(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc);
+	static void closeCallback(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc);
+
+	// Decoded image allocator
+	static void *bufMalloc(size_t size, lv_color_format_t cf);
+	static void bufFree(void *buf);
+
+	static void screenUnloadedCallback(lv_event_t *e);
+
+	Stats m_stats;                  ///< Cache counters (hits derived from m_closes)
+	uint32_t m_closes = 0;          ///< Decoder closes, one per successful open
+};
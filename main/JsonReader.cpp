@@ -0,0 +1,394 @@
+/**
+ * @file JsonReader.cpp
+ * @brief Incremental, bounded JSON object parser implementation
+ */
+
+#include "JsonReader.h"
+#include <cstring>
+
+/**
+ * @brief Check for JSON whitespace
+ * @param c Byte
+ * @return true for space, tab, CR, LF
+ */
+static bool isSpace(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/**
+ * @brief Check a complete number against the JSON grammar
+ * @param text Number text
+ * @return true for -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ */
+static bool isJsonNumber(const char *text) {
+	const char *p = text;
+	if (*p == '-') {
+		p++;
+	}
+	if (*p == '0') {
+		p++;
+	} else if (*p >= '1' && *p <= '9') {
+		while (*p >= '0' && *p <= '9') {
+			p++;
+		}
+	} else {
+		return false;
+	}
+	if (*p == '.') {
+		p++;
+		if (*p < '0' || *p > '9') {
+			return false;
+		}
+		while (*p >= '0' && *p <= '9') {
+			p++;
+		}
+	}
+	if (*p == 'e' || *p == 'E') {
+		p++;
+		if (*p == '+' || *p == '-') {
+			p++;
+		}
+		if (*p < '0' || *p > '9') {
+			return false;
+		}
+		while (*p >= '0' && *p <= '9') {
+			p++;
+		}
+	}
+	return *p == '\0';
+}
+
+/**
+ * @brief Value of a hex digit
+ * @param c Byte
+ * @return 0-15, -1 if c is no hex digit
+ */
+static int hexValue(char c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+	if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+	if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	}
+	return -1;
+}
+
+/**
+ * @brief Constructor
+ * @param handler Called for every member
+ * @param ctx Passed to handler
+ */
+JsonReader::JsonReader(Handler handler, void *ctx)
+	: m_handler(handler), m_ctx(ctx) {
+	m_key[0] = '\0';
+	m_value[0] = '\0';
+}
+
+/**
+ * @brief Parse the next piece of the document
+ * @param data Bytes
+ * @param len Number of bytes
+ * @return false on a syntax error, an overflow or a rejected member
+ */
+bool JsonReader::feed(const char *data, size_t len) {
+	for (size_t i = 0; i < len; i++) {
+		if (m_state == State::Error || !step(data[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief End of input
+ * @return true if exactly one complete object was read
+ */
+bool JsonReader::finish() {
+	if (m_state == State::Error) {
+		return false;
+	}
+	if (m_state != State::Done) {
+		return fail("unexpected end of input");
+	}
+	return true;
+}
+
+/**
+ * @brief Process one byte
+ * @param c Byte
+ * @return false on error
+ */
+bool JsonReader::step(char c) {
+	if (m_inString) {
+		return stringStep(c);
+	}
+	if (m_inLiteral) {
+		if (!isSpace(c) && c != ',' && c != '}') {
+			return append(c);
+		}
+		if (!endLiteral()) {
+			return false;
+		}
+		// The terminator is handled below in state CommaOrEnd
+	}
+	if (isSpace(c)) {
+		return true;
+	}
+
+	switch (m_state) {
+	case State::Start:
+		if (c != '{') {
+			return fail("expected '{'");
+		}
+		m_state = State::KeyOrEnd;
+		return true;
+
+	case State::KeyOrEnd:
+		if (c == '}') {
+			m_state = State::Done;
+			return true;
+		}
+		// fall through
+	case State::Key:
+		if (c != '"') {
+			return fail("expected key");
+		}
+		m_inString = true;
+		m_readingKey = true;
+		m_len = 0;
+		return true;
+
+	case State::Colon:
+		if (c != ':') {
+			return fail("expected ':'");
+		}
+		m_state = State::Value;
+		return true;
+
+	case State::Value:
+		m_len = 0;
+		if (c == '"') {
+			m_inString = true;
+			m_readingKey = false;
+			return true;
+		}
+		if (c == '{' || c == '[') {
+			return fail("nested values not supported");
+		}
+		if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+			m_inLiteral = true;
+			return append(c);
+		}
+		return fail("expected value");
+
+	case State::CommaOrEnd:
+		if (c == ',') {
+			m_state = State::Key;
+			return true;
+		}
+		if (c == '}') {
+			m_state = State::Done;
+			return true;
+		}
+		return fail("expected ',' or '}'");
+
+	case State::Done:
+		return fail("data after object");
+
+	case State::Error:
+		break;
+	}
+	return false;
+}
+
+/**
+ * @brief Process one byte inside a string (key or value)
+ * @param c Byte
+ * @return false on error
+ */
+bool JsonReader::stringStep(char c) {
+	if (m_escape == 1) {
+		m_escape = 0;
+		switch (c) {
+		case '"':
+		case '\\':
+		case '/':
+			break;
+		case 'b':
+			c = '\b';
+			break;
+		case 'f':
+			c = '\f';
+			break;
+		case 'n':
+			c = '\n';
+			break;
+		case 'r':
+			c = '\r';
+			break;
+		case 't':
+			c = '\t';
+			break;
+		case 'u':
+			m_escape = 2;
+			m_unicode = 0;
+			return true;
+		default:
+			return fail("invalid escape");
+		}
+		if (m_highSurrogate != 0) {
+			return fail("unpaired surrogate");
+		}
+		return append(c);
+	}
+
+	if (m_escape >= 2) {
+		const int digit = hexValue(c);
+		if (digit < 0) {
+			return fail("invalid \\u escape");
+		}
+		m_unicode = (m_unicode << 4) | static_cast<uint32_t>(digit);
+		if (++m_escape < 6) {
+			return true;
+		}
+		m_escape = 0;
+
+		if (m_unicode >= 0xD800 && m_unicode <= 0xDBFF) {
+			if (m_highSurrogate != 0) {
+				return fail("unpaired surrogate");
+			}
+			m_highSurrogate = m_unicode;
+			return true;
+		}
+		if (m_unicode >= 0xDC00 && m_unicode <= 0xDFFF) {
+			if (m_highSurrogate == 0) {
+				return fail("unpaired surrogate");
+			}
+			const uint32_t codePoint = 0x10000 + ((m_highSurrogate - 0xD800) << 10) + (m_unicode - 0xDC00);
+			m_highSurrogate = 0;
+			return appendCodePoint(codePoint);
+		}
+		if (m_highSurrogate != 0) {
+			return fail("unpaired surrogate");
+		}
+		return appendCodePoint(m_unicode);
+	}
+
+	if (m_highSurrogate != 0 && c != '\\') {
+		return fail("unpaired surrogate");
+	}
+	if (c == '\\') {
+		m_escape = 1;
+		return true;
+	}
+	if (static_cast<unsigned char>(c) < 0x20) {
+		return fail("control character in string");
+	}
+	if (c != '"') {
+		return append(c);
+	}
+
+	m_inString = false;
+	if (m_readingKey) {
+		m_key[m_len] = '\0';
+		m_state = State::Colon;
+		return true;
+	}
+	return emit(Type::String);
+}
+
+/**
+ * @brief Append UTF-8 of a code point to the current string
+ * @param codePoint Unicode scalar value
+ * @return false if the string is too long or the code point is NUL
+ */
+bool JsonReader::appendCodePoint(uint32_t codePoint) {
+	if (codePoint == 0) {
+		return fail("NUL in string");
+	}
+	if (codePoint < 0x80) {
+		return append(static_cast<char>(codePoint));
+	}
+	if (codePoint < 0x800) {
+		return append(static_cast<char>(0xC0 | (codePoint >> 6))) &&
+		       append(static_cast<char>(0x80 | (codePoint & 0x3F)));
+	}
+	if (codePoint < 0x10000) {
+		return append(static_cast<char>(0xE0 | (codePoint >> 12))) &&
+		       append(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F))) &&
+		       append(static_cast<char>(0x80 | (codePoint & 0x3F)));
+	}
+	return append(static_cast<char>(0xF0 | (codePoint >> 18))) &&
+	       append(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F))) &&
+	       append(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F))) &&
+	       append(static_cast<char>(0x80 | (codePoint & 0x3F)));
+}
+
+/**
+ * @brief Append a byte to the current key or value
+ * @param c Byte
+ * @return false if it is too long
+ */
+bool JsonReader::append(char c) {
+	if (m_readingKey && m_inString) {
+		if (m_len + 1 >= MAX_KEY) {
+			return fail("key too long");
+		}
+		m_key[m_len++] = c;
+		return true;
+	}
+	if (m_len + 1 >= MAX_VALUE) {
+		return fail("value too long");
+	}
+	m_value[m_len++] = c;
+	return true;
+}
+
+/**
+ * @brief A number or literal ended: check it and emit the member
+ * @return false on error
+ */
+bool JsonReader::endLiteral() {
+	m_inLiteral = false;
+	m_value[m_len] = '\0';
+	if (strcmp(m_value, "true") == 0 || strcmp(m_value, "false") == 0) {
+		return emit(Type::Bool);
+	}
+	if (strcmp(m_value, "null") == 0) {
+		return emit(Type::Null);
+	}
+	if (!isJsonNumber(m_value)) {
+		return fail("invalid literal");
+	}
+	return emit(Type::Number);
+}
+
+/**
+ * @brief Pass the completed member to the handler
+ * @param type Value type
+ * @return false if the handler rejected it
+ */
+bool JsonReader::emit(Type type) {
+	m_value[m_len] = '\0';
+	m_state = State::CommaOrEnd;
+	if (!m_handler(m_key, type, m_value, m_ctx)) {
+		return fail("invalid member");
+	}
+	return true;
+}
+
+/**
+ * @brief Stop with an error
+ * @param message Static description
+ * @return false
+ */
+bool JsonReader::fail(const char *message) {
+	if (m_state != State::Error) {
+		m_error = message;
+		m_state = State::Error;
+	}
+	return false;
+}
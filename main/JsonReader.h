@@ -0,0 +1,152 @@
+/**
+ * @file JsonReader.h
+ * @brief Incremental, bounded JSON object parser
+ * @details Parses one JSON object of scalar members (strings, numbers,
+ *          true/false, null) fed in arbitrary pieces, e.g. as they arrive from
+ *          httpd_req_recv(). Each member is passed to a handler once its value
+ *          is complete. Keys and values are bounded by fixed buffers, so the
+ *          parser needs no allocation and no copy of the whole body.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class JsonReader
+ * @brief Streaming parser for flat JSON objects
+ * @details Full JSON syntax for the object, its strings (all escapes,
+ *          including \\u surrogate pairs, decoded to UTF-8) and numbers.
+ *          Nested objects/arrays, keys longer than MAX_KEY - 1 and values
+ *          longer than MAX_VALUE - 1 bytes are rejected. The first error
+ *          stops parsing; error() describes it.
+ */
+class JsonReader {
+public:
+	static constexpr size_t MAX_KEY = 24;    ///< Key capacity including the terminator
+	static constexpr size_t MAX_VALUE = 48;  ///< Value capacity including the terminator
+
+	/**
+	 * @enum Type
+	 * @brief Type of a member value
+	 */
+	enum class Type : uint8_t {
+		String,  ///< Decoded text
+		Number,  ///< Number as written (valid JSON number, for strtod/strtol)
+		Bool,    ///< "true" or "false"
+		Null,    ///< "null"
+	};
+
+	/**
+	 * @brief Member callback
+	 * @param key Member name
+	 * @param type Value type
+	 * @param value Value text, see Type
+	 * @param ctx User context passed to the constructor
+	 * @return false to reject the member (parsing stops with an error)
+	 */
+	using Handler = bool (*)(const char *key, Type type, const char *value, void *ctx);
+
+	/**
+	 * @brief Constructor
+	 * @param handler Called for every member
+	 * @param ctx Passed to handler
+	 */
+	JsonReader(Handler handler, void *ctx);
+
+	/**
+	 * @brief Parse the next piece of the document
+	 * @param data Bytes
+	 * @param len Number of bytes
+	 * @return false on a syntax error, an overflow or a rejected member
+	 */
+	bool feed(const char *data, size_t len);
+
+	/**
+	 * @brief End of input
+	 * @return true if exactly one complete object was read
+	 */
+	bool finish();
+
+	/** @brief Description of the first error, "" if none */
+	const char *error() const { return m_error; }
+
+private:
+	/**
+	 * @enum State
+	 * @brief Position in the grammar
+	 */
+	enum class State : uint8_t {
+		Start,         ///< Before '{'
+		KeyOrEnd,      ///< After '{': key or '}'
+		Key,           ///< Before a key (after ',')
+		Colon,         ///< After a key
+		Value,         ///< After ':'
+		CommaOrEnd,    ///< After a value: ',' or '}'
+		Done,          ///< After '}'
+		Error,         ///< Stopped
+	};
+
+	/**
+	 * @brief Process one byte
+	 * @param c Byte
+	 * @return false on error
+	 */
+	bool step(char c);
+
+	/**
+	 * @brief Process one byte inside a string (key or value)
+	 * @param c Byte
+	 * @return false on error
+	 */
+	bool stringStep(char c);
+
+	/**
+	 * @brief Append UTF-8 of a code point to the current string
+	 * @param codePoint Unicode scalar value
+	 * @return false if the string is too long
+	 */
+	bool appendCodePoint(uint32_t codePoint);
+
+	/**
+	 * @brief Append a byte to the current key or value
+	 * @param c Byte
+	 * @return false if it is too long
+	 */
+	bool append(char c);
+
+	/**
+	 * @brief A number or literal ended: check it and emit the member
+	 * @return false on error
+	 */
+	bool endLiteral();
+
+	/**
+	 * @brief Pass the completed member to the handler
+	 * @param type Value type
+	 * @return false if the handler rejected it
+	 */
+	bool emit(Type type);
+
+	/**
+	 * @brief Stop with an error
+	 * @param message Static description
+	 * @return false
+	 */
+	bool fail(const char *message);
+
+	Handler m_handler;            ///< Member callback
+	void *m_ctx;                  ///< Handler context
+	State m_state = State::Start; ///< Grammar position
+	bool m_inString = false;      ///< Inside a key or string value
+	bool m_inLiteral = false;     ///< Inside a number or true/false/null
+	bool m_readingKey = false;    ///< The current string is a key
+	uint8_t m_escape = 0;         ///< 0 none, 1 after '\\', 2-5 hex digits of \\u read
+	uint32_t m_unicode = 0;       ///< \\u value being read
+	uint32_t m_highSurrogate = 0; ///< Pending high surrogate, 0 = none
+	char m_key[MAX_KEY];          ///< Current member name
+	char m_value[MAX_VALUE];      ///< Current value
+	size_t m_len = 0;             ///< Bytes in the current key or value
+	const char *m_error = "";     ///< First error
+};
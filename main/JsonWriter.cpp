@@ -0,0 +1,312 @@
+/**
+ * @file JsonWriter.cpp
+ * @brief Streaming JSON writer on a caller-provided buffer implementation
+ */
+
+#include "JsonWriter.h"
+#include <cmath>
+#include <cstring>
+
+/// Powers of ten for JsonWriter::value(float, int)
+static const int32_t POW10[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+/**
+ * @brief Format an unsigned integer
+ * @param out Output, at least 20 bytes
+ * @param number Value
+ * @return Number of digits written (no terminator)
+ */
+static size_t formatUnsigned(char *out, uint64_t number) {
+	char digits[20];
+	size_t n = 0;
+	do {
+		digits[n++] = static_cast<char>('0' + number % 10);
+		number /= 10;
+	} while (number != 0);
+	for (size_t i = 0; i < n; i++) {
+		out[i] = digits[n - 1 - i];
+	}
+	return n;
+}
+
+/**
+ * @brief Constructor
+ * @param buffer Output buffer
+ * @param size Size of buffer
+ * @param sink Output of full buffers, nullptr: the document stays in the buffer
+ * @param ctx Passed to sink
+ */
+JsonWriter::JsonWriter(char *buffer, size_t size, Sink sink, void *ctx)
+	: m_buffer(buffer), m_size(size), m_sink(sink), m_ctx(ctx) {
+}
+
+/**
+ * @brief Write the comma before a value or key, if one is needed
+ * @details Marks the current level as having an element
+ */
+void JsonWriter::separator() {
+	if (m_afterKey) {
+		m_afterKey = false;
+		return;
+	}
+	const uint16_t bit = 1U << m_depth;
+	if (m_depth > 0 && (m_filled & bit)) {
+		put(',');
+	}
+	m_filled |= bit;
+}
+
+/**
+ * @brief Open an object or array
+ * @param bracket '{' or '['
+ */
+JsonWriter &JsonWriter::open(char bracket) {
+	separator();
+	if (m_depth >= MAX_DEPTH) {
+		m_ok = false;
+		return *this;
+	}
+	put(bracket);
+	m_depth++;
+	m_filled &= ~(1U << m_depth);
+	return *this;
+}
+
+/**
+ * @brief Close an object or array
+ * @param bracket '}' or ']'
+ */
+JsonWriter &JsonWriter::close(char bracket) {
+	if (m_depth == 0 || m_afterKey) {
+		m_ok = false;
+		return *this;
+	}
+	m_depth--;
+	put(bracket);
+	return *this;
+}
+
+JsonWriter &JsonWriter::beginObject() {
+	return open('{');
+}
+
+JsonWriter &JsonWriter::endObject() {
+	return close('}');
+}
+
+JsonWriter &JsonWriter::beginArray() {
+	return open('[');
+}
+
+JsonWriter &JsonWriter::endArray() {
+	return close(']');
+}
+
+/**
+ * @brief Write an object member name
+ * @param name Member name
+ */
+JsonWriter &JsonWriter::key(const char *name) {
+	separator();
+	putString(name);
+	put(':');
+	m_afterKey = true;
+	return *this;
+}
+
+/**
+ * @brief Write a string value
+ * @param text UTF-8 text
+ */
+JsonWriter &JsonWriter::value(const char *text) {
+	separator();
+	putString(text);
+	return *this;
+}
+
+/**
+ * @brief Write an integer value
+ * @param number Value
+ */
+JsonWriter &JsonWriter::value(long number) {
+	separator();
+	char text[21];
+	size_t len = 0;
+	if (number < 0) {
+		text[len++] = '-';
+	}
+	const uint64_t magnitude = number < 0 ? 0 - static_cast<uint64_t>(number) : number;
+	len += formatUnsigned(text + len, magnitude);
+	put(text, len);
+	return *this;
+}
+
+/**
+ * @brief Write a number with a fixed number of decimals
+ * @param number Value
+ * @param decimals Digits after the point, 0-6
+ * @details Rounded half away from zero; values beyond the int64 range with
+ *          the given decimals are written as null
+ */
+JsonWriter &JsonWriter::value(float number, int decimals) {
+	if (decimals < 0) {
+		decimals = 0;
+	} else if (decimals > 6) {
+		decimals = 6;
+	}
+	const double scaled = std::round(static_cast<double>(number) * POW10[decimals]);
+	if (!std::isfinite(scaled) || std::fabs(scaled) >= 9.0e18) {
+		return null();
+	}
+
+	separator();
+	char text[32];
+	size_t len = 0;
+	const int64_t fixed = static_cast<int64_t>(scaled);
+	const uint64_t magnitude = fixed < 0 ? 0 - static_cast<uint64_t>(fixed) : fixed;
+	if (fixed < 0) {
+		text[len++] = '-';
+	}
+	len += formatUnsigned(text + len, magnitude / POW10[decimals]);
+	if (decimals > 0) {
+		text[len++] = '.';
+		uint64_t fraction = magnitude % POW10[decimals];
+		for (int i = decimals - 1; i >= 0; i--) {
+			text[len + i] = static_cast<char>('0' + fraction % 10);
+			fraction /= 10;
+		}
+		len += decimals;
+	}
+	put(text, len);
+	return *this;
+}
+
+/**
+ * @brief Write true or false
+ * @param flag Value
+ */
+JsonWriter &JsonWriter::value(bool flag) {
+	separator();
+	if (flag) {
+		put("true", 4);
+	} else {
+		put("false", 5);
+	}
+	return *this;
+}
+
+/**
+ * @brief Write null
+ */
+JsonWriter &JsonWriter::null() {
+	separator();
+	put("null", 4);
+	return *this;
+}
+
+/**
+ * @brief Write raw bytes as they are
+ * @param data Bytes
+ * @param len Number of bytes
+ */
+JsonWriter &JsonWriter::raw(const char *data, size_t len) {
+	put(data, len);
+	return *this;
+}
+
+/**
+ * @brief Hand the rest of the buffer to the sink and check the document
+ * @return true if everything was written and all objects/arrays are closed
+ */
+bool JsonWriter::finish() {
+	if (m_depth != 0 || m_afterKey) {
+		m_ok = false;
+	}
+	if (m_sink != nullptr) {
+		flush();
+	} else if (m_ok && m_len < m_size) {
+		m_buffer[m_len] = '\0';  // Usable as C string
+	}
+	return m_ok;
+}
+
+/**
+ * @brief Write an escaped, quoted string
+ * @param text UTF-8 text
+ * @details Runs of plain characters are copied in one put()
+ */
+void JsonWriter::putString(const char *text) {
+	put('"');
+	const char *run = text;
+	for (const char *p = text; *p != '\0'; p++) {
+		const unsigned char c = static_cast<unsigned char>(*p);
+		if (c != '"' && c != '\\' && c >= 0x20) {
+			continue;
+		}
+		put(run, p - run);
+		run = p + 1;
+
+		char escaped[6] = {'\\', static_cast<char>(c), 0, 0, 0, 0};
+		size_t len = 2;
+		switch (c) {
+		case '"':
+		case '\\':
+			break;
+		case '\n':
+			escaped[1] = 'n';
+			break;
+		case '\r':
+			escaped[1] = 'r';
+			break;
+		case '\t':
+			escaped[1] = 't';
+			break;
+		default:
+			static const char HEX[] = "0123456789abcdef";
+			escaped[1] = 'u';
+			escaped[2] = '0';
+			escaped[3] = '0';
+			escaped[4] = HEX[c >> 4];
+			escaped[5] = HEX[c & 0x0F];
+			len = 6;
+			break;
+		}
+		put(escaped, len);
+	}
+	put(run, strlen(run));
+	put('"');
+}
+
+/**
+ * @brief Append bytes, flushing to the sink when the buffer is full
+ * @param data Bytes
+ * @param len Number of bytes
+ * @details Without a sink, an overflow is an error and the document is cut
+ */
+void JsonWriter::put(const char *data, size_t len) {
+	while (len > 0 && m_ok) {
+		if (m_len == m_size) {
+			if (m_sink == nullptr) {
+				m_ok = false;
+				return;
+			}
+			flush();
+			continue;
+		}
+		const size_t n = len < m_size - m_len ? len : m_size - m_len;
+		memcpy(m_buffer + m_len, data, n);
+		m_len += n;
+		data += n;
+		len -= n;
+	}
+}
+
+/**
+ * @brief Hand the buffer content to the sink
+ */
+void JsonWriter::flush() {
+	if (m_len > 0 && m_ok && !m_sink(m_buffer, m_len, m_ctx)) {
+		m_ok = false;
+	}
+	m_len = 0;
+}
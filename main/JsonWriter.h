@@ -0,0 +1,149 @@
+/**
+ * @file JsonWriter.h
+ * @brief Streaming JSON writer on a caller-provided buffer
+ * @details Writes compact JSON into a fixed buffer. With a sink the buffer is
+ *          handed on whenever it is full (e.g. as HTTP chunks), so documents
+ *          of any size are written from a small stack buffer; without a sink
+ *          the document must fit. Nothing is allocated.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class JsonWriter
+ * @brief Zero-allocation JSON writer
+ * @details Commas and nesting are tracked by the writer; callers only emit
+ *          keys and values. Errors (sink failure, overflow without a sink,
+ *          unbalanced nesting) are sticky and reported by finish().
+ *
+ * @code
+ * char buf[128];
+ * JsonWriter json(buf, sizeof(buf), sendHttpChunk, req);
+ * json.beginObject().key("status").value("ok").endObject();
+ * json.finish();
+ * @endcode
+ */
+class JsonWriter {
+public:
+	/**
+	 * @brief Output of a full buffer
+	 * @param data Bytes to write
+	 * @param len Number of bytes
+	 * @param ctx User context passed to the constructor
+	 * @return false to abort writing
+	 */
+	using Sink = bool (*)(const char *data, size_t len, void *ctx);
+
+	static constexpr size_t MAX_DEPTH = 8;  ///< Nesting levels of objects and arrays
+
+	/**
+	 * @brief Constructor
+	 * @param buffer Output buffer
+	 * @param size Size of buffer (at least 8 bytes with a sink)
+	 * @param sink Called with the buffer content when it is full and by
+	 *             finish(); nullptr: the document stays in the buffer
+	 * @param ctx Passed to sink
+	 */
+	JsonWriter(char *buffer, size_t size, Sink sink = nullptr, void *ctx = nullptr);
+
+	JsonWriter &beginObject();  ///< Start an object
+	JsonWriter &endObject();    ///< End the current object
+	JsonWriter &beginArray();   ///< Start an array
+	JsonWriter &endArray();     ///< End the current array
+
+	/**
+	 * @brief Write an object member name
+	 * @param name Member name (escaped like a string value)
+	 */
+	JsonWriter &key(const char *name);
+
+	/**
+	 * @brief Write a string value
+	 * @param text UTF-8 text; quotes, backslashes and control characters are escaped
+	 */
+	JsonWriter &value(const char *text);
+
+	/** @brief Write an integer value */
+	JsonWriter &value(long number);
+
+	/** @brief Write an integer value (int32_t is long on the ESP32 toolchains) */
+	JsonWriter &value(int number) { return value(static_cast<long>(number)); }
+
+	/**
+	 * @brief Write a number with a fixed number of decimals
+	 * @param number Value; NaN and infinity are written as null
+	 * @param decimals Digits after the point, 0-6
+	 * @details Formatted with integer arithmetic (like "%.*f", no printf)
+	 */
+	JsonWriter &value(float number, int decimals);
+
+	/** @brief Write true or false */
+	JsonWriter &value(bool flag);
+
+	/** @brief Write null */
+	JsonWriter &null();
+
+	/**
+	 * @brief Write raw bytes as they are
+	 * @param data Bytes, must be valid JSON text at this position
+	 * @param len Number of bytes
+	 * @details For framing around a document (e.g. an SSE "data: " prefix);
+	 *          no separator is added
+	 */
+	JsonWriter &raw(const char *data, size_t len);
+
+	/**
+	 * @brief Hand the rest of the buffer to the sink and check the document
+	 * @return true if everything was written and all objects/arrays are closed
+	 */
+	bool finish();
+
+	/** @brief Bytes in the buffer (the whole document without a sink) */
+	size_t length() const { return m_len; }
+
+	/** @brief false after an error */
+	bool ok() const { return m_ok; }
+
+private:
+	/**
+	 * @brief Write the comma before a value or key, if one is needed
+	 */
+	void separator();
+
+	/**
+	 * @brief Open an object or array
+	 * @param bracket '{' or '['
+	 */
+	JsonWriter &open(char bracket);
+
+	/**
+	 * @brief Close an object or array
+	 * @param bracket '}' or ']'
+	 */
+	JsonWriter &close(char bracket);
+
+	/** @brief Write an escaped, quoted string */
+	void putString(const char *text);
+
+	/** @brief Append bytes, flushing to the sink when the buffer is full */
+	void put(const char *data, size_t len);
+
+	/** @brief Append one byte */
+	void put(char c) { put(&c, 1); }
+
+	/** @brief Hand the buffer content to the sink */
+	void flush();
+
+	char *m_buffer;         ///< Output buffer
+	size_t m_size;          ///< Size of m_buffer
+	size_t m_len = 0;       ///< Bytes in m_buffer
+	Sink m_sink;            ///< Output of full buffers, nullptr = none
+	void *m_ctx;            ///< Sink context
+	uint8_t m_depth = 0;    ///< Open objects/arrays
+	uint16_t m_filled = 0;  ///< Bit per level: the level has an element already
+	bool m_afterKey = false;  ///< A key was written, its value follows
+	bool m_ok = true;       ///< No error so far
+};
@@ -0,0 +1,214 @@
+/**
+ * @file LatencyTracker.cpp
+ * @brief Sensor-to-pixel latency of the TPMS readings implementation
+ */
+
+// report() is part of the INFO telemetry report (see Telemetry.cpp)
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+
+#include "LatencyTracker.h"
+#include "TPMSUtil.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <algorithm>
+#include <cstdio>
+
+static const char *TAG = "Latency";
+
+/// Stage names for the report and JSON keys, indexed by LatencyTracker::Stage
+static const char *const STAGE_NAMES[] = {
+	"decode",
+	"poll",
+	"queue",
+	"refresh",
+	"frame",
+	"flush",
+	"total",
+};
+static_assert(sizeof(STAGE_NAMES) / sizeof(STAGE_NAMES[0]) == LatencyTracker::STAGE_COUNT,
+			  "STAGE_NAMES does not match LatencyTracker::Stage");
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the LatencyTracker singleton
+ */
+LatencyTracker &LatencyTracker::instance() {
+	static LatencyTracker tracker;
+	return tracker;
+}
+
+/**
+ * @brief Store one latency sample
+ * @param stage Pipeline stage
+ * @param us Latency (negative values are stored as 0)
+ */
+void LatencyTracker::record(Stage stage, int64_t us) {
+	const size_t s = static_cast<size_t>(stage);
+	const uint32_t value = us < 0 ? 0 : (us > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(us));
+	portENTER_CRITICAL(&m_lock);
+	m_samples[s][m_count[s] % WINDOW] = value;
+	m_count[s]++;
+	portEXIT_CRITICAL(&m_lock);
+}
+
+/**
+ * @brief A reading was applied to the main screen widgets (LVGL task)
+ * @param wheel Sensor position
+ * @param reading Reading shown (nullptr: no data)
+ * @param postedUs Time the UpdateLabels command was posted
+ * @param repaint The screen has invalidated areas, a frame will follow
+ * @details The command may have been posted before the reading was stored
+ *          (it was still queued): then the poll wait is 0 and the queue wait
+ *          counts from the store.
+ */
+void LatencyTracker::onApplied(Wheel wheel, const TPMSUtil *reading, int64_t postedUs, bool repaint) {
+	const size_t w = static_cast<size_t>(wheel);
+	if (reading == nullptr || reading->getIngressUs() == 0 ||
+		reading->getIngressUs() == m_lastIngressUs[w]) {
+		return;
+	}
+	m_lastIngressUs[w] = reading->getIngressUs();
+
+	const int64_t now = esp_timer_get_time();
+	const int64_t storedUs = reading->getStoredUs();
+	const int64_t requestUs = std::max(postedUs, storedUs);
+	record(Stage::Decode, storedUs - reading->getIngressUs());
+	record(Stage::Poll, requestUs - storedUs);
+	record(Stage::Queue, now - requestUs);
+
+	Pending &pending = m_pending[w];
+	portENTER_CRITICAL(&m_lock);
+	if (pending.active) {
+		m_superseded++;
+	}
+	if (!repaint) {
+		m_unchanged++;
+	}
+	portEXIT_CRITICAL(&m_lock);
+
+	pending.active = repaint;
+	pending.ingressUs = reading->getIngressUs();
+	pending.appliedUs = now;
+	pending.renderStartUs = 0;
+}
+
+/**
+ * @brief LVGL started rendering a frame (LVGL task)
+ * @details Readings applied before this point are drawn by this frame
+ */
+void LatencyTracker::onRenderStart() {
+	const int64_t now = esp_timer_get_time();
+	m_frameFlushUs = 0;
+	for (Pending &pending : m_pending) {
+		if (pending.active && pending.renderStartUs == 0) {
+			pending.renderStartUs = now;
+		}
+	}
+}
+
+/**
+ * @brief A band or dirty area was flushed (LVGL task)
+ * @param startUs Flush callback entry
+ * @param endUs Flush callback exit
+ * @param last Last flush of the frame
+ * @details The DMA of the last band is started, not finished, when the flush
+ *          callback returns; the transfer of one band takes well under a
+ *          millisecond.
+ */
+void LatencyTracker::onFlush(int64_t startUs, int64_t endUs, bool last) {
+	m_frameFlushUs += endUs - startUs;
+	if (!last) {
+		return;
+	}
+
+	for (Pending &pending : m_pending) {
+		if (!pending.active || pending.renderStartUs == 0) {
+			continue;
+		}
+		record(Stage::Refresh, pending.renderStartUs - pending.appliedUs);
+		record(Stage::Frame, endUs - pending.renderStartUs);
+		record(Stage::Flush, m_frameFlushUs);
+		record(Stage::Total, endUs - pending.ingressUs);
+		pending.active = false;
+
+		portENTER_CRITICAL(&m_lock);
+		m_displayed++;
+		portEXIT_CRITICAL(&m_lock);
+	}
+}
+
+/**
+ * @brief Get the statistics of a stage
+ * @param stage Pipeline stage
+ * @return Count and p50/p95/max over the last WINDOW readings
+ * @details Nearest-rank percentiles of a sorted copy of the window
+ */
+LatencyTracker::StageStats LatencyTracker::getStats(Stage stage) {
+	const size_t s = static_cast<size_t>(stage);
+	uint32_t sorted[WINDOW];
+	StageStats stats = {};
+
+	portENTER_CRITICAL(&m_lock);
+	stats.count = m_count[s];
+	const size_t n = std::min<size_t>(stats.count, WINDOW);
+	std::copy(m_samples[s], m_samples[s] + n, sorted);
+	portEXIT_CRITICAL(&m_lock);
+
+	if (n == 0) {
+		return stats;
+	}
+	std::sort(sorted, sorted + n);
+	stats.p50Us = sorted[(n * 50 + 99) / 100 - 1];
+	stats.p95Us = sorted[(n * 95 + 99) / 100 - 1];
+	stats.maxUs = sorted[n - 1];
+	return stats;
+}
+
+/**
+ * @brief Log p50/p95/max of all stages
+ */
+void LatencyTracker::report() {
+	portENTER_CRITICAL(&m_lock);
+	const uint32_t displayed = m_displayed;
+	const uint32_t unchanged = m_unchanged;
+	const uint32_t superseded = m_superseded;
+	portEXIT_CRITICAL(&m_lock);
+
+	ESP_LOGI(TAG, "Sensor to pixel: %lu readings displayed, %lu unchanged, %lu superseded",
+			 displayed, unchanged, superseded);
+	for (size_t s = 0; s < STAGE_COUNT; s++) {
+		const StageStats stats = getStats(static_cast<Stage>(s));
+		if (stats.count == 0) {
+			continue;
+		}
+		ESP_LOGI(TAG, "  %-8s p50 %6.1f ms  p95 %6.1f ms  max %6.1f ms", STAGE_NAMES[s],
+				 stats.p50Us / 1000.0, stats.p95Us / 1000.0, stats.maxUs / 1000.0);
+	}
+}
+
+/**
+ * @brief Format the statistics as JSON
+ * @return JSON object with one {count,p50_us,p95_us,max_us} per stage and
+ *         the readings displayed, unchanged and superseded
+ */
+std::string LatencyTracker::toJSON() {
+	portENTER_CRITICAL(&m_lock);
+	const uint32_t displayed = m_displayed;
+	const uint32_t unchanged = m_unchanged;
+	const uint32_t superseded = m_superseded;
+	portEXIT_CRITICAL(&m_lock);
+
+	char buf[128];
+	snprintf(buf, sizeof(buf), "{\"displayed\":%lu,\"unchanged\":%lu,\"superseded\":%lu",
+			 displayed, unchanged, superseded);
+	std::string json = buf;
+
+	for (size_t s = 0; s < STAGE_COUNT; s++) {
+		const StageStats stats = getStats(static_cast<Stage>(s));
+		snprintf(buf, sizeof(buf), ",\"%s\":{\"count\":%lu,\"p50_us\":%lu,\"p95_us\":%lu,\"max_us\":%lu}",
+				 STAGE_NAMES[s], stats.count, stats.p50Us, stats.p95Us, stats.maxUs);
+		json += buf;
+	}
+	json += "}";
+	return json;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file LatencyTracker.h
+ * @brief Sensor-to-pixel latency of the TPMS readings
+ * @details Each reading is stamped when its advertisement arrives
+ *          (TPMSScanCallbacks::onDiscovered, called from NimBLE's GAP event
+ *          handler) and when it is stored in State. The UpdateLabels command
+ *          carries the time it was posted. When the LVGL task applies a new
+ *          reading to the main screen, the reading waits for the next frame;
+ *          the last flush of that frame completes it. Per stage the latencies
+ *          of the last WINDOW readings are kept for p50/p95/max, reported
+ *          through Telemetry.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class TPMSUtil;
+
+/**
+ * @class LatencyTracker
+ * @brief Rolling per-stage latency statistics of the sensor-to-pixel path
+ * @details Singleton. The pipeline hooks (onApplied, onRenderStart, onFlush)
+ *          run in the LVGL task only. Statistics may be read from any task.
+ */
+class LatencyTracker {
+public:
+	/**
+	 * @enum Stage
+	 * @brief Stages of a reading on its way to the panel
+	 */
+	enum class Stage : uint8_t {
+		Decode,   ///< Advertisement received -> reading stored in State
+		Poll,     ///< Stored -> UpdateLabels posted by the 100 ms control loop
+		Queue,    ///< Posted -> applied to the widgets by the LVGL task
+		Refresh,  ///< Applied -> LVGL refresh of the next frame started
+		Frame,    ///< Frame render start -> last band flushed
+		Flush,    ///< Time spent in the flush callback during that frame (part of Frame)
+		Total,    ///< Advertisement received -> last band flushed
+		Count
+	};
+
+	/**
+	 * @enum Wheel
+	 * @brief Sensor position, one reading can be in flight per wheel
+	 */
+	enum class Wheel : uint8_t {
+		Front,
+		Rear,
+		Count
+	};
+
+	/**
+	 * @struct StageStats
+	 * @brief Statistics of one stage over the last WINDOW readings
+	 */
+	struct StageStats {
+		uint32_t count;  ///< Readings measured since boot
+		uint32_t p50Us;  ///< Median
+		uint32_t p95Us;  ///< 95th percentile
+		uint32_t maxUs;  ///< Maximum
+	};
+
+	static constexpr size_t STAGE_COUNT = static_cast<size_t>(Stage::Count);
+	static constexpr size_t WINDOW = 64;  ///< Readings the percentiles are computed over
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the LatencyTracker singleton
+	 */
+	static LatencyTracker &instance();
+
+	/**
+	 * @brief A reading was applied to the main screen widgets (LVGL task)
+	 * @param wheel Sensor position
+	 * @param reading Reading shown (nullptr: no data)
+	 * @param postedUs Time the UpdateLabels command was posted
+	 * @param repaint The screen has invalidated areas, a frame will follow
+	 * @details Readings already applied are ignored. A reading that did not
+	 *          change any pixel only counts for Decode, Poll and Queue.
+	 */
+	void onApplied(Wheel wheel, const TPMSUtil *reading, int64_t postedUs, bool repaint);
+
+	/**
+	 * @brief LVGL started rendering a frame (LVGL task)
+	 */
+	void onRenderStart();
+
+	/**
+	 * @brief A band or dirty area was flushed (LVGL task)
+	 * @param startUs Flush callback entry
+	 * @param endUs Flush callback exit
+	 * @param last Last flush of the frame
+	 */
+	void onFlush(int64_t startUs, int64_t endUs, bool last);
+
+	/**
+	 * @brief Get the statistics of a stage
+	 * @param stage Pipeline stage
+	 * @return Count and p50/p95/max over the last WINDOW readings
+	 */
+	StageStats getStats(Stage stage);
+
+	/**
+	 * @brief Log p50/p95/max of all stages
+	 */
+	void report();
+
+	/**
+	 * @brief Format the statistics as JSON
+	 * @return JSON object with one {count,p50_us,p95_us,max_us} per stage and
+	 *         the readings displayed, unchanged and superseded
+	 */
+	std::string toJSON();
+
+private:
+	LatencyTracker() = default;
+	~LatencyTracker() = default;
+
+	LatencyTracker(const LatencyTracker &) = delete;
+	LatencyTracker &operator=(const LatencyTracker &) = delete;
+
+	/**
+	 * @struct Pending
+	 * @brief A reading applied to the widgets, waiting for its frame
+	 */
+	struct Pending {
+		int64_t ingressUs;      ///< Advertisement received
+		int64_t appliedUs;      ///< Applied to the widgets
+		int64_t renderStartUs;  ///< Start of its frame, 0 until the frame starts
+		bool active;            ///< Waiting for a frame
+	};
+
+	/**
+	 * @brief Store one latency sample
+	 * @param stage Pipeline stage
+	 * @param us Latency (negative values are stored as 0)
+	 */
+	void record(Stage stage, int64_t us);
+
+	static constexpr size_t WHEEL_COUNT = static_cast<size_t>(Wheel::Count);
+
+	// LVGL task only
+	Pending m_pending[WHEEL_COUNT] = {};           ///< Readings waiting for a frame
+	int64_t m_lastIngressUs[WHEEL_COUNT] = {};     ///< Newest reading applied per wheel
+	int64_t m_frameFlushUs = 0;                    ///< Flush time of the current frame
+
+	// Guarded by m_lock
+	uint32_t m_samples[STAGE_COUNT][WINDOW] = {};  ///< Latest samples per stage, us
+	uint32_t m_count[STAGE_COUNT] = {};            ///< Samples per stage since boot
+	uint32_t m_displayed = 0;                      ///< Readings completed by a frame
+	uint32_t m_unchanged = 0;                      ///< Readings that changed no pixel
+	uint32_t m_superseded = 0;                     ///< Readings replaced before their frame
+	portMUX_TYPE m_lock = portMUX_INITIALIZER_UNLOCKED;  ///< Guards the statistics
+};
@@ -6,17 +6,22 @@
 #include "PairController.h"
 #include "Application.h"       // Application instance
 #include "State.h"              // Global state
+#include "UICommandQueue.h"     // Pairing screen updates
 #include "WiFiManager.h"        // WiFi AP management
 #include "WebServer.h"          // HTTP server
-#include "UI/ui.h"              // LVGL UI elements
 #include "esp_timer.h"          // High-resolution timer
 #include "esp_log.h"            // ESP logging
-#include "lvgl.h"               // LVGL UI functions
+#include <cstdio>               // snprintf
 #include <NimBLEDevice.h>       // BLE scanning
 
 /// Log tag for PairController module
 static const char* TAG = "PairController";
 
+// Status text colors of the pairing screen
+static constexpr uint32_t STATUS_COLOR_PROMPT = 0xFFFF00;    ///< Yellow: waiting for a button press
+static constexpr uint32_t STATUS_COLOR_FOUND = 0x00FF00;     ///< Green: sensor found
+static constexpr uint32_t STATUS_COLOR_SCANNING = 0xFFFFFF;  ///< White: scan running
+
 /**
  * @brief Get singleton instance (Meyer's singleton)
  * @return Reference to the PairController singleton
@@ -59,12 +64,7 @@ void PairController::init() {
 	ESP_LOGI(TAG, "Switched to active BLE scan");
 	
 	// Show initial UI - waiting for button press to start
-	lv_label_set_text(ui_Label10, "-FRONT WHEEL-");
-	lv_label_set_text(ui_Label11, "START PAIRING");
-	lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0xFFFF00), LV_PART_MAIN);  // Yellow
-	lv_obj_add_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);    // Hide spinner
-	lv_obj_clear_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);   // Show button icon
-	lv_label_set_text(ui_Label12, "---");
+	postView("START PAIRING", STATUS_COLOR_PROMPT, false, "---");
 }
 
 /**
@@ -79,12 +79,7 @@ void PairController::startFrontScan() {
 	m_lastSensorCount = 0;
 	
 	// Update UI for front wheel scan
-	lv_label_set_text(ui_Label10, "-FRONT WHEEL-");
-	lv_label_set_text(ui_Label11, "START PAIRING");
-	lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0xFFFF00), LV_PART_MAIN);  // Yellow
-	lv_obj_add_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);    // Hide spinner
-	lv_obj_clear_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);   // Show button icon
-	lv_label_set_text(ui_Label12, "60s");                // Show initial timeout
+	postView("START PAIRING", STATUS_COLOR_PROMPT, false, "60s");
 }
 
 /**
@@ -99,12 +94,7 @@ void PairController::startRearScan() {
 	m_lastSensorCount = 0;
 	
 	// Update UI for rear wheel scan
-	lv_label_set_text(ui_Label10, "-REAR WHEEL-");
-	lv_label_set_text(ui_Label11, "START PAIRING");
-	lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0xFFFF00), LV_PART_MAIN);  // Yellow
-	lv_obj_add_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);    // Hide spinner
-	lv_obj_clear_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);   // Show button icon
-	lv_label_set_text(ui_Label12, "60s");                // Show initial timeout
+	postView("START PAIRING", STATUS_COLOR_PROMPT, false, "60s");
 }
 
 /**
@@ -129,7 +119,7 @@ void PairController::update(uint32_t currentTime) {
 		if (elapsed < SCAN_TIMEOUT_MS) {
 			char timeoutText[16];
 			snprintf(timeoutText, sizeof(timeoutText), "%lus", remaining);
-			lv_label_set_text(ui_Label12, timeoutText);
+			postTimeout(timeoutText);
 		} else {
 			// Timeout reached - show message and wait for button press to retry
 			ESP_LOGW(TAG, "Scan timeout");
@@ -142,11 +132,7 @@ void PairController::update(uint32_t currentTime) {
 			}
 			
 			// Update UI to show timeout
-			lv_label_set_text(ui_Label11, "TIMEOUT");
-			lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0xFFFF00), LV_PART_MAIN);  // Yellow
-			lv_obj_add_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);    // Hide spinner
-			lv_obj_clear_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);   // Show button icon
-			lv_label_set_text(ui_Label12, "0s");
+			postView("TIMEOUT", STATUS_COLOR_PROMPT, false, "0s");
 			m_scanStartTime = 0;  // Reset for next attempt
 		}
 	}
@@ -161,18 +147,18 @@ void PairController::checkForNewSensor() {
 		return;
 	}
 
+	// Count and first address are copied; the BLE task updates the map
 	State &state = State::getInstance();
+	state.lock();
 	uint32_t currentCount = state.getData().size();
+	std::string newestAddress;
+	if (currentCount > m_lastSensorCount && currentCount > 0) {
+		newestAddress = state.getData().begin()->first;  // Take first one for now
+	}
+	state.unlock();
 
 	// Check if a new sensor appeared
 	if (currentCount > m_lastSensorCount && currentCount > 0) {
-		// Get the newest sensor address (first in map)
-		std::string newestAddress;
-		for (const auto &pair : state.getData()) {
-			newestAddress = pair.first;
-			break; // Take first one for now
-		}
-
 		if (m_state == PairingState::SCANNING_FRONT) {
 			// Front sensor detected
 			m_selectedFrontAddress = newestAddress;
@@ -206,18 +192,10 @@ void PairController::checkForNewSensor() {
 void PairController::updateUI() {
 	if (m_state == PairingState::WAITING_FRONT_CONFIRM) {
 		// Show front sensor address in green
-		lv_label_set_text(ui_Label11, m_selectedFrontAddress.c_str());
-		lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0x00FF00), LV_PART_MAIN);  // Green
-		lv_obj_add_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);    // Hide spinner
-		lv_obj_clear_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);   // Show button icon
-		lv_label_set_text(ui_Label12, "---");
+		postView(m_selectedFrontAddress.c_str(), STATUS_COLOR_FOUND, false, "---");
 	} else if (m_state == PairingState::WAITING_REAR_CONFIRM) {
 		// Show rear sensor address in green
-		lv_label_set_text(ui_Label11, m_selectedRearAddress.c_str());
-		lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0x00FF00), LV_PART_MAIN);  // Green
-		lv_obj_add_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);    // Hide spinner
-		lv_obj_clear_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);   // Show button icon
-		lv_label_set_text(ui_Label12, "---");
+		postView(m_selectedRearAddress.c_str(), STATUS_COLOR_FOUND, false, "---");
 	}
 }
 
@@ -226,7 +204,7 @@ void PairController::updateUI() {
  * @details Button actions by state:
  *          - SCANNING/TIMEOUT: (Re)start scan with timeout
  *          - WAITING_FRONT_CONFIRM: Confirm front sensor, move to rear scan
- *          - WAITING_REAR_CONFIRM: Confirm rear sensor, save and reboot
+ *          - WAITING_REAR_CONFIRM: Confirm rear sensor and save
  */
 void PairController::handleButtonPress() {
 	ESP_LOGD(TAG, "Button pressed in state %d", static_cast<int>(m_state));
@@ -234,43 +212,37 @@ void PairController::handleButtonPress() {
 	if (m_state == PairingState::SCANNING_FRONT || m_state == PairingState::TIMEOUT_FRONT) {
 		// Start or retry front sensor scan
 		ESP_LOGI(TAG, "Starting/retrying front sensor scan");
-		lv_label_set_text(ui_Label11, "SCANNING...");
-		lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0xFFFFFF), LV_PART_MAIN);  // White
-		lv_obj_clear_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);  // Show spinner
-		lv_obj_add_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);     // Hide button icon
 		m_state = PairingState::SCANNING_FRONT;
 		m_scanStartTime = esp_timer_get_time() / 1000;  // Start timeout
+		postView("SCANNING...", STATUS_COLOR_SCANNING, true, "60s");
 	} else if (m_state == PairingState::SCANNING_REAR || m_state == PairingState::TIMEOUT_REAR) {
 		// Start or retry rear sensor scan
 		ESP_LOGI(TAG, "Starting/retrying rear sensor scan");
-		lv_label_set_text(ui_Label11, "SCANNING...");
-		lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0xFFFFFF), LV_PART_MAIN);  // White
-		lv_obj_clear_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);  // Show spinner
-		lv_obj_add_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);     // Hide button icon
 		m_state = PairingState::SCANNING_REAR;
 		m_scanStartTime = esp_timer_get_time() / 1000;  // Start timeout
+		postView("SCANNING...", STATUS_COLOR_SCANNING, true, "60s");
 	} else if (m_state == PairingState::WAITING_FRONT_CONFIRM) {
 		// Front sensor confirmed - proceed to rear scan
 		ESP_LOGI(TAG, "Front sensor confirmed, scanning rear");
 		startRearScan();
 	} else if (m_state == PairingState::WAITING_REAR_CONFIRM) {
-		// Both sensors confirmed - save and reboot
-		ESP_LOGI(TAG, "Rear sensor confirmed, saving and rebooting");
-		savePairingAndReboot();
+		// Both sensors confirmed - save
+		ESP_LOGI(TAG, "Rear sensor confirmed, saving");
+		savePairing();
 	}
 }
 
 /**
- * @brief Save paired sensor addresses to NVS and reboot
+ * @brief Save paired sensor addresses to NVS
  * @details Steps:
  *          1. Validate both addresses are present
- *          2. Save addresses to ConfigManager (NVS)
- *          3. Update State with pairing status
+ *          2. Save addresses to ConfigManager (NVS); its change listener
+ *             updates State, so the control loop shows the main screen next
+ *          3. Show completion message
  *          4. Restore normal BLE scan parameters
- *          5. Show completion message
- *          6. Reboot device to normal mode
+ *          5. Hold the completion message for 1.5 s
  */
-void PairController::savePairingAndReboot() {
+void PairController::savePairing() {
 	// Validation check
 	if (m_selectedFrontAddress.empty() || m_selectedRearAddress.empty()) {
 		ESP_LOGE(TAG, "Error - missing sensor address");
@@ -280,24 +252,19 @@ void PairController::savePairingAndReboot() {
 	ESP_LOGI(TAG, "Saving pairing - Front: %s, Rear: %s",
 		   m_selectedFrontAddress.c_str(), m_selectedRearAddress.c_str());
 
-	// Save addresses to NVS via ConfigManager
-	Application &app = Application::instance();
-	app.getConfig().setString("front_address", m_selectedFrontAddress);
-	app.getConfig().setString("rear_address", m_selectedRearAddress);
-
-	// Update global state
-	State &state = State::getInstance();
-	state.setFrontAddress(m_selectedFrontAddress);
-	state.setRearAddress(m_selectedRearAddress);
-	state.setIsPaired(true);
+	// Save addresses to NVS via ConfigManager (one write for both)
+	ConfigManager &config = Application::instance().getConfig();
+	config.begin();
+	config.setString(ConfigString::FrontAddress, m_selectedFrontAddress);
+	config.setString(ConfigString::RearAddress, m_selectedRearAddress);
+	config.commit();
 
 	// Update pairing controller state
 	m_state = PairingState::COMPLETE;
 	m_pairingComplete = true;
 
 	// Show completion message
-	lv_label_set_text(ui_Label11, "PAIRING COMPLETE");
-	lv_obj_add_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);
+	postView("PAIRING COMPLETE", STATUS_COLOR_FOUND, false, "---");
 
 	// Restore normal BLE scan parameters (WiFi coexistence friendly)
 	ESP_LOGI(TAG, "Restoring normal BLE scan");
@@ -308,7 +275,45 @@ void PairController::savePairingAndReboot() {
 	pBLEScan->setWindow(50);     // 31.25ms window (50% duty cycle)
 	pBLEScan->start(0, false, false);  // Continuous scan
 
-	// Brief delay for user to see completion message, then reboot
+	// Brief delay for user to see completion message
 	vTaskDelay(pdMS_TO_TICKS(1500));
-	esp_restart();
+}
+
+/**
+ * @brief Post the pairing screen content to the LVGL task
+ * @param status Status text or sensor address
+ * @param statusColor Status text color (RGB888)
+ * @param scanning true: show the spinner, false: show the button icon
+ * @param timeout Countdown text
+ * @details The wheel title follows m_state. The button icon is hidden once
+ *          pairing is complete.
+ */
+void PairController::postView(const char *status, uint32_t statusColor,
+							  bool scanning, const char *timeout) {
+	const bool rear = m_state == PairingState::SCANNING_REAR ||
+					  m_state == PairingState::WAITING_REAR_CONFIRM ||
+					  m_state == PairingState::TIMEOUT_REAR ||
+					  m_state == PairingState::COMPLETE;
+
+	UICommand cmd = {};
+	cmd.type = UICommand::Type::SetPairingView;
+	UICommand::PairingView &view = cmd.pairing;
+	snprintf(view.wheel, sizeof(view.wheel), "%s", rear ? "-REAR WHEEL-" : "-FRONT WHEEL-");
+	snprintf(view.status, sizeof(view.status), "%s", status);
+	view.statusColor = statusColor;
+	view.spinner = scanning;
+	view.buttonIcon = !scanning && m_state != PairingState::COMPLETE;
+	snprintf(view.timeout, sizeof(view.timeout), "%s", timeout);
+	UICommandQueue::instance().post(cmd);
+}
+
+/**
+ * @brief Post the pairing countdown to the LVGL task
+ * @param timeout Countdown text
+ */
+void PairController::postTimeout(const char *timeout) {
+	UICommand cmd = {};
+	cmd.type = UICommand::Type::SetPairingTimeout;
+	snprintf(cmd.pairing.timeout, sizeof(cmd.pairing.timeout), "%s", timeout);
+	UICommandQueue::instance().post(cmd);
 }
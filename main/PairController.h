@@ -9,7 +9,7 @@
  * 2. Detect first TPMS sensor -> Wait for button confirm
  * 3. Start rear wheel scan (60s timeout)
  * 4. Detect second TPMS sensor (different from front) -> Wait for confirm
- * 5. Save addresses to NVS and reboot
+ * 5. Save addresses to NVS, the main screen follows
  */
 
 #pragma once
@@ -59,7 +59,7 @@ public:
 	 *          - SCANNING: Start scan with timeout
 	 *          - WAITING_CONFIRM: Confirm sensor and move to next step
 	 *          - TIMEOUT: Retry scan
-	 *          - COMPLETE: Save addresses and reboot
+	 *          - COMPLETE: Save addresses
 	 */
 	void handleButtonPress();
 
@@ -99,8 +99,14 @@ private:
 	/** @brief Start rear wheel scan with timeout */
 	void startRearScan();
 	
-	/** @brief Save paired addresses to NVS and reboot */
-	void savePairingAndReboot();
+	/** @brief Save paired addresses to NVS */
+	void savePairing();
+
+	/** @brief Post the pairing screen content to the LVGL task */
+	void postView(const char *status, uint32_t statusColor, bool scanning, const char *timeout);
+
+	/** @brief Post the pairing countdown to the LVGL task */
+	void postTimeout(const char *timeout);
 
 	PairingState m_state = PairingState::SCANNING_FRONT;  ///< Current pairing state
 	std::string m_selectedFrontAddress;                    ///< Front sensor MAC address
@@ -0,0 +1,217 @@
+/**
+ * @file Profiler.cpp
+ * @brief LVGL built-in profiler on esp_timer with Chrome trace export implementation
+ */
+
+#include "Profiler.h"
+#include "lvgl.h"
+#include "src/misc/lv_profiler_builtin_private.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <cstdio>
+#include <cstring>
+
+#if UI_PROFILER && !(LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN)
+#error "UI_PROFILER needs LV_USE_PROFILER and LV_USE_PROFILER_BUILTIN in lv_conf.h"
+#endif
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the Profiler singleton
+ */
+Profiler &Profiler::instance() {
+	static Profiler profiler;
+	return profiler;
+}
+
+#if UI_PROFILER
+
+static const char *TAG = "Profiler";
+
+/// Writer of the serial export
+static bool writeStdout(const char *data, size_t len, void *ctx) {
+	return fwrite(data, 1, len, stdout) == len;
+}
+
+/**
+ * @brief Switch LVGL's profiler to esp_timer ticks and the ring buffer, and
+ *        start the serial command task
+ * @details lv_init() already started the profiler with lv_tick_get() and
+ *          flush-when-full; it is re-initialized here, which drops the events
+ *          recorded so far.
+ */
+void Profiler::init() {
+	m_dumpMutex = xSemaphoreCreateMutex();
+	if (m_dumpMutex == nullptr) {
+		ESP_LOGE(TAG, "Failed to create mutex");
+		return;
+	}
+
+	lv_profiler_builtin_config_t config;
+	lv_profiler_builtin_config_init(&config);
+	config.tick_per_sec = 1000000;
+	config.tick_get_cb = tickGet;
+	config.tid_get_cb = taskId;
+	config.flush_cb = flushCallback;
+	config.format = LV_PROFILER_BUILTIN_FORMAT_CHROME_JSON;
+	config.ring = true;
+	lv_profiler_builtin_init(&config);
+
+	xTaskCreate(serialTaskWrapper, "profiler", SERIAL_TASK_STACK, this,
+				tskIDLE_PRIORITY + 1, nullptr);
+	ESP_LOGI(TAG, "Recording into a %u byte ring, send 't' to dump the trace",
+			 static_cast<unsigned>(LV_PROFILER_BUILTIN_BUF_SIZE));
+}
+
+/**
+ * @brief Export the recorded events as a Chrome trace JSON object
+ * @param writer Output function
+ * @param ctx Passed to writer
+ * @return false if the profiler is not running or the writer failed
+ * @details Recording is paused meanwhile, so the LVGL task and the BLE
+ *          callbacks never wait for a slow writer on the profiler mutex.
+ */
+bool Profiler::dump(Writer writer, void *ctx) {
+	if (m_dumpMutex == nullptr) {
+		return false;
+	}
+	xSemaphoreTake(m_dumpMutex, portMAX_DELAY);
+	lv_profiler_builtin_set_enable(false);
+
+	m_writer = writer;
+	m_writerCtx = ctx;
+	m_writeOk = true;
+	m_outLen = 0;
+
+	// LVGL writes one event per line, each followed by a comma; the metadata
+	// events written after them close the array
+	static const char HEADER[] = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	write(HEADER, sizeof(HEADER) - 1);
+	lv_profiler_builtin_flush();
+	writeTaskNames();
+	static const char FOOTER[] =
+		"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"bike_pressure_monitor\"}}\n]}\n";
+	write(FOOTER, sizeof(FOOTER) - 1);
+	flushOutput();
+
+	const bool ok = m_writeOk;
+	m_writer = nullptr;
+	lv_profiler_builtin_set_enable(true);
+	xSemaphoreGive(m_dumpMutex);
+	return ok;
+}
+
+/**
+ * @brief Buffer export output and pass it to the writer in blocks
+ * @param data Bytes to write
+ * @param len Number of bytes
+ */
+void Profiler::write(const char *data, size_t len) {
+	while (len > 0) {
+		if (m_outLen == OUT_BUF_SIZE) {
+			flushOutput();
+		}
+		const size_t n = (len < OUT_BUF_SIZE - m_outLen) ? len : OUT_BUF_SIZE - m_outLen;
+		memcpy(m_out + m_outLen, data, n);
+		m_outLen += n;
+		data += n;
+		len -= n;
+	}
+}
+
+/**
+ * @brief Pass the buffered output to the writer
+ * @details After a failed write the rest of the export is discarded
+ */
+void Profiler::flushOutput() {
+	if (m_outLen > 0 && m_writeOk) {
+		m_writeOk = m_writer(m_out, m_outLen, m_writerCtx);
+	}
+	m_outLen = 0;
+}
+
+/**
+ * @brief Write one thread_name metadata event per task
+ * @details Tasks deleted since their events were recorded stay unnamed
+ */
+void Profiler::writeTaskNames() {
+	const UBaseType_t count = uxTaskGetSystemState(m_tasks, MAX_TASKS, nullptr);
+	char buf[128];
+	for (UBaseType_t i = 0; i < count; i++) {
+		const int len = snprintf(buf, sizeof(buf),
+								 "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}},\n",
+								 static_cast<unsigned>(m_tasks[i].xTaskNumber), m_tasks[i].pcTaskName);
+		write(buf, static_cast<size_t>(len));
+	}
+}
+
+/**
+ * @brief Serial command task: dumps the trace on `t`
+ * @param param Profiler instance
+ * @details The console UART is read without a driver, so reads do not block
+ *          and the task polls every 200 ms.
+ */
+void Profiler::serialTaskWrapper(void *param) {
+	Profiler *self = static_cast<Profiler *>(param);
+	while (true) {
+		const int c = fgetc(stdin);
+		if (c == EOF) {
+			clearerr(stdin);
+			vTaskDelay(pdMS_TO_TICKS(200));
+			continue;
+		}
+		if (c == 't') {
+			printf("\n--- trace begin ---\n");
+			self->dump(writeStdout, nullptr);
+			printf("--- trace end ---\n");
+			fflush(stdout);
+		}
+	}
+}
+
+/**
+ * @brief Profiler timestamp
+ * @return Microseconds since reset
+ */
+uint64_t Profiler::tickGet() {
+	return static_cast<uint64_t>(esp_timer_get_time());
+}
+
+/**
+ * @brief Profiler thread id
+ * @return FreeRTOS task number of the calling task
+ */
+int Profiler::taskId() {
+	return static_cast<int>(uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle()));
+}
+
+/**
+ * @brief LVGL's flush callback: one formatted event
+ * @param buf Event line
+ * @details Only called from lv_profiler_builtin_flush() in dump(): the ring
+ *          never flushes by itself.
+ */
+void Profiler::flushCallback(const char *buf) {
+	Profiler &self = instance();
+	if (self.m_writer != nullptr) {
+		self.write(buf, strlen(buf));
+	}
+}
+
+#else
+
+/**
+ * @brief No-op: built without UI_PROFILER
+ */
+void Profiler::init() {
+}
+
+/**
+ * @brief No-op: built without UI_PROFILER
+ * @return false
+ */
+bool Profiler::dump(Writer writer, void *ctx) {
+	return false;
+}
+
+#endif
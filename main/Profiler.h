@@ -0,0 +1,130 @@
+/**
+ * @file Profiler.h
+ * @brief LVGL built-in profiler on esp_timer with Chrome trace export
+ * @details Built with UI_PROFILER, LVGL's profiler records every
+ *          LV_PROFILER_BEGIN/END (LVGL's refresh, draw, layout, timers and
+ *          our own trace points: advert decode, State update, UI diff, flush)
+ *          with an esp_timer timestamp into a RAM ring. The ring is exported
+ *          in Chrome trace event JSON, which Perfetto (ui.perfetto.dev) and
+ *          chrome://tracing open directly:
+ *          - GET /api/trace in WiFi configuration mode
+ *          - `t` sent over the serial monitor, printed between
+ *            `--- trace begin ---` and `--- trace end ---` lines
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <cstddef>
+#include <cstdint>
+
+#ifndef UI_PROFILER
+#define UI_PROFILER 0     ///< 1 = LVGL profiler with trace export (sets LV_USE_PROFILER in lv_conf.h)
+#endif
+
+/**
+ * @class Profiler
+ * @brief Configures LVGL's built-in profiler and exports its ring buffer
+ * @details Singleton. Timestamps are esp_timer microseconds and the thread
+ *          id is the FreeRTOS task number, so each task gets its own track,
+ *          named after the task in the exported trace. Recording pauses while
+ *          the ring is exported.
+ */
+class Profiler {
+public:
+	/**
+	 * @brief Output of an export
+	 * @param data Bytes to write
+	 * @param len Number of bytes
+	 * @param ctx User context passed to dump()
+	 * @return false to abort the export
+	 */
+	using Writer = bool (*)(const char *data, size_t len, void *ctx);
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the Profiler singleton
+	 */
+	static Profiler &instance();
+
+	/**
+	 * @brief Switch LVGL's profiler to esp_timer ticks and the ring buffer, and
+	 *        start the serial command task
+	 * @details Call after lv_init(). No-op without UI_PROFILER.
+	 */
+	void init();
+
+	/**
+	 * @brief Export the recorded events as a Chrome trace JSON object
+	 * @param writer Output function
+	 * @param ctx Passed to writer
+	 * @return false if the profiler is not running or the writer failed
+	 * @details Exports are serialized; the events are kept, each export holds
+	 *          the latest ring content.
+	 */
+	bool dump(Writer writer, void *ctx);
+
+private:
+	Profiler() = default;
+	~Profiler() = default;
+
+	Profiler(const Profiler &) = delete;
+	Profiler &operator=(const Profiler &) = delete;
+
+	/**
+	 * @brief Buffer export output and pass it to the writer in blocks
+	 * @param data Bytes to write
+	 * @param len Number of bytes
+	 */
+	void write(const char *data, size_t len);
+
+	/**
+	 * @brief Pass the buffered output to the writer
+	 */
+	void flushOutput();
+
+	/**
+	 * @brief Write one thread_name metadata event per task
+	 */
+	void writeTaskNames();
+
+	/**
+	 * @brief Serial command task: dumps the trace on `t`
+	 * @param param Profiler instance
+	 */
+	static void serialTaskWrapper(void *param);
+
+	/**
+	 * @brief Profiler timestamp
+	 * @return Microseconds since reset
+	 */
+	static uint64_t tickGet();
+
+	/**
+	 * @brief Profiler thread id
+	 * @return FreeRTOS task number of the calling task
+	 */
+	static int taskId();
+
+	/**
+	 * @brief LVGL's flush callback: one formatted event
+	 * @param buf Event line
+	 */
+	static void flushCallback(const char *buf);
+
+#if UI_PROFILER
+	static constexpr size_t OUT_BUF_SIZE = 1024;        ///< Output block size, bytes
+	static constexpr size_t MAX_TASKS = 24;             ///< Tasks named in the export
+	static constexpr uint32_t SERIAL_TASK_STACK = 3072; ///< Serial command task stack, bytes
+
+	char m_out[OUT_BUF_SIZE];                     ///< Export output buffer
+	size_t m_outLen = 0;                          ///< Bytes in m_out
+	Writer m_writer = nullptr;                    ///< Output of the running export
+	void *m_writerCtx = nullptr;                  ///< Context of m_writer
+	bool m_writeOk = true;                        ///< No writer call failed in the running export
+	SemaphoreHandle_t m_dumpMutex = nullptr;      ///< Serializes exports
+	TaskStatus_t m_tasks[MAX_TASKS];              ///< uxTaskGetSystemState() output for task names
+#endif
+};
@@ -0,0 +1,383 @@
+/**
+ * @file SensorStream.cpp
+ * @brief Server-Sent Events stream of the TPMS readings implementation
+ */
+
+#include "SensorStream.h"
+#include "JsonWriter.h"
+#include "TPMSUtil.h"
+#include "esp_log.h"
+#include <cstdio>
+#include <cstring>
+
+static const char *TAG = "SensorStream";
+
+/// Room for the chunk size line ("3ff\r\n") in front of an event
+static constexpr size_t CHUNK_HEADER_SIZE = 8;
+/// Chunk trailer ("\r\n")
+static constexpr size_t CHUNK_TRAILER_SIZE = 2;
+
+/**
+ * @brief Format readings as an SSE "update" event
+ * @param out Output buffer
+ * @param size Size of out
+ * @param readings Readings to send
+ * @param count Number of readings
+ * @return Length of the event, 0 if it does not fit
+ * @details The data line has the format of GET /api/sensors
+ */
+static size_t formatUpdate(char *out, size_t size, const SensorStream::Reading *readings, size_t count) {
+	static const char PREFIX[] = "event: update\ndata: ";
+	JsonWriter json(out, size);
+	json.raw(PREFIX, sizeof(PREFIX) - 1);
+	json.beginObject().key("sensors").beginArray();
+	for (size_t i = 0; i < count; i++) {
+		json.beginObject();
+		json.key("address").value(readings[i].address);
+		json.key("pressure").value(readings[i].pressurePsi, 1);
+		json.key("temperature").value(readings[i].temperatureC, 1);
+		json.key("battery").value(static_cast<int>(readings[i].battery));
+		json.endObject();
+	}
+	json.endArray().endObject();
+	json.raw("\n\n", 2);
+	return json.finish() ? json.length() : 0;
+}
+
+/**
+ * @brief JsonWriter::Sink sending the snapshot event as HTTP chunks
+ * @param data Bytes to send
+ * @param len Number of bytes
+ * @param ctx HTTP request
+ * @return false if the client is gone
+ */
+static bool sendResponseChunk(const char *data, size_t len, void *ctx) {
+	return httpd_resp_send_chunk(static_cast<httpd_req_t *>(ctx), data, len) == ESP_OK;
+}
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the SensorStream singleton
+ */
+SensorStream &SensorStream::instance() {
+	static SensorStream stream;
+	return stream;
+}
+
+/**
+ * @brief Take over an HTTP request as event stream (HTTP server task)
+ * @param req GET /api/sensors/stream request
+ * @param snapshot Writes the JSON of the first "snapshot" event
+ * @return ESP_OK if the client was added; an error response was sent otherwise
+ * @details Clients are only added and removed on the server task, so the
+ *          free slot found stays free until it is taken. The snapshot is
+ *          streamed in SNAPSHOT_CHUNK_SIZE chunks, whatever the sensor count.
+ */
+esp_err_t SensorStream::addClient(httpd_req_t *req, SnapshotWriter snapshot) {
+	size_t slot = MAX_CLIENTS;
+	portENTER_CRITICAL(&m_lock);
+	for (size_t i = 0; i < MAX_CLIENTS; i++) {
+		if (m_clients[i].server == nullptr) {
+			slot = i;
+			break;
+		}
+	}
+	portEXIT_CRITICAL(&m_lock);
+
+	if (slot == MAX_CLIENTS) {
+		ESP_LOGW(TAG, "Stream refused, %u clients connected", MAX_CLIENTS);
+		httpd_resp_set_status(req, "503 Service Unavailable");
+		return httpd_resp_send(req, "Too many streams", HTTPD_RESP_USE_STRLEN);
+	}
+
+	if (m_timer == nullptr) {
+		const esp_timer_create_args_t args = {
+			.callback = timerCallback,
+			.arg = this,
+			.dispatch_method = ESP_TIMER_TASK,
+			.name = "sse_flush",
+			.skip_unhandled_events = true,
+		};
+		if (esp_timer_create(&args, &m_timer) != ESP_OK) {
+			ESP_LOGE(TAG, "Failed to create flush timer");
+			httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Stream unavailable");
+			return ESP_FAIL;
+		}
+	}
+
+	// Snapshot first: the browser reconnects after 3 s if the stream drops
+	httpd_resp_set_type(req, "text/event-stream");
+	httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+	static const char PREFIX[] = "retry: 3000\nevent: snapshot\ndata: ";
+	char buffer[SNAPSHOT_CHUNK_SIZE];
+	JsonWriter json(buffer, sizeof(buffer), sendResponseChunk, req);
+	json.raw(PREFIX, sizeof(PREFIX) - 1);
+	snapshot(json);
+	json.raw("\n\n", 2);
+	if (!json.finish()) {
+		return ESP_FAIL;
+	}
+
+	const int fd = httpd_req_to_sockfd(req);
+	const uint8_t bit = 1U << slot;
+	portENTER_CRITICAL(&m_lock);
+	m_clients[slot] = {req->handle, fd, esp_timer_get_time()};
+	for (Pending &pending : m_pending) {
+		pending.clients &= ~bit;  // Covered by the snapshot
+	}
+	const size_t count = ++m_clientCount;
+	portEXIT_CRITICAL(&m_lock);
+
+	if (count == 1) {
+		esp_timer_start_periodic(m_timer, FLUSH_PERIOD_MS * 1000);
+	}
+	ESP_LOGI(TAG, "Stream client on socket %d, %u connected", fd, count);
+	return ESP_OK;
+}
+
+/**
+ * @brief Forget a client whose socket is being closed (HTTP server task)
+ * @param fd Socket of the session
+ * @details Called for every closed session; other sockets are ignored
+ */
+void SensorStream::removeClient(int fd) {
+	bool removed = false;
+	portENTER_CRITICAL(&m_lock);
+	for (size_t slot = 0; slot < MAX_CLIENTS; slot++) {
+		if (m_clients[slot].server != nullptr && m_clients[slot].fd == fd) {
+			m_clients[slot] = {};
+			const uint8_t bit = 1U << slot;
+			for (Pending &pending : m_pending) {
+				pending.clients &= ~bit;
+			}
+			m_clientCount--;
+			removed = true;
+			break;
+		}
+	}
+	const size_t count = m_clientCount;
+	const uint32_t sent = m_eventsSent;
+	const uint32_t dropped = m_dropped;
+	portEXIT_CRITICAL(&m_lock);
+
+	if (!removed) {
+		return;
+	}
+	if (count == 0) {
+		esp_timer_stop(m_timer);
+	}
+	ESP_LOGI(TAG, "Stream client on socket %d closed, %u connected (%lu events sent, %lu changes dropped)",
+			 fd, count, sent, dropped);
+}
+
+/**
+ * @brief Forget all clients before the server stops
+ * @details Stops the timer first, so no work is queued to a stopped server
+ */
+void SensorStream::disconnectAll() {
+	if (m_timer != nullptr) {
+		esp_timer_stop(m_timer);
+	}
+	portENTER_CRITICAL(&m_lock);
+	for (Client &client : m_clients) {
+		client = {};
+	}
+	for (Pending &pending : m_pending) {
+		pending.clients = 0;
+	}
+	m_clientCount = 0;
+	m_flushQueued = false;
+	portEXIT_CRITICAL(&m_lock);
+}
+
+/**
+ * @brief Queue a changed reading for the connected clients (any task)
+ * @param address Sensor MAC address
+ * @param reading New reading
+ */
+void SensorStream::publish(const std::string &address, const TPMSUtil &reading) {
+	if (m_clientCount == 0) {
+		return;
+	}
+
+	portENTER_CRITICAL(&m_lock);
+	uint8_t clients = 0;
+	for (size_t slot = 0; slot < MAX_CLIENTS; slot++) {
+		if (m_clients[slot].server != nullptr) {
+			clients |= 1U << slot;
+		}
+	}
+
+	// Same sensor pending: newest reading wins; otherwise the first free entry
+	Pending *entry = nullptr;
+	for (Pending &pending : m_pending) {
+		if (pending.clients != 0 && strncmp(pending.reading.address, address.c_str(),
+											sizeof(pending.reading.address)) == 0) {
+			entry = &pending;
+			break;
+		}
+		if (pending.clients == 0 && entry == nullptr) {
+			entry = &pending;
+		}
+	}
+	if (entry == nullptr || clients == 0) {
+		m_dropped += clients != 0;
+	} else {
+		strlcpy(entry->reading.address, address.c_str(), sizeof(entry->reading.address));
+		entry->reading.pressurePsi = reading.pressurePSI;
+		entry->reading.temperatureC = reading.temperatureC;
+		entry->reading.battery = reading.batteryLevel;
+		entry->clients = clients;
+	}
+	portEXIT_CRITICAL(&m_lock);
+}
+
+/**
+ * @brief Check if a client gets an event or keepalive now (m_lock held)
+ * @param slot Client slot
+ * @param nowUs Current time
+ * @return true if changes are pending and the rate limit allows an event,
+ *         or the client was idle for KEEPALIVE_MS
+ */
+bool SensorStream::isDue(size_t slot, int64_t nowUs) const {
+	const Client &client = m_clients[slot];
+	if (client.server == nullptr) {
+		return false;
+	}
+	const int64_t idleUs = nowUs - client.lastSendUs;
+	if (idleUs >= static_cast<int64_t>(KEEPALIVE_MS) * 1000) {
+		return true;
+	}
+	if (idleUs < static_cast<int64_t>(CLIENT_MIN_INTERVAL_MS) * 1000) {
+		return false;
+	}
+	const uint8_t bit = 1U << slot;
+	for (const Pending &pending : m_pending) {
+		if (pending.clients & bit) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Timer callback (esp_timer task): queue flush() if a client is due
+ * @param arg SensorStream instance
+ * @details At most one flush is queued at a time
+ */
+void SensorStream::timerCallback(void *arg) {
+	SensorStream &stream = *static_cast<SensorStream *>(arg);
+	const int64_t now = esp_timer_get_time();
+
+	httpd_handle_t server = nullptr;
+	portENTER_CRITICAL(&stream.m_lock);
+	if (!stream.m_flushQueued) {
+		for (size_t slot = 0; slot < MAX_CLIENTS; slot++) {
+			if (stream.isDue(slot, now)) {
+				server = stream.m_clients[slot].server;
+				stream.m_flushQueued = true;
+				break;
+			}
+		}
+	}
+	portEXIT_CRITICAL(&stream.m_lock);
+
+	if (server != nullptr && httpd_queue_work(server, flushWork, &stream) != ESP_OK) {
+		portENTER_CRITICAL(&stream.m_lock);
+		stream.m_flushQueued = false;
+		portEXIT_CRITICAL(&stream.m_lock);
+	}
+}
+
+/**
+ * @brief Work item (HTTP server task): send the due events
+ * @param arg SensorStream instance
+ */
+void SensorStream::flushWork(void *arg) {
+	static_cast<SensorStream *>(arg)->flush();
+}
+
+/**
+ * @brief Send events and keepalives to the due clients
+ * @details The pending readings of a client are copied out under the lock
+ *          and formatted without it. A client gets all its pending readings
+ *          in one event, or a keepalive comment when nothing changed.
+ */
+void SensorStream::flush() {
+	const int64_t now = esp_timer_get_time();
+	portENTER_CRITICAL(&m_lock);
+	m_flushQueued = false;
+	portEXIT_CRITICAL(&m_lock);
+
+	for (size_t slot = 0; slot < MAX_CLIENTS; slot++) {
+		Reading readings[MAX_PENDING];
+		size_t count = 0;
+		const uint8_t bit = 1U << slot;
+
+		portENTER_CRITICAL(&m_lock);
+		const Client client = m_clients[slot];
+		const bool due = isDue(slot, now);
+		if (due) {
+			for (Pending &pending : m_pending) {
+				if (pending.clients & bit) {
+					readings[count++] = pending.reading;
+					pending.clients &= ~bit;
+				}
+			}
+		}
+		portEXIT_CRITICAL(&m_lock);
+		if (!due) {
+			continue;
+		}
+
+		char frame[CHUNK_HEADER_SIZE + EVENT_SIZE + CHUNK_TRAILER_SIZE];
+		char *event = frame + CHUNK_HEADER_SIZE;
+		size_t len;
+		if (count > 0) {
+			len = formatUpdate(event, EVENT_SIZE, readings, count);
+		} else {
+			len = strlcpy(event, ": keepalive\n\n", EVENT_SIZE);
+		}
+		if (len == 0 || !sendChunk(client, frame, len)) {
+			continue;
+		}
+
+		portENTER_CRITICAL(&m_lock);
+		if (m_clients[slot].server != nullptr && m_clients[slot].fd == client.fd) {
+			m_clients[slot].lastSendUs = now;
+		}
+		m_eventsSent += count > 0;
+		portEXIT_CRITICAL(&m_lock);
+	}
+}
+
+/**
+ * @brief Write one event as an HTTP chunk to a client socket
+ * @param client Target client
+ * @param frame Buffer holding the event at CHUNK_HEADER_SIZE, with room
+ *              for the trailer behind it
+ * @param len Event length
+ * @return false if the socket failed; the session is closed then
+ * @details The size line is placed right in front of the event, so the
+ *          chunk goes out in a single write (no Nagle delay between parts)
+ */
+bool SensorStream::sendChunk(const Client &client, char *frame, size_t len) {
+	char header[CHUNK_HEADER_SIZE + 1];
+	const int headerLen = snprintf(header, sizeof(header), "%x\r\n", static_cast<unsigned>(len));
+	char *chunk = frame + CHUNK_HEADER_SIZE - headerLen;
+	memcpy(chunk, header, headerLen);
+	memcpy(frame + CHUNK_HEADER_SIZE + len, "\r\n", CHUNK_TRAILER_SIZE);
+
+	const size_t total = headerLen + len + CHUNK_TRAILER_SIZE;
+	size_t sent = 0;
+	while (sent < total) {
+		const int ret = httpd_socket_send(client.server, client.fd, chunk + sent, total - sent, 0);
+		if (ret <= 0) {
+			ESP_LOGW(TAG, "Stream client on socket %d failed (%d), closing", client.fd, ret);
+			httpd_sess_trigger_close(client.server, client.fd);
+			return false;
+		}
+		sent += ret;
+	}
+	return true;
+}
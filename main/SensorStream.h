@@ -0,0 +1,167 @@
+/**
+ * @file SensorStream.h
+ * @brief Server-Sent Events stream of the TPMS readings
+ * @details The configuration page keeps one EventSource connection open
+ *          (GET /api/sensors/stream) instead of polling /api/sensors. The
+ *          connection starts with a snapshot of all sensors; afterwards only
+ *          readings that changed are pushed, at most one event per client
+ *          every CLIENT_MIN_INTERVAL_MS. Changes waiting for a rate limited
+ *          client are coalesced per sensor in a table of MAX_PENDING entries,
+ *          so neither memory nor socket writes grow with the advertisement
+ *          rate.
+ */
+
+#pragma once
+
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class JsonWriter;
+class TPMSUtil;
+
+/**
+ * @class SensorStream
+ * @brief Pushes changed sensor readings to the connected SSE clients
+ * @details Singleton. publish() runs in the NimBLE host task and only updates
+ *          the pending table. A periodic esp_timer (running while clients are
+ *          connected) queues the sends as work on the HTTP server task, where
+ *          the events are written to the client sockets as HTTP chunks.
+ */
+class SensorStream {
+public:
+	static constexpr size_t MAX_CLIENTS = 3;                 ///< Concurrent EventSource connections
+	static constexpr size_t MAX_PENDING = 8;                 ///< Sensors with an unsent change
+	static constexpr uint32_t CLIENT_MIN_INTERVAL_MS = 500;  ///< Least time between events to one client
+	static constexpr uint32_t KEEPALIVE_MS = 15000;          ///< Comment line sent to an idle client
+	static constexpr uint32_t FLUSH_PERIOD_MS = 100;         ///< Check for due clients
+
+	/**
+	 * @brief Writes the JSON of the first "snapshot" event
+	 * @param json Output
+	 */
+	using SnapshotWriter = void (*)(JsonWriter &json);
+
+	/**
+	 * @struct Reading
+	 * @brief One sensor reading as sent to the clients
+	 */
+	struct Reading {
+		char address[18];     ///< MAC address
+		float pressurePsi;    ///< Pressure
+		float temperatureC;   ///< Temperature
+		uint8_t battery;      ///< Battery level, %
+	};
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the SensorStream singleton
+	 */
+	static SensorStream &instance();
+
+	/**
+	 * @brief Take over an HTTP request as event stream (HTTP server task)
+	 * @param req GET /api/sensors/stream request
+	 * @param snapshot Writes the JSON of the first "snapshot" event
+	 * @return ESP_OK if the client was added; an error response was sent otherwise
+	 * @details The response stays open after the handler returns; events are
+	 *          written as further chunks.
+	 */
+	esp_err_t addClient(httpd_req_t *req, SnapshotWriter snapshot);
+
+	/**
+	 * @brief Forget a client whose socket is being closed (HTTP server task)
+	 * @param fd Socket of the session
+	 */
+	void removeClient(int fd);
+
+	/**
+	 * @brief Forget all clients before the server stops
+	 */
+	void disconnectAll();
+
+	/**
+	 * @brief Queue a changed reading for the connected clients (any task)
+	 * @param address Sensor MAC address
+	 * @param reading New reading
+	 * @details Returns at once without clients. A sensor already pending is
+	 *          overwritten; a new sensor is dropped if MAX_PENDING sensors
+	 *          are pending.
+	 */
+	void publish(const std::string &address, const TPMSUtil &reading);
+
+private:
+	SensorStream() = default;
+	~SensorStream() = default;
+
+	SensorStream(const SensorStream &) = delete;
+	SensorStream &operator=(const SensorStream &) = delete;
+
+	/**
+	 * @struct Pending
+	 * @brief Latest unsent reading of one sensor
+	 */
+	struct Pending {
+		Reading reading;  ///< Newest reading
+		uint8_t clients;  ///< Bit per client slot still to be sent this reading, 0 = free entry
+	};
+
+	/**
+	 * @struct Client
+	 * @brief One open event stream
+	 */
+	struct Client {
+		httpd_handle_t server;  ///< Server of the session, nullptr = free slot
+		int fd;                 ///< Session socket
+		int64_t lastSendUs;     ///< Last event or keepalive written
+	};
+
+	static constexpr size_t EVENT_SIZE = 1024;         ///< Largest event, MAX_PENDING readings fit
+	static constexpr size_t SNAPSHOT_CHUNK_SIZE = 256;  ///< Chunk size of the streamed snapshot event
+
+	/**
+	 * @brief Timer callback (esp_timer task): queue flush() if a client is due
+	 * @param arg SensorStream instance
+	 */
+	static void timerCallback(void *arg);
+
+	/**
+	 * @brief Work item (HTTP server task): send the due events
+	 * @param arg SensorStream instance
+	 */
+	static void flushWork(void *arg);
+
+	/**
+	 * @brief Send events and keepalives to the due clients
+	 */
+	void flush();
+
+	/**
+	 * @brief Write one event as an HTTP chunk to a client socket
+	 * @param client Target client
+	 * @param frame Buffer holding the event at CHUNK_HEADER_SIZE
+	 * @param len Event length
+	 * @return false if the socket failed; the session is closed then
+	 */
+	bool sendChunk(const Client &client, char *frame, size_t len);
+
+	/**
+	 * @brief Check if a client gets an event or keepalive now (m_lock held)
+	 * @param slot Client slot
+	 * @param nowUs Current time
+	 * @return true if an event or keepalive is to be sent
+	 */
+	bool isDue(size_t slot, int64_t nowUs) const;
+
+	Client m_clients[MAX_CLIENTS] = {};     ///< Client slots
+	Pending m_pending[MAX_PENDING] = {};    ///< Coalesced changes
+	size_t m_clientCount = 0;               ///< Used client slots
+	bool m_flushQueued = false;             ///< flush() work queued on the server task
+	esp_timer_handle_t m_timer = nullptr;   ///< FLUSH_PERIOD_MS timer, running with clients
+	uint32_t m_eventsSent = 0;              ///< Update events sent since boot
+	uint32_t m_dropped = 0;                 ///< Changes dropped, pending table full
+	portMUX_TYPE m_lock = portMUX_INITIALIZER_UNLOCKED;  ///< Guards clients and pending table
+};
@@ -19,6 +19,87 @@ State &State::getInstance() {
 	return instance;
 }
 
+/**
+ * @brief Constructor, creates the mutex
+ */
+State::State() : m_mutex(xSemaphoreCreateRecursiveMutex()) {
+}
+
+/**
+ * @brief Get front sensor MAC address
+ * @return Copy taken under the mutex
+ */
+std::string State::getFrontAddress() const {
+	xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+	std::string address = m_frontAddress;
+	xSemaphoreGiveRecursive(m_mutex);
+	return address;
+}
+
+/**
+ * @brief Set front sensor MAC address
+ * @param address MAC address, empty = not paired
+ */
+void State::setFrontAddress(const std::string& address) {
+	xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+	m_frontAddress = address;
+	xSemaphoreGiveRecursive(m_mutex);
+}
+
+/**
+ * @brief Get rear sensor MAC address
+ * @return Copy taken under the mutex
+ */
+std::string State::getRearAddress() const {
+	xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+	std::string address = m_rearAddress;
+	xSemaphoreGiveRecursive(m_mutex);
+	return address;
+}
+
+/**
+ * @brief Set rear sensor MAC address
+ * @param address MAC address, empty = not paired
+ */
+void State::setRearAddress(const std::string& address) {
+	xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+	m_rearAddress = address;
+	xSemaphoreGiveRecursive(m_mutex);
+}
+
+/**
+ * @brief Check if a reading belongs to the paired sensors
+ * @param address Sensor MAC address
+ * @return true for the front/rear sensor, and for every sensor while unpaired
+ */
+bool State::isOwnSensor(const std::string& address) const {
+	xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+	const bool own = !m_isPaired || address == m_frontAddress || address == m_rearAddress;
+	xSemaphoreGiveRecursive(m_mutex);
+	return own;
+}
+
+/**
+ * @brief Get pressure unit preference
+ * @return "PSI" or "BAR", copy taken under the mutex
+ */
+std::string State::getPressureUnit() const {
+	xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+	std::string unit = m_pressureUnit;
+	xSemaphoreGiveRecursive(m_mutex);
+	return unit;
+}
+
+/**
+ * @brief Set pressure unit preference
+ * @param unit "PSI" or "BAR"
+ */
+void State::setPressureUnit(const std::string& unit) {
+	xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY);
+	m_pressureUnit = unit;
+	xSemaphoreGiveRecursive(m_mutex);
+}
+
 /**
  * @brief Remove stale sensor data from the map
  * @details Iterates through all sensors and removes those that haven't
@@ -36,6 +117,7 @@ void State::cleanupOldSensors() {
 	uint64_t threshold = 60000 * 7;
 
 	int removedCount = 0;
+	lock();
 	auto it = m_data.begin();
 	
 	// Iterate through all sensors
@@ -53,6 +135,8 @@ void State::cleanupOldSensors() {
 			++it; // Sensor is still valid, check next
 		}
 	}
+	const size_t remaining = m_data.size();
+	unlock();
 
 	// Log cleanup statistics if any sensors were removed
 	if (removedCount > 0) {
@@ -64,6 +148,6 @@ void State::cleanupOldSensors() {
 
 		ESP_LOGI(TAG, "[%02d:%02d:%02d] Cleanup complete: removed %d sensors, %zu "
 			   "sensors remaining in map",
-			   hours, minutes, seconds, removedCount, m_data.size());
+			   hours, minutes, seconds, removedCount, remaining);
 	}
 }
@@ -13,6 +13,8 @@
 #define STATE_H
 
 #include "TPMSUtil.h"         // TPMS sensor data structures
+#include "freertos/FreeRTOS.h" // FreeRTOS types
+#include "freertos/semphr.h"   // Mutex
 #include <string>              // std::string
 #include <unordered_map>       // std::unordered_map
 
@@ -26,7 +28,12 @@
  *          - Alert state for UI feedback
  *          - Pressure unit preference (PSI/BAR)
  * 
- * Thread-safety: Not thread-safe. Access from single task or use LVGL async calls.
+ * Thread-safety: The string settings (addresses, pressure unit) are guarded
+ * by a mutex: they are replaced by the config listener on the committing
+ * task (control task or web server) while the BLE and LVGL tasks read them.
+ * Getters therefore return copies. The same mutex guards the sensor map,
+ * which the BLE task updates while the LVGL task and the web server read
+ * it: hold lock() while using getData() or a TPMSUtil from it.
  */
 class State {
 public:
@@ -43,22 +50,39 @@ public:
 	 */
 	void cleanupOldSensors();
 	
+	/**
+	 * @brief Lock the sensor map (any task, recursive)
+	 * @details Hold while using getData() or a TPMSUtil from it, and release
+	 *          before anything that can block (e.g. socket writes)
+	 */
+	void lock() const { xSemaphoreTakeRecursive(m_mutex, portMAX_DELAY); }
+	/** @brief Unlock the sensor map */
+	void unlock() const { xSemaphoreGiveRecursive(m_mutex); }
+	
 	// Getters and Setters
 	
-	/** @brief Get sensor data map (const version) */
+	/** @brief Get sensor data map (const version, lock() held) */
 	const std::unordered_map<std::string, TPMSUtil *>& getData() const { return m_data; }
-	/** @brief Get sensor data map (mutable version) */
+	/** @brief Get sensor data map (mutable version, lock() held) */
 	std::unordered_map<std::string, TPMSUtil *>& getData() { return m_data; }
 	
-	/** @brief Get front sensor MAC address */
-	const std::string& getFrontAddress() const { return m_frontAddress; }
-	/** @brief Set front sensor MAC address */
-	void setFrontAddress(const std::string& address) { m_frontAddress = address; }
+	/** @brief Get front sensor MAC address (copy, any task) */
+	std::string getFrontAddress() const;
+	/** @brief Set front sensor MAC address (any task) */
+	void setFrontAddress(const std::string& address);
 	
-	/** @brief Get rear sensor MAC address */
-	const std::string& getRearAddress() const { return m_rearAddress; }
-	/** @brief Set rear sensor MAC address */
-	void setRearAddress(const std::string& address) { m_rearAddress = address; }
+	/** @brief Get rear sensor MAC address (copy, any task) */
+	std::string getRearAddress() const;
+	/** @brief Set rear sensor MAC address (any task) */
+	void setRearAddress(const std::string& address);
+	
+	/**
+	 * @brief Check if a reading belongs to the paired sensors
+	 * @param address Sensor MAC address
+	 * @return true for the front/rear sensor, and for every sensor while unpaired
+	 * @details Compares under the mutex without copying the addresses
+	 */
+	bool isOwnSensor(const std::string& address) const;
 	
 	/** @brief Check if system is in alert state (low/high pressure warning) */
 	bool getIsInAlertState() const { return m_isInAlertState; }
@@ -80,13 +104,13 @@ public:
 	/** @brief Set ideal rear tire pressure in PSI */
 	void setRearIdealPSI(float psi) { m_rearIdealPSI = psi; }
 	
-	/** @brief Get pressure unit preference ("PSI" or "BAR") */
-	const std::string& getPressureUnit() const { return m_pressureUnit; }
-	/** @brief Set pressure unit preference */
-	void setPressureUnit(const std::string& unit) { m_pressureUnit = unit; }
+	/** @brief Get pressure unit preference ("PSI" or "BAR", copy, any task) */
+	std::string getPressureUnit() const;
+	/** @brief Set pressure unit preference (any task) */
+	void setPressureUnit(const std::string& unit);
 
 private:
-	State() = default;                           ///< Private constructor for singleton
+	State();                                     ///< Private constructor for singleton
 	State(const State &) = delete;               ///< No copy constructor
 	State &operator=(const State &) = delete;    ///< No copy assignment
 	State(State &&) = delete;                    ///< No move constructor
@@ -101,6 +125,7 @@ private:
 	float m_frontIdealPSI = 0.0f;                        ///< Target front tire pressure (PSI)
 	float m_rearIdealPSI = 0.0f;                         ///< Target rear tire pressure (PSI)
 	std::string m_pressureUnit = "PSI";                  ///< Display unit: "PSI" or "BAR"
+	SemaphoreHandle_t m_mutex = nullptr;                 ///< Guards the strings and m_data (recursive)
 };
 
 #endif // STATE_H
\ No newline at end of file
@@ -0,0 +1,386 @@
+/**
+ * @file StaticLayerCache.cpp
+ * @brief Cached RGB565 background layer implementation
+ * @details Splits the draw tasks of a screen into a static set, rendered once
+ *          with lv_snapshot into an RGB565 buffer, and a dynamic set drawn
+ *          on every refresh on top of that buffer.
+ */
+
+#include "StaticLayerCache.h"
+#include "src/misc/cache/instance/lv_image_cache.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <cstring>
+
+static const char *TAG = "StaticLayer";
+
+/**
+ * @brief FNV-1a hash step over a block of memory
+ * @param hash Running hash
+ * @param data Data to hash
+ * @param len Length in bytes
+ * @return Updated hash
+ */
+static uint32_t hashBytes(uint32_t hash, const void *data, size_t len) {
+	const uint8_t *p = static_cast<const uint8_t *>(data);
+	for (size_t i = 0; i < len; i++) {
+		hash ^= p[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * @brief Hash a single value (field by field, so struct padding is never hashed)
+ */
+template <typename T>
+static uint32_t hashValue(uint32_t hash, const T &value) {
+	return hashBytes(hash, &value, sizeof(value));
+}
+
+/**
+ * @brief Mark a whole widget as static
+ * @param obj Direct child of the screen
+ */
+void StaticLayerCache::addStatic(lv_obj_t *obj) {
+	addStaticPart(obj, LV_PART_ANY);
+}
+
+/**
+ * @brief Mark one part of a widget as static
+ * @param obj Direct child of the screen
+ * @param part Static part, LV_PART_ANY for the whole widget
+ * @details Static widgets report their draw tasks (for signatures and
+ *          dropping) and style changes (for invalidation).
+ */
+void StaticLayerCache::addStaticPart(lv_obj_t *obj, lv_part_t part) {
+	if (m_entryCount >= MAX_ENTRIES) {
+		ESP_LOGE(TAG, "Too many static widgets (max %d)", MAX_ENTRIES);
+		return;
+	}
+	m_entries[m_entryCount++] = {obj, part};
+
+	lv_obj_add_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+	lv_obj_add_event_cb(obj, drawTaskCallback, LV_EVENT_DRAW_TASK_ADDED, this);
+	lv_obj_add_event_cb(obj, styleChangedCallback, LV_EVENT_STYLE_CHANGED, this);
+}
+
+/**
+ * @brief Allocate the layer buffer and hook the screen's children
+ * @param screen Screen whose static widgets were registered
+ * @return true on success
+ * @details The buffer is too large for the LVGL heap (LV_MEM_SIZE), so it
+ *          is allocated from the system heap and wrapped in an lv_draw_buf_t.
+ *          Every child gets a DRAW_MAIN/DRAW_POST preprocess filter that
+ *          suppresses the dynamic widgets while the layer is captured.
+ */
+bool StaticLayerCache::attach(lv_obj_t *screen) {
+	const int32_t w = lv_obj_get_width(screen);
+	const int32_t h = lv_obj_get_height(screen);
+	const uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+	const uint32_t size = stride * h;
+
+	void *data = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (data == nullptr) {
+		ESP_LOGE(TAG, "Failed to allocate %lu byte static layer, drawing normally", size);
+		return false;
+	}
+	lv_draw_buf_init(&m_drawBuf, w, h, LV_COLOR_FORMAT_RGB565, stride, data, size);
+
+	m_screen = screen;
+	const uint32_t childCount = lv_obj_get_child_count(screen);
+	for (uint32_t i = 0; i < childCount; i++) {
+		lv_obj_t *child = lv_obj_get_child(screen, i);
+		lv_obj_add_event_cb(child, drawFilterCallback,
+							static_cast<lv_event_code_t>(LV_EVENT_DRAW_MAIN | LV_EVENT_PREPROCESS), this);
+		lv_obj_add_event_cb(child, drawFilterCallback,
+							static_cast<lv_event_code_t>(LV_EVENT_DRAW_POST | LV_EVENT_PREPROCESS), this);
+	}
+
+	ESP_LOGI(TAG, "Static layer %ldx%ld (%lu bytes), %d static widgets",
+			 w, h, size, m_entryCount);
+	invalidate();
+	return true;
+}
+
+/**
+ * @brief Schedule a re-render of the layer in the LVGL task
+ */
+void StaticLayerCache::invalidate() {
+	m_valid = false;
+	if (m_screen == nullptr || m_renderPending) {
+		return;
+	}
+	m_renderPending = true;
+	lv_async_call(renderCallback, this);
+}
+
+/**
+ * @brief Async render trampoline
+ * @param arg StaticLayerCache instance
+ */
+void StaticLayerCache::renderCallback(void *arg) {
+	static_cast<StaticLayerCache *>(arg)->render();
+}
+
+/**
+ * @brief Capture the static widgets into the layer buffer
+ * @details The layer image is hidden during the snapshot so it is neither
+ *          chosen as the covering top object nor drawn into itself. Hiding
+ *          and showing it again invalidates the whole screen, which also
+ *          repaints the areas whose static content changed.
+ */
+void StaticLayerCache::render() {
+	m_renderPending = false;
+
+	if (m_layerImage != nullptr) {
+		lv_obj_add_flag(m_layerImage, LV_OBJ_FLAG_HIDDEN);
+	}
+
+	const int64_t startUs = esp_timer_get_time();
+	m_capturing = true;
+	m_signatureCount = 0;
+	lv_result_t res = lv_snapshot_take_to_draw_buf(m_screen, LV_COLOR_FORMAT_RGB565, &m_drawBuf);
+	m_capturing = false;
+	const uint32_t renderUs = static_cast<uint32_t>(esp_timer_get_time() - startUs);
+
+	if (res != LV_RESULT_OK) {
+		ESP_LOGE(TAG, "Static layer snapshot failed");
+		if (m_layerImage != nullptr) {
+			lv_obj_delete(m_layerImage);
+			m_layerImage = nullptr;
+		}
+		return;
+	}
+
+	if (m_layerImage == nullptr) {
+		// Created after the children were hooked: never filtered, never static
+		m_layerImage = lv_image_create(m_screen);
+		lv_obj_remove_flag(m_layerImage, LV_OBJ_FLAG_CLICKABLE);
+		lv_obj_remove_flag(m_layerImage, LV_OBJ_FLAG_SCROLLABLE);
+		lv_obj_set_pos(m_layerImage, 0, 0);
+		lv_obj_move_to_index(m_layerImage, 0);
+		lv_obj_add_flag(m_layerImage, LV_OBJ_FLAG_HIDDEN);
+	}
+
+	lv_image_cache_drop(&m_drawBuf);
+	lv_image_set_src(m_layerImage, &m_drawBuf);
+	lv_obj_remove_flag(m_layerImage, LV_OBJ_FLAG_HIDDEN);
+	lv_obj_invalidate(m_screen);
+
+	m_valid = true;
+	m_renderCount++;
+	ESP_LOGI(TAG, "Static layer rendered in %lu us (%d draw tasks, render #%lu)",
+			 renderUs, m_signatureCount, m_renderCount);
+}
+
+/**
+ * @brief Check whether a widget part belongs to the static layer
+ * @param obj Widget
+ * @param part Part being drawn
+ * @return true if the part is rendered into the cached layer
+ */
+bool StaticLayerCache::isStatic(const lv_obj_t *obj, lv_part_t part) const {
+	for (uint8_t i = 0; i < m_entryCount; i++) {
+		if (m_entries[i].obj == obj &&
+			(m_entries[i].part == LV_PART_ANY || m_entries[i].part == part)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Skip dynamic widgets while the layer is captured
+ * @param e LVGL event (DRAW_MAIN/DRAW_POST, preprocess)
+ * @details Partially static widgets are still drawn; their dynamic parts are
+ *          dropped per draw task in drawTaskCallback().
+ */
+void StaticLayerCache::drawFilterCallback(lv_event_t *e) {
+	StaticLayerCache *self = static_cast<StaticLayerCache *>(lv_event_get_user_data(e));
+	if (!self->m_capturing) {
+		return;
+	}
+
+	lv_obj_t *obj = static_cast<lv_obj_t *>(lv_event_get_current_target(e));
+	for (uint8_t i = 0; i < self->m_entryCount; i++) {
+		if (self->m_entries[i].obj == obj) {
+			return;
+		}
+	}
+	lv_event_stop_processing(e);
+}
+
+/**
+ * @brief Route a static widget's draw task to the layer or the screen
+ * @param e LVGL event (DRAW_TASK_ADDED)
+ * @details Capture: record static tasks, drop dynamic parts.
+ *          Refresh: drop static tasks (the layer has their pixels) and
+ *          schedule a re-render if one does not match the last capture.
+ */
+void StaticLayerCache::drawTaskCallback(lv_event_t *e) {
+	StaticLayerCache *self = static_cast<StaticLayerCache *>(lv_event_get_user_data(e));
+	lv_draw_task_t *task = lv_event_get_draw_task(e);
+	const lv_draw_dsc_base_t *base =
+		static_cast<const lv_draw_dsc_base_t *>(lv_draw_task_get_draw_dsc(task));
+	const bool isStaticPart = self->isStatic(base->obj, static_cast<lv_part_t>(base->part));
+
+	if (self->m_capturing) {
+		if (!isStaticPart) {
+			dropDrawTask(task);
+		} else if (self->m_signatureCount < MAX_SIGNATURES) {
+			self->m_signatures[self->m_signatureCount++] = drawTaskSignature(task);
+		}
+		return;
+	}
+
+	if (!isStaticPart || !self->m_valid) {
+		return;
+	}
+
+	const uint32_t signature = drawTaskSignature(task);
+	bool known = false;
+	for (uint8_t i = 0; i < self->m_signatureCount; i++) {
+		if (self->m_signatures[i] == signature) {
+			known = true;
+			break;
+		}
+	}
+	dropDrawTask(task);
+	if (!known) {
+		ESP_LOGD(TAG, "Static widget changed, re-rendering layer");
+		self->invalidate();
+	}
+}
+
+/**
+ * @brief Re-render the layer when a static widget's style changes
+ * @param e LVGL event (STYLE_CHANGED, also sent on theme changes)
+ */
+void StaticLayerCache::styleChangedCallback(lv_event_t *e) {
+	StaticLayerCache *self = static_cast<StaticLayerCache *>(lv_event_get_user_data(e));
+	self->invalidate();
+}
+
+/**
+ * @brief Compute a signature of everything that affects a draw task's pixels
+ * @param task Draw task of a static widget
+ * @return 32-bit FNV-1a hash
+ */
+uint32_t StaticLayerCache::drawTaskSignature(lv_draw_task_t *task) {
+	const lv_draw_task_type_t type = lv_draw_task_get_type(task);
+	const lv_draw_dsc_base_t *base =
+		static_cast<const lv_draw_dsc_base_t *>(lv_draw_task_get_draw_dsc(task));
+	lv_area_t area;
+	lv_draw_task_get_area(task, &area);
+
+	uint32_t hash = 2166136261u;
+	hash = hashValue(hash, type);
+	hash = hashValue(hash, base->obj);
+	hash = hashValue(hash, base->part);
+	hash = hashValue(hash, base->id1);
+	hash = hashValue(hash, base->id2);
+	hash = hashValue(hash, area);
+
+	switch (type) {
+	case LV_DRAW_TASK_TYPE_FILL: {
+		const lv_draw_fill_dsc_t *dsc = lv_draw_task_get_fill_dsc(task);
+		hash = hashValue(hash, dsc->color);
+		hash = hashValue(hash, dsc->opa);
+		hash = hashValue(hash, dsc->radius);
+		break;
+	}
+	case LV_DRAW_TASK_TYPE_BORDER: {
+		const lv_draw_border_dsc_t *dsc = lv_draw_task_get_border_dsc(task);
+		hash = hashValue(hash, dsc->color);
+		hash = hashValue(hash, dsc->width);
+		hash = hashValue(hash, dsc->opa);
+		break;
+	}
+	case LV_DRAW_TASK_TYPE_BOX_SHADOW: {
+		const lv_draw_box_shadow_dsc_t *dsc = lv_draw_task_get_box_shadow_dsc(task);
+		hash = hashValue(hash, dsc->color);
+		hash = hashValue(hash, dsc->width);
+		hash = hashValue(hash, dsc->spread);
+		hash = hashValue(hash, dsc->opa);
+		break;
+	}
+	case LV_DRAW_TASK_TYPE_LABEL: {
+		const lv_draw_label_dsc_t *dsc = lv_draw_task_get_label_dsc(task);
+		if (dsc->text != nullptr) {
+			const size_t len = dsc->text_length ? dsc->text_length : strlen(dsc->text);
+			hash = hashBytes(hash, dsc->text, len);
+		}
+		hash = hashValue(hash, dsc->font);
+		hash = hashValue(hash, dsc->color);
+		hash = hashValue(hash, dsc->opa);
+		break;
+	}
+	case LV_DRAW_TASK_TYPE_IMAGE: {
+		const lv_draw_image_dsc_t *dsc = lv_draw_task_get_image_dsc(task);
+		hash = hashValue(hash, dsc->src);
+		hash = hashValue(hash, dsc->rotation);
+		hash = hashValue(hash, dsc->scale_x);
+		hash = hashValue(hash, dsc->scale_y);
+		hash = hashValue(hash, dsc->recolor);
+		hash = hashValue(hash, dsc->recolor_opa);
+		hash = hashValue(hash, dsc->opa);
+		break;
+	}
+	case LV_DRAW_TASK_TYPE_ARC: {
+		const lv_draw_arc_dsc_t *dsc = lv_draw_task_get_arc_dsc(task);
+		hash = hashValue(hash, dsc->color);
+		hash = hashValue(hash, dsc->width);
+		hash = hashValue(hash, dsc->start_angle);
+		hash = hashValue(hash, dsc->end_angle);
+		hash = hashValue(hash, dsc->radius);
+		hash = hashValue(hash, dsc->opa);
+		break;
+	}
+	default:
+		break;
+	}
+	return hash;
+}
+
+/**
+ * @brief Turn a draw task into a no-op
+ * @param task Draw task to suppress
+ * @details Tasks cannot be removed from the layer once added, so their
+ *          opacity is cleared (the software renderers return early on
+ *          transparent tasks). Image transforms are reset as well so a
+ *          dropped rotated/scaled image does not run the transform path.
+ */
+void StaticLayerCache::dropDrawTask(lv_draw_task_t *task) {
+	switch (lv_draw_task_get_type(task)) {
+	case LV_DRAW_TASK_TYPE_FILL:
+		lv_draw_task_get_fill_dsc(task)->opa = LV_OPA_TRANSP;
+		break;
+	case LV_DRAW_TASK_TYPE_BORDER:
+		lv_draw_task_get_border_dsc(task)->opa = LV_OPA_TRANSP;
+		break;
+	case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+		lv_draw_task_get_box_shadow_dsc(task)->opa = LV_OPA_TRANSP;
+		break;
+	case LV_DRAW_TASK_TYPE_LABEL:
+		lv_draw_task_get_label_dsc(task)->opa = LV_OPA_TRANSP;
+		break;
+	case LV_DRAW_TASK_TYPE_IMAGE: {
+		lv_draw_image_dsc_t *dsc = lv_draw_task_get_image_dsc(task);
+		dsc->opa = LV_OPA_TRANSP;
+		dsc->rotation = 0;
+		dsc->scale_x = LV_SCALE_NONE;
+		dsc->scale_y = LV_SCALE_NONE;
+		break;
+	}
+	case LV_DRAW_TASK_TYPE_ARC:
+		lv_draw_task_get_arc_dsc(task)->opa = LV_OPA_TRANSP;
+		break;
+	case LV_DRAW_TASK_TYPE_LINE:
+		lv_draw_task_get_line_dsc(task)->opa = LV_OPA_TRANSP;
+		break;
+	default:
+		break;
+	}
+}
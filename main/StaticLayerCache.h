@@ -0,0 +1,123 @@
+/**
+ * @file StaticLayerCache.h
+ * @brief Cached RGB565 background layer for a screen
+ * @details Renders the static part of a screen (background, fixed labels,
+ *          decorative images, arc tracks) once into an RGB565 buffer that is
+ *          shown as a full-screen image behind the other widgets. Refreshes
+ *          then blit the cached pixels and only the dynamic widgets are drawn
+ *          on top of them.
+ */
+
+#pragma once
+
+#include "lvgl.h"
+#include <cstdint>
+
+#ifndef UI_STATIC_LAYER_CACHE
+#define UI_STATIC_LAYER_CACHE 0     ///< 1 = cache the static widgets of ui_Main in an RGB565 layer
+#endif
+
+/**
+ * @class StaticLayerCache
+ * @brief Pre-rendered static layer of one screen
+ * @details Usage:
+ *          - Register static widgets with addStatic() (whole widget) or
+ *            addStaticPart() (only one part, e.g. the track of an arc)
+ *          - Call attach() once with the screen; the layer is rendered
+ *            asynchronously in the LVGL task
+ *
+ *          Normal refresh: draw tasks of static widgets/parts are dropped,
+ *          the cached image (first child of the screen, covers the whole
+ *          screen) provides their pixels.
+ *          Capture: the screen is snapshotted with only the static widgets
+ *          and parts drawn.
+ *
+ *          Invalidation is automatic:
+ *          - LV_EVENT_STYLE_CHANGED on a static widget (style or theme change)
+ *          - A dropped static draw task whose signature (area, color, text,
+ *            image source, ...) was not seen during the last capture, e.g.
+ *            after lv_label_set_text() on a static label (unit switch)
+ *          The changed frame shows the stale cache once; the layer is then
+ *          re-rendered and the whole screen invalidated.
+ *
+ *          Only direct children of the screen are considered. The layer is
+ *          composited below all dynamic widgets, so a static widget must not
+ *          visibly overlap a dynamic widget that comes before it in z-order.
+ *          Memory: one RGB565 frame (115 KB for 240x240) from the system heap.
+ */
+class StaticLayerCache {
+public:
+	/**
+	 * @brief Mark a whole widget as static
+	 * @param obj Direct child of the screen
+	 */
+	void addStatic(lv_obj_t *obj);
+
+	/**
+	 * @brief Mark one part of a widget as static
+	 * @param obj Direct child of the screen
+	 * @param part Static part (e.g. LV_PART_MAIN of an arc); other parts stay dynamic
+	 */
+	void addStaticPart(lv_obj_t *obj, lv_part_t part);
+
+	/**
+	 * @brief Allocate the layer and hook the screen's children
+	 * @param screen Screen whose static widgets were registered
+	 * @return true on success, false if the layer buffer could not be allocated
+	 *         (the screen is then drawn normally)
+	 * @details Must be called after all addStatic()/addStaticPart() calls,
+	 *          from the LVGL task or before it is started.
+	 */
+	bool attach(lv_obj_t *screen);
+
+	/**
+	 * @brief Schedule a re-render of the layer
+	 * @details Called automatically on static widget changes; can be used
+	 *          after changes the automatic detection cannot see.
+	 */
+	void invalidate();
+
+	/**
+	 * @brief Number of layer renders since attach()
+	 */
+	uint32_t getRenderCount() const { return m_renderCount; }
+
+private:
+	/**
+	 * @struct StaticEntry
+	 * @brief Registered static widget or widget part
+	 */
+	struct StaticEntry {
+		lv_obj_t *obj;   ///< Widget
+		lv_part_t part;  ///< Static part, LV_PART_ANY for the whole widget
+	};
+
+	static constexpr uint8_t MAX_ENTRIES = 8;      ///< Registered widgets/parts
+	static constexpr uint8_t MAX_SIGNATURES = 32;  ///< Static draw tasks per capture
+
+	// LVGL callbacks
+	static void drawFilterCallback(lv_event_t *e);   ///< DRAW_MAIN/POST preprocess on every child
+	static void drawTaskCallback(lv_event_t *e);     ///< DRAW_TASK_ADDED on static widgets
+	static void styleChangedCallback(lv_event_t *e); ///< STYLE_CHANGED on static widgets
+	static void renderCallback(void *arg);           ///< Async layer render
+
+	void render();
+	bool isStatic(const lv_obj_t *obj, lv_part_t part) const;
+	static uint32_t drawTaskSignature(lv_draw_task_t *task);
+	static void dropDrawTask(lv_draw_task_t *task);
+
+	lv_obj_t *m_screen = nullptr;         ///< Owning screen
+	lv_obj_t *m_layerImage = nullptr;     ///< Full-screen image showing the cached layer
+	lv_draw_buf_t m_drawBuf = {};         ///< RGB565 layer (data on the system heap)
+
+	StaticEntry m_entries[MAX_ENTRIES] = {};  ///< Static widgets/parts
+	uint8_t m_entryCount = 0;
+
+	uint32_t m_signatures[MAX_SIGNATURES] = {};  ///< Static draw tasks of the last capture
+	uint8_t m_signatureCount = 0;
+
+	bool m_valid = false;           ///< Layer content matches the static widgets
+	bool m_capturing = false;       ///< Snapshot in progress
+	bool m_renderPending = false;   ///< Async render already scheduled
+	uint32_t m_renderCount = 0;     ///< Renders since attach()
+};
@@ -4,9 +4,13 @@
  */
 
 #include "TPMSScanCallbacks.h"
+#include "BacklightController.h" // Inactivity tracking
+#include "SensorStream.h"    // Web page live readings
 #include "State.h"           // Global state singleton
 #include "TPMSUtil.h"        // TPMS data parser
 #include "esp_log.h"         // ESP logging
+#include "esp_timer.h"       // Latency timestamps
+#include "lvgl.h"            // Profiler trace points
 #include <NimBLEDevice.h>    // BLE library
 #include <string>            // std::string
 
@@ -21,11 +25,17 @@ static const char* TAG = "TPMSScan";
  *          2. Validate TPMS sensor format using TPMSUtil::isTPMSSensor() - raw pointer version
  *          3. Parse sensor data (pressure, temperature, battery, etc.)
  *          4. Add or update sensor in State map by MAC address
- *          5. Log sensor details with timestamp
+ *          5. Report activity to the backlight for the paired sensors
+ *          6. Push new or changed readings to the web page stream
+ *          7. Log sensor details with timestamp
+ *          The reading is stamped on arrival and when stored for the
+ *          sensor-to-pixel latency (LatencyTracker).
  *          Note: Uses raw pointer validation to avoid std::string copy overhead in callback
  */
 void TPMSScanCallbacks::onDiscovered(
     const NimBLEAdvertisedDevice *advertisedDevice) {
+    // Called from NimBLE's GAP event handler: the reading's ingress time
+    const int64_t ingressUs = esp_timer_get_time();
 
     // Extract manufacturer-specific data from BLE advertisement (raw pointer)
     std::string manufacturerData = advertisedDevice->getManufacturerData();
@@ -35,19 +45,28 @@ void TPMSScanCallbacks::onDiscovered(
     // Validates: length=18, header 0x00 0x01, magic 0xEA 0xCA, sensor >= 0x80
     if (TPMSUtil::isTPMSSensor(rawData, manufacturerData.size())) {
         // Parse sensor data into TPMSUtil object
+        LV_PROFILER_BEGIN_TAG("advert_decode");
         TPMSUtil *sensor = TPMSUtil::parse(
             manufacturerData, advertisedDevice->getAddress().toString());
+        LV_PROFILER_END_TAG("advert_decode");
+        sensor->setIngressUs(ingressUs);
 
         // Add or update sensor in global state
+        LV_PROFILER_BEGIN_TAG("state_update");
         State& state = State::getInstance();
         std::string address = advertisedDevice->getAddress().toString();
         
         bool isNewSensor = false;
         bool dataChanged = false;
         
+        // The LVGL task and the web server read the map and the stored
+        // readings; replaced readings are deleted here
+        state.lock();
+        
         // Check if sensor already exists in map
         if (!state.getData().contains(address)) {
             // New sensor - add to map
+            sensor->setStoredUs(esp_timer_get_time());
             state.getData()[address] = sensor;
             isNewSensor = true;
         } else {
@@ -61,11 +80,20 @@ void TPMSScanCallbacks::onDiscovered(
                          (existingSensor->alert != sensor->alert);
             
             delete existingSensor;
+            sensor->setStoredUs(esp_timer_get_time());
             state.getData()[address] = sensor;
         }
+        LV_PROFILER_END_TAG("state_update");
+        
+        // Readings from our own sensors (any sensor while pairing) keep the backlight on
+        if (state.isOwnSensor(address)) {
+            BacklightController::instance().notifyActivity();
+        }
         
-        // Log only on new sensor or significant data change (not every advertisement)
+        // Log and stream only on new sensor or significant data change (not every advertisement)
         if (isNewSensor || dataChanged) {
+            SensorStream::instance().publish(address, *sensor);
+
             // Format timestamp as HH:MM:SS for log message
             uint64_t total_seconds = sensor->timestamp / 1000ULL;
             int hours = (total_seconds / 3600) % 24;
@@ -83,6 +111,7 @@ void TPMSScanCallbacks::onDiscovered(
                    sensor->identifier[2], sensor->sensorNumber, sensor->pressurePSI,
                    sensor->temperatureC, sensor->batteryLevel, sensor->alert);
         }
+        state.unlock();
 
         // IMPORTANT: Do NOT delete sensor - it's now owned by state.getData() map
     }
@@ -97,6 +97,18 @@ public:
 	/** @brief Get timestamp of last update (milliseconds since boot) */
 	uint64_t getTimestamp() const { return m_timestamp; }
 	
+	/** @brief Get the time the advertisement of this reading arrived (us since boot, 0 = unknown) */
+	int64_t getIngressUs() const { return m_ingressUs; }
+
+	/** @brief Get the time this reading was stored in State (us since boot) */
+	int64_t getStoredUs() const { return m_storedUs; }
+
+	/** @brief Set the time the advertisement of this reading arrived (us since boot) */
+	void setIngressUs(int64_t us) { m_ingressUs = us; }
+
+	/** @brief Set the time this reading was stored in State (us since boot) */
+	void setStoredUs(int64_t us) { m_storedUs = us; }
+
 	/** @brief Get sensor MAC address */
 	const std::string& getAddress() const { return m_address; }
 
@@ -154,6 +166,8 @@ private:
 	char m_batteryLevel;               ///< Battery level (0-255)
 	bool m_alert;                      ///< Alert flag
 	uint64_t m_timestamp;              ///< Last update timestamp (ms)
+	int64_t m_ingressUs = 0;           ///< Advertisement arrival, sensor-to-pixel latency
+	int64_t m_storedUs = 0;            ///< Stored in State, sensor-to-pixel latency
 };
 
 #endif /* MAIN_TPMSUTIL_H_ */
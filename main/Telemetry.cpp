@@ -0,0 +1,270 @@
+/**
+ * @file Telemetry.cpp
+ * @brief Per-task CPU, stack and heap telemetry implementation
+ */
+
+// The report is logged at INFO. The committed sdkconfig compiles out
+// everything below ERROR, so this file keeps its INFO lines.
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+
+#include "Telemetry.h"
+#include "LatencyTracker.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include <cstdio>
+#include <cstring>
+
+#if !CONFIG_FREERTOS_USE_TRACE_FACILITY || !CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+#error "Telemetry needs CONFIG_FREERTOS_USE_TRACE_FACILITY and CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS"
+#endif
+
+static const char *TAG = "Telemetry";
+
+/// One letter per eTaskState, like vTaskList()
+static const char TASK_STATES[] = {'X', 'R', 'B', 'S', 'D'};
+
+/**
+ * @brief Read the statistics of the heap regions with given capabilities
+ * @param caps MALLOC_CAP_* flags
+ * @return Free, minimum free and largest free block
+ */
+static Telemetry::HeapInfo readHeap(uint32_t caps) {
+	Telemetry::HeapInfo info;
+	info.freeBytes = heap_caps_get_free_size(caps);
+	info.minFreeBytes = heap_caps_get_minimum_free_size(caps);
+	info.largestBlock = heap_caps_get_largest_free_block(caps);
+	return info;
+}
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the Telemetry singleton
+ */
+Telemetry &Telemetry::instance() {
+	static Telemetry telemetry;
+	return telemetry;
+}
+
+/**
+ * @brief Start the sampling task
+ * @details The task runs just above idle so sampling never delays the UI or
+ *          BLE; its own share shows up in the samples.
+ */
+void Telemetry::start() {
+	if (m_task != nullptr) {
+		return;
+	}
+	m_mutex = xSemaphoreCreateMutex();
+	if (m_mutex == nullptr) {
+		ESP_LOGE(TAG, "Failed to create mutex");
+		return;
+	}
+	if (xTaskCreate(taskWrapper, "telemetry", TASK_STACK_SIZE, this,
+					tskIDLE_PRIORITY + 1, &m_task) != pdPASS) {
+		ESP_LOGE(TAG, "Failed to create telemetry task");
+		m_task = nullptr;
+	}
+}
+
+/**
+ * @brief Sampling task entry point
+ * @param param Telemetry instance
+ */
+void Telemetry::taskWrapper(void *param) {
+	Telemetry *self = static_cast<Telemetry *>(param);
+	TickType_t lastWake = xTaskGetTickCount();
+	uint32_t samples = 0;
+
+	while (true) {
+		vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(SAMPLE_PERIOD_MS));
+		self->sample();
+		if (++samples % REPORT_EVERY == 0) {
+			self->report();
+		}
+	}
+}
+
+/**
+ * @brief Get the run time counter of a task at the previous sample
+ * @param number FreeRTOS task number
+ * @param counter Receives the counter
+ * @return false if the task did not exist at the previous sample
+ */
+bool Telemetry::findPrevious(uint32_t number, uint32_t &counter) const {
+	for (size_t i = 0; i < m_prevCount; i++) {
+		if (m_prevNumber[i] == number) {
+			counter = m_prevCounter[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Take one sample into m_snapshot
+ * @details The run time counters are 32-bit microseconds and wrap after
+ *          71 minutes; unsigned differences stay correct as long as the
+ *          sample period is shorter. A task created since the previous sample
+ *          is measured from its creation (counter 0).
+ */
+void Telemetry::sample() {
+	configRUN_TIME_COUNTER_TYPE totalRunTime = 0;
+	const UBaseType_t count = uxTaskGetSystemState(m_status, STATUS_CAPACITY, &totalRunTime);
+	if (count == 0) {
+		ESP_LOGW(TAG, "More than %u tasks, not sampled", static_cast<unsigned>(STATUS_CAPACITY));
+		return;
+	}
+
+	const uint32_t total = static_cast<uint32_t>(totalRunTime);
+	const uint32_t totalDelta = total - m_prevTotal;
+
+	Snapshot next = {};
+	next.uptimeMs = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+	next.periodMs = totalDelta / 1000;
+
+	for (UBaseType_t i = 0; i < count; i++) {
+		const TaskStatus_t &status = m_status[i];
+		const uint32_t counter = static_cast<uint32_t>(status.ulRunTimeCounter);
+		uint32_t prevCounter = 0;
+		findPrevious(status.xTaskNumber, prevCounter);
+
+		TaskInfo info = {};
+		strncpy(info.name, status.pcTaskName, sizeof(info.name) - 1);
+		info.number = status.xTaskNumber;
+		info.priority = static_cast<uint8_t>(status.uxCurrentPriority);
+		info.state = status.eCurrentState < sizeof(TASK_STATES) ? TASK_STATES[status.eCurrentState] : '?';
+		info.cpuPermille = totalDelta > 0
+			? static_cast<uint16_t>((static_cast<uint64_t>(counter - prevCounter) * 1000 + totalDelta / 2) / totalDelta)
+			: 0;
+		info.stackFreeMin = status.usStackHighWaterMark;
+
+		// Insert sorted by CPU share, the least busy tasks fall off the end
+		size_t pos = next.taskCount;
+		while (pos > 0 && next.tasks[pos - 1].cpuPermille < info.cpuPermille) {
+			pos--;
+		}
+		if (pos >= MAX_TASKS) {
+			next.tasksMissed++;
+			continue;
+		}
+		if (next.taskCount == MAX_TASKS) {
+			next.tasksMissed++;
+		} else {
+			next.taskCount++;
+		}
+		memmove(&next.tasks[pos + 1], &next.tasks[pos], (next.taskCount - 1 - pos) * sizeof(TaskInfo));
+		next.tasks[pos] = info;
+	}
+
+	next.internal = readHeap(MALLOC_CAP_INTERNAL);
+	next.dma = readHeap(MALLOC_CAP_DMA);
+
+	for (UBaseType_t i = 0; i < count; i++) {
+		m_prevNumber[i] = m_status[i].xTaskNumber;
+		m_prevCounter[i] = static_cast<uint32_t>(m_status[i].ulRunTimeCounter);
+	}
+	m_prevCount = count;
+	m_prevTotal = total;
+
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	m_snapshot = next;
+	m_valid = true;
+	xSemaphoreGive(m_mutex);
+}
+
+/**
+ * @brief Copy the latest sample
+ * @param out Receives the sample
+ * @return false if no sample was taken yet
+ */
+bool Telemetry::getSnapshot(Snapshot &out) {
+	if (m_mutex == nullptr) {
+		return false;
+	}
+	xSemaphoreTake(m_mutex, portMAX_DELAY);
+	const bool valid = m_valid;
+	if (valid) {
+		out = m_snapshot;
+	}
+	xSemaphoreGive(m_mutex);
+	return valid;
+}
+
+/**
+ * @brief Log the latest sample as a table
+ */
+void Telemetry::report() {
+	Snapshot snap;
+	if (!getSnapshot(snap)) {
+		return;
+	}
+
+	ESP_LOGI(TAG, "%u tasks over the last %lu ms (uptime %lu s):",
+			 snap.taskCount + snap.tasksMissed, snap.periodMs, snap.uptimeMs / 1000);
+	ESP_LOGI(TAG, "  %-16s pri st   cpu  stack free min", "task");
+	for (size_t i = 0; i < snap.taskCount; i++) {
+		const TaskInfo &task = snap.tasks[i];
+		ESP_LOGI(TAG, "  %-16s %3u  %c %3u.%u%%  %6lu B", task.name, task.priority, task.state,
+				 task.cpuPermille / 10, task.cpuPermille % 10, task.stackFreeMin);
+	}
+	if (snap.tasksMissed > 0) {
+		ESP_LOGI(TAG, "  ... %u idle tasks not shown", snap.tasksMissed);
+	}
+	ESP_LOGI(TAG, "Heap internal: %lu free, %lu min free, %lu largest block",
+			 snap.internal.freeBytes, snap.internal.minFreeBytes, snap.internal.largestBlock);
+	ESP_LOGI(TAG, "Heap DMA: %lu free, %lu min free, %lu largest block",
+			 snap.dma.freeBytes, snap.dma.minFreeBytes, snap.dma.largestBlock);
+	LatencyTracker::instance().report();
+}
+
+/**
+ * @brief Format the latest sample as JSON
+ * @return JSON object with uptime_ms, period_ms, tasks[], heap and latency,
+ *         `{}` if no sample was taken yet
+ */
+std::string Telemetry::toJSON() {
+	Snapshot snap;
+	if (!getSnapshot(snap)) {
+		return "{}";
+	}
+
+	std::string json;
+	json.reserve(256 + snap.taskCount * 96);
+
+	char buf[160];
+	snprintf(buf, sizeof(buf), "{\"uptime_ms\":%lu,\"period_ms\":%lu,\"tasks_missed\":%u,\"tasks\":[",
+			 snap.uptimeMs, snap.periodMs, snap.tasksMissed);
+	json += buf;
+
+	for (size_t i = 0; i < snap.taskCount; i++) {
+		const TaskInfo &task = snap.tasks[i];
+		snprintf(buf, sizeof(buf),
+				 "%s{\"name\":\"%s\",\"priority\":%u,\"state\":\"%c\",\"cpu\":%u.%u,\"stack_free_min\":%lu}",
+				 i > 0 ? "," : "", task.name, task.priority, task.state,
+				 task.cpuPermille / 10, task.cpuPermille % 10, task.stackFreeMin);
+		json += buf;
+	}
+
+	snprintf(buf, sizeof(buf),
+			 "],\"heap\":{\"internal\":{\"free\":%lu,\"min_free\":%lu,\"largest_block\":%lu},",
+			 snap.internal.freeBytes, snap.internal.minFreeBytes, snap.internal.largestBlock);
+	json += buf;
+	snprintf(buf, sizeof(buf), "\"dma\":{\"free\":%lu,\"min_free\":%lu,\"largest_block\":%lu}},",
+			 snap.dma.freeBytes, snap.dma.minFreeBytes, snap.dma.largestBlock);
+	json += buf;
+#if defined(LV_DRAW_SW_ARC_CACHE_SIZE) && LV_DRAW_SW_ARC_CACHE_SIZE > 0
+	// Battery gauge coverage cache, see README "Compressed Images"
+	lv_draw_sw_arc_cache_stats_t arc;
+	lv_draw_sw_arc_cache_get_stats(&arc);
+	snprintf(buf, sizeof(buf),
+			 "\"arc_cache\":{\"hits\":%lu,\"misses\":%lu,\"bypasses\":%lu,\"evictions\":%lu,\"entries\":%lu,\"bytes\":%lu},",
+			 arc.hits, arc.misses, arc.bypasses, arc.evictions, arc.entry_cnt, arc.size);
+	json += buf;
+#endif
+	json += "\"latency\":";
+	json += LatencyTracker::instance().toJSON();
+	json += "}";
+	return json;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file Telemetry.h
+ * @brief Per-task CPU, stack and heap telemetry
+ * @details Samples the FreeRTOS run time counters, the stack high-water
+ *          marks of all tasks and the internal / DMA-capable heaps every few
+ *          seconds. The latest sample is logged periodically and served as
+ *          JSON by the web server (GET /api/telemetry), so task stacks and the
+ *          CPU budget can be sized from data instead of guesswork.
+ *
+ *          Needs CONFIG_FREERTOS_USE_TRACE_FACILITY and
+ *          CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS (sdkconfig.defaults).
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class Telemetry
+ * @brief Periodic sampler of task and heap statistics
+ * @details Singleton. start() creates a low priority task which takes a
+ *          sample every SAMPLE_PERIOD_MS. CPU load is the share of the run
+ *          time counter (esp_timer, 1 us) each task got since the previous
+ *          sample; IDLE is the free CPU. Samples are kept in fixed arrays, no
+ *          allocation happens after start() except in toJSON().
+ */
+class Telemetry {
+public:
+	static constexpr size_t MAX_TASKS = 16;            ///< Tasks kept per sample, busiest first
+	static constexpr size_t STATUS_CAPACITY = 24;      ///< Tasks that can exist for a sample to be taken
+	static constexpr uint32_t SAMPLE_PERIOD_MS = 5000;  ///< Time between samples
+	static constexpr uint32_t REPORT_EVERY = 6;         ///< Samples between serial reports (30 s)
+
+	/**
+	 * @struct TaskInfo
+	 * @brief Statistics of one task
+	 */
+	struct TaskInfo {
+		char name[configMAX_TASK_NAME_LEN];  ///< Task name
+		uint32_t number;                     ///< FreeRTOS task number (unique per task)
+		uint8_t priority;                    ///< Current priority
+		char state;                          ///< X running, R ready, B blocked, S suspended, D deleted
+		uint16_t cpuPermille;                ///< CPU share over the last sample period, 0.1 %
+		uint32_t stackFreeMin;               ///< Stack high-water mark: least free stack ever, bytes
+	};
+
+	/**
+	 * @struct HeapInfo
+	 * @brief Statistics of the heap regions with given capabilities
+	 */
+	struct HeapInfo {
+		uint32_t freeBytes;     ///< Currently free
+		uint32_t minFreeBytes;  ///< Least free since boot
+		uint32_t largestBlock;  ///< Largest block that can be allocated now
+	};
+
+	/**
+	 * @struct Snapshot
+	 * @brief One telemetry sample
+	 */
+	struct Snapshot {
+		uint32_t uptimeMs;                ///< Time of the sample since reset
+		uint32_t periodMs;                ///< Run time covered by the CPU shares
+		uint8_t taskCount;                ///< Valid entries in tasks, sorted by CPU share
+		uint8_t tasksMissed;              ///< Tasks left out (more than MAX_TASKS)
+		TaskInfo tasks[MAX_TASKS];        ///< Per-task statistics
+		HeapInfo internal;                ///< MALLOC_CAP_INTERNAL heap
+		HeapInfo dma;                     ///< MALLOC_CAP_DMA heap
+	};
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the Telemetry singleton
+	 */
+	static Telemetry &instance();
+
+	/**
+	 * @brief Start the sampling task
+	 * @details Safe to call more than once
+	 */
+	void start();
+
+	/**
+	 * @brief Copy the latest sample
+	 * @param out Receives the sample
+	 * @return false if no sample was taken yet
+	 */
+	bool getSnapshot(Snapshot &out);
+
+	/**
+	 * @brief Log the latest sample as a table
+	 */
+	void report();
+
+	/**
+	 * @brief Format the latest sample as JSON
+	 * @return JSON object with uptime_ms, period_ms, tasks[], heap, arc_cache
+	 *         and latency
+	 */
+	std::string toJSON();
+
+private:
+	Telemetry() = default;
+	~Telemetry() = default;
+
+	Telemetry(const Telemetry &) = delete;
+	Telemetry &operator=(const Telemetry &) = delete;
+
+	/**
+	 * @brief Sampling task entry point
+	 * @param param Telemetry instance
+	 */
+	static void taskWrapper(void *param);
+
+	/**
+	 * @brief Take one sample into m_snapshot
+	 */
+	void sample();
+
+	/**
+	 * @brief Get the run time counter of a task at the previous sample
+	 * @param number FreeRTOS task number
+	 * @param counter Receives the counter
+	 * @return false if the task did not exist at the previous sample
+	 */
+	bool findPrevious(uint32_t number, uint32_t &counter) const;
+
+	static constexpr uint32_t TASK_STACK_SIZE = 3072;  ///< Sampling task stack, bytes
+
+	TaskStatus_t m_status[STATUS_CAPACITY] = {};       ///< uxTaskGetSystemState() output
+	uint32_t m_prevNumber[STATUS_CAPACITY] = {};       ///< Task numbers at the previous sample
+	uint32_t m_prevCounter[STATUS_CAPACITY] = {};      ///< Run time counters at the previous sample
+	size_t m_prevCount = 0;                            ///< Valid entries in m_prev*
+	uint32_t m_prevTotal = 0;                          ///< Total run time at the previous sample
+
+	Snapshot m_snapshot = {};                          ///< Latest sample, guarded by m_mutex
+	bool m_valid = false;                              ///< m_snapshot holds a sample
+	SemaphoreHandle_t m_mutex = nullptr;               ///< Guards m_snapshot and m_valid
+	TaskHandle_t m_task = nullptr;                     ///< Sampling task
+};
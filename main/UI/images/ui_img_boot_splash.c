@@ -0,0 +1,389 @@
+// This file was generated by squareline/gen_boot_splash.py
+// ui_Splash background + ui_img_942102620, 240x240 RGB565 in panel byte order,
+// RLE-compressed (115200 -> 6031 bytes). Drawn by DisplayManager before LVGL starts.
+
+#include <stdint.h>
+
+const uint16_t ui_img_boot_splash_width = 240;
+const uint16_t ui_img_boot_splash_height = 240;
+const uint32_t ui_img_boot_splash_rle_size = 6031;
+
+const uint8_t ui_img_boot_splash_rle[] = {
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x31, 0x00, 0x00, 0x84, 0x00, 0x40, 0x10, 0x82, 0x08,
+    0x61, 0x10, 0xa2, 0x03, 0x00, 0x00, 0x85, 0x18, 0xc2, 0x10, 0xa2, 0x08, 0x61, 0x10, 0xa2, 0x08,
+    0x41, 0x2f, 0x00, 0x00, 0x81, 0x08, 0x41, 0x03, 0x00, 0x20, 0x05, 0x00, 0x00, 0x84, 0x08, 0x61,
+    0x18, 0xc3, 0x18, 0xc3, 0x08, 0x41, 0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x8c, 0x4a, 0x89, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0xbe, 0x08, 0x61, 0x00, 0x00, 0x5a, 0xeb, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xde, 0xda, 0x18, 0xe3, 0x2e, 0x00, 0x00, 0x85, 0x00, 0x20, 0xf7, 0x9d, 0xff, 0xff, 0xff,
+    0xff, 0x31, 0xa6, 0x05, 0x00, 0x00, 0x84, 0xad, 0x95, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xef, 0x7f,
+    0x00, 0x00, 0x29, 0x00, 0x00, 0x81, 0x42, 0x28, 0x03, 0xff, 0xff, 0x87, 0x08, 0x41, 0x5b, 0x0b,
+    0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x31, 0x86, 0x2f, 0x00, 0x00, 0x85, 0x00, 0x20,
+    0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x31, 0xa6, 0x05, 0x00, 0x00, 0x84, 0xad, 0x95, 0xff, 0xff,
+    0xff, 0xff, 0x7b, 0xef, 0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x81, 0x42, 0x28, 0x03, 0xff, 0xff,
+    0x86, 0x6b, 0x4d, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x29, 0x45, 0x03, 0x00, 0x00,
+    0x89, 0x29, 0x45, 0x5b, 0x0b, 0x7b, 0xef, 0x7b, 0xef, 0x42, 0x28, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x04, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00, 0x20, 0x06, 0x00, 0x00, 0x86, 0x08,
+    0x41, 0x4a, 0x48, 0x7b, 0xef, 0x7c, 0x0f, 0x63, 0x0c, 0x10, 0xa2, 0x03, 0x00, 0x00, 0x85, 0x18,
+    0xe3, 0x4a, 0x69, 0x5a, 0xcb, 0x4a, 0x69, 0x18, 0xe3, 0x03, 0x00, 0x00, 0x8d, 0x00, 0x20, 0x42,
+    0x08, 0x73, 0xae, 0x7c, 0x0f, 0x6b, 0x6d, 0x21, 0x04, 0x00, 0x00, 0x00, 0x20, 0xf7, 0x9e, 0xff,
+    0xff, 0xff, 0xff, 0x39, 0xe7, 0x00, 0x00, 0x04, 0x00, 0x20, 0x84, 0x39, 0xe7, 0x5a, 0xcb, 0x5a,
+    0xcb, 0x29, 0x45, 0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x81, 0x42, 0x28, 0x03, 0xff, 0xff, 0x85,
+    0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x29, 0x65, 0x03, 0x00, 0x00, 0x82, 0x8c, 0x91,
+    0xff, 0xdf, 0x04, 0xff, 0xff, 0x91, 0xce, 0x79, 0x9c, 0xf2, 0xf7, 0xbe, 0xf7, 0xbe, 0xd6, 0xda,
+    0x00, 0x20, 0x39, 0xc6, 0xf7, 0xbe, 0xf7, 0xbe, 0xde, 0xfb, 0x00, 0x20, 0x29, 0x65, 0xf7, 0xbe,
+    0xf7, 0xbe, 0xe7, 0x3c, 0x4a, 0x69, 0xe7, 0x5c, 0x04, 0xff, 0xff, 0x85, 0xef, 0x7d, 0x4a, 0x69,
+    0x00, 0x00, 0x84, 0x10, 0xff, 0xde, 0x03, 0xff, 0xff, 0x85, 0xf7, 0x9e, 0x73, 0xae, 0x00, 0x00,
+    0x21, 0x44, 0xce, 0x99, 0x04, 0xff, 0xff, 0x90, 0xff, 0xde, 0x63, 0x2c, 0x00, 0x20, 0xf7, 0x9e,
+    0xff, 0xff, 0xff, 0xff, 0x39, 0xe7, 0x9c, 0xf3, 0xf7, 0xbe, 0xf7, 0xbe, 0xe7, 0x3c, 0x29, 0x65,
+    0xad, 0x55, 0xf7, 0xbe, 0xf7, 0xbe, 0x73, 0xae, 0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x81, 0x42,
+    0x28, 0x06, 0xff, 0xff, 0x81, 0x73, 0xae, 0x03, 0x00, 0x00, 0x8e, 0x42, 0x08, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0xbe, 0xb5, 0xd6, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xff, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0x4a, 0x69, 0x8c, 0x50, 0x03, 0xff, 0xff, 0xac, 0x29, 0x65, 0x7b, 0xcf, 0xff,
+    0xff, 0xff, 0xff, 0xbe, 0x17, 0xd6, 0x99, 0xff, 0xff, 0xff, 0xff, 0xce, 0x58, 0xce, 0x79, 0xff,
+    0xff, 0xff, 0xff, 0xdf, 0x1b, 0x31, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x9d, 0x13, 0xef,
+    0x7d, 0xff, 0xff, 0xff, 0xde, 0x29, 0x65, 0xad, 0x75, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0xbd,
+    0xd7, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0x18, 0xc3, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xa5,
+    0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x4a, 0x69, 0x00, 0x00, 0xad, 0x95, 0xff, 0xff, 0xff,
+    0xff, 0x7b, 0xcf, 0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x81, 0x42, 0x28, 0x06, 0xff, 0xff, 0x92,
+    0xe7, 0x1b, 0x10, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x4d, 0xe7, 0x1b, 0xe7, 0x1b, 0x84, 0x30,
+    0x18, 0xc3, 0xad, 0x95, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff,
+    0x94, 0x92, 0xce, 0x99, 0x03, 0xff, 0xff, 0xa0, 0x7b, 0xef, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff,
+    0x7c, 0x0f, 0xd6, 0xda, 0xe7, 0x1b, 0xce, 0x79, 0x10, 0x82, 0x5a, 0xcb, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0xbe, 0x6b, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x5a, 0xeb, 0x6b, 0x6d, 0x7b, 0xef,
+    0x7b, 0xce, 0x29, 0x45, 0xc6, 0x38, 0xdf, 0x1b, 0xde, 0xfb, 0x21, 0x24, 0x39, 0xe7, 0xf7, 0xbe,
+    0xff, 0xff, 0xff, 0xff, 0x39, 0xe7, 0xf7, 0x9e, 0x04, 0xff, 0xff, 0x88, 0xff, 0xdf, 0x5a, 0xeb,
+    0x00, 0x00, 0x00, 0x00, 0xad, 0x95, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0x7f, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x81, 0x42, 0x28, 0x03, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x81, 0xad,
+    0x54, 0x03, 0x00, 0x00, 0x84, 0x31, 0x86, 0x9c, 0xd3, 0xd6, 0xba, 0xff, 0xde, 0x03, 0xff, 0xff,
+    0x86, 0xad, 0x75, 0x73, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0xff, 0xdf, 0x03, 0xff, 0xff,
+    0x89, 0xe7, 0x1c, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0x21, 0x24, 0x08, 0x41, 0x6b, 0x6d, 0xbd,
+    0xf7, 0xf7, 0x9d, 0x03, 0xff, 0xff, 0x83, 0xff, 0xde, 0x39, 0xe7, 0xf7, 0xbe, 0x04, 0xff, 0xff,
+    0x87, 0xe7, 0x3c, 0x73, 0xce, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0b, 0xb5, 0xd6, 0xe7, 0x5c, 0x04,
+    0xff, 0xff, 0x82, 0x42, 0x28, 0xf7, 0x9e, 0x04, 0xff, 0xff, 0x88, 0xef, 0x7d, 0x21, 0x24, 0x00,
+    0x00, 0x00, 0x00, 0xad, 0x95, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0x7f, 0x00, 0x00, 0x29, 0x00,
+    0x00, 0x81, 0x42, 0x28, 0x03, 0xff, 0xff, 0x82, 0x73, 0x8d, 0xce, 0x79, 0x03, 0xff, 0xff, 0x8d,
+    0x52, 0xaa, 0x00, 0x00, 0x39, 0xe7, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0xbe, 0x17,
+    0xff, 0xff, 0xff, 0xff, 0xad, 0x75, 0x18, 0xe3, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x81, 0xe7, 0x1c,
+    0x04, 0xff, 0xff, 0x8e, 0xce, 0x99, 0x00, 0x20, 0xbe, 0x17, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe,
+    0xa5, 0x34, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0x10, 0xa2, 0x42, 0x07, 0xbe, 0x17, 0xf7, 0x9d,
+    0x04, 0xff, 0xff, 0x8b, 0x52, 0xca, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xad, 0x75,
+    0xe7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x49, 0xf7, 0x9e, 0x05, 0xff, 0xff, 0x87, 0xbd, 0xf7,
+    0x00, 0x00, 0x00, 0x00, 0xad, 0x95, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0x7f, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x81, 0x42, 0x28, 0x03, 0xff, 0xff, 0x92, 0x08, 0x41, 0x4a, 0x49, 0xff, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xef, 0x7d, 0x29, 0x65, 0xb5, 0xb5, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x71, 0x00,
+    0x00, 0x94, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xad, 0x95, 0x00, 0x00, 0xc6, 0x38, 0x03, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0x5a, 0xcb, 0x04, 0xff, 0xff, 0x87, 0x8c, 0x91, 0x31, 0x85, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0x3c, 0x18, 0xe3, 0x31, 0xa6, 0x03, 0xff, 0xff, 0x96, 0x73, 0xce, 0xad, 0xb5, 0xad,
+    0xb6, 0x63, 0x4c, 0x31, 0x86, 0xb5, 0xb5, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0xff, 0xdf, 0xff,
+    0xff, 0xf7, 0xdf, 0x29, 0x65, 0x10, 0xa2, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x52, 0x8a, 0xf7,
+    0x9e, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x03, 0xff, 0xff, 0x86, 0x52, 0xca, 0x00, 0x00, 0xad,
+    0x95, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x87, 0x42, 0x28,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0x00, 0x20, 0x00, 0x00, 0xa5, 0x14, 0x03, 0xff, 0xff, 0x86,
+    0xad, 0x95, 0xbd, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xb5, 0xd6, 0x03, 0xff, 0xff, 0x83,
+    0xb5, 0xd6, 0x00, 0x00, 0x73, 0xae, 0x03, 0xff, 0xff, 0x83, 0xce, 0x79, 0x00, 0x20, 0xe7, 0x1b,
+    0x03, 0xff, 0xff, 0x82, 0x39, 0xe7, 0x31, 0x86, 0x03, 0xff, 0xff, 0x82, 0xb5, 0xb6, 0xe7, 0x3c,
+    0x03, 0xff, 0xff, 0x8e, 0x7b, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x7c, 0x0f, 0xce, 0x59,
+    0xff, 0xff, 0xff, 0xff, 0x8c, 0x91, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0xde, 0xdb,
+    0x03, 0xff, 0xff, 0x8e, 0x63, 0x0c, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x39, 0xe7, 0xbd, 0xf7,
+    0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x10, 0x82, 0xad, 0x95, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf,
+    0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x88, 0x42, 0x28, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0x00,
+    0x20, 0x00, 0x00, 0x21, 0x04, 0xef, 0x7d, 0x03, 0xff, 0xff, 0x82, 0x8c, 0x91, 0xf7, 0x9d, 0x03,
+    0xff, 0xff, 0x92, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x08, 0x40, 0x21, 0x24, 0xff,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x70, 0x00, 0x00, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xef,
+    0x5d, 0x00, 0x20, 0x00, 0x00, 0xb5, 0xd6, 0x03, 0xff, 0xff, 0x86, 0xe7, 0x3c, 0xde, 0xfb, 0xff,
+    0xff, 0xff, 0xff, 0x5a, 0xeb, 0xad, 0x55, 0x05, 0xff, 0xff, 0x83, 0xce, 0x79, 0x18, 0xc3, 0x94,
+    0xb2, 0x03, 0xff, 0xff, 0x92, 0xef, 0x7d, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0x84, 0x30, 0xf7,
+    0x9e, 0xff, 0xff, 0xff, 0xff, 0x31, 0xa6, 0x21, 0x24, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x9c,
+    0xd3, 0xad, 0x75, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x81,
+    0x08, 0x61, 0x03, 0x31, 0x86, 0x03, 0x00, 0x00, 0x81, 0x21, 0x24, 0x03, 0x31, 0x86, 0xbd, 0x21,
+    0x24, 0x19, 0x03, 0x6b, 0x6d, 0x73, 0x8d, 0x39, 0xe7, 0x00, 0x00, 0x31, 0x85, 0x31, 0xa6, 0x31,
+    0x86, 0x00, 0x40, 0x00, 0x00, 0x29, 0x85, 0x31, 0x86, 0x31, 0x86, 0x18, 0xc3, 0x00, 0x00, 0x10,
+    0xa2, 0x31, 0x86, 0x31, 0x86, 0x29, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x52, 0x8a, 0x73,
+    0xae, 0x5a, 0xeb, 0x10, 0x82, 0x18, 0xc3, 0x31, 0x86, 0x31, 0x86, 0x18, 0xe3, 0x00, 0x20, 0x42,
+    0x08, 0x7b, 0xcf, 0x8c, 0x91, 0x7c, 0x0f, 0x52, 0xaa, 0x08, 0x41, 0x00, 0x00, 0x00, 0x20, 0x42,
+    0x08, 0x73, 0x8e, 0x6b, 0x4d, 0x18, 0xc3, 0x10, 0x82, 0x31, 0x86, 0x31, 0x86, 0x21, 0x24, 0x29,
+    0x85, 0x31, 0x86, 0x31, 0x86, 0x08, 0x41, 0x00, 0x00, 0x21, 0x24, 0x31, 0x86, 0x31, 0x86, 0x29,
+    0x85, 0x21, 0x04, 0x31, 0x86, 0x31, 0x86, 0x10, 0xc2, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x82, 0x10,
+    0xc2, 0x42, 0x49, 0x03, 0x3a, 0x28, 0x83, 0x3a, 0x49, 0x3a, 0x28, 0x21, 0x44, 0x14, 0x00, 0x00,
+    0x81, 0x21, 0x04, 0x07, 0x3a, 0x08, 0x82, 0x3a, 0x28, 0x21, 0x24, 0x7f, 0x00, 0x00, 0x4b, 0x00,
+    0x00, 0x82, 0x29, 0xa6, 0x95, 0x14, 0x05, 0x95, 0x15, 0x81, 0x4a, 0xcb, 0x13, 0x00, 0x00, 0x82,
+    0x42, 0x6a, 0x94, 0xf4, 0x07, 0x95, 0x15, 0x82, 0x63, 0x4c, 0x08, 0x41, 0x7f, 0x00, 0x00, 0x4b,
+    0x00, 0x00, 0x81, 0x29, 0x86, 0x06, 0x8c, 0xd4, 0x81, 0x4a, 0xab, 0x11, 0x00, 0x00, 0x82, 0x08,
+    0x41, 0x63, 0x6e, 0x07, 0x8c, 0xd4, 0x83, 0x8c, 0xb3, 0x3a, 0x28, 0x00, 0x20, 0x7f, 0x00, 0x00,
+    0x4c, 0x00, 0x00, 0x81, 0x29, 0x86, 0x06, 0x8c, 0xd4, 0x81, 0x4a, 0xab, 0x10, 0x00, 0x00, 0x82,
+    0x18, 0xc3, 0x73, 0xef, 0x07, 0x8c, 0xd4, 0x82, 0x7c, 0x51, 0x21, 0x45, 0x7f, 0x00, 0x00, 0x4e,
+    0x00, 0x00, 0x88, 0x31, 0xa6, 0x9d, 0x55, 0x9d, 0x36, 0x9d, 0x56, 0x9d, 0x55, 0x9d, 0x36, 0x9d,
+    0x35, 0x52, 0xcb, 0x0f, 0x00, 0x00, 0x8b, 0x39, 0xe7, 0x8c, 0xd3, 0x9d, 0x56, 0x9d, 0x56, 0x9d,
+    0x36, 0x9d, 0x55, 0x9d, 0x55, 0x9d, 0x56, 0x9d, 0x55, 0x74, 0x10, 0x18, 0xe3, 0x7f, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x81, 0x31, 0xc7, 0x06, 0xad, 0xb7, 0x81, 0x5b, 0x0c, 0x0d, 0x00, 0x00, 0x85,
+    0x00, 0x20, 0x5b, 0x0c, 0xa5, 0x97, 0xa5, 0xb7, 0xa5, 0xb7, 0x04, 0xad, 0xb7, 0x83, 0xa5, 0xb7,
+    0x63, 0x8d, 0x08, 0x41, 0x7f, 0x00, 0x00, 0x50, 0x00, 0x00, 0x88, 0x39, 0xe7, 0xb5, 0xf7, 0xb5,
+    0xf8, 0xb5, 0xd8, 0xb5, 0xf7, 0xb5, 0xd8, 0xb5, 0xf8, 0x5b, 0x4d, 0x0c, 0x00, 0x00, 0x8d, 0x10,
+    0xa2, 0x74, 0x0f, 0xad, 0xd8, 0xad, 0xd8, 0xad, 0xf8, 0xad, 0xf8, 0xb5, 0xd8, 0xb5, 0xd7, 0xb5,
+    0xd7, 0xad, 0xd7, 0x4a, 0x89, 0x08, 0x61, 0x39, 0xe8, 0x17, 0x31, 0xc7, 0x83, 0x18, 0xe3, 0x00,
+    0x00, 0x10, 0xa2, 0x17, 0x31, 0xc7, 0x82, 0x31, 0xa6, 0x08, 0x41, 0x04, 0x00, 0x00, 0x82, 0x08,
+    0x61, 0x29, 0x65, 0x17, 0x31, 0xc7, 0x83, 0x08, 0x41, 0x00, 0x00, 0x29, 0x65, 0x06, 0x31, 0xc7,
+    0x81, 0x00, 0x20, 0x0b, 0x00, 0x00, 0x81, 0x18, 0xe3, 0x06, 0x31, 0xc7, 0x85, 0x18, 0xc3, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x61, 0x29, 0x65, 0x17, 0x31, 0xc7, 0x81, 0x08, 0x41, 0x46, 0x00, 0x00,
+    0x88, 0x39, 0xe7, 0xbe, 0x38, 0xbe, 0x39, 0xbe, 0x39, 0xbe, 0x38, 0xbe, 0x39, 0xbe, 0x38, 0x63,
+    0x4d, 0x0b, 0x00, 0x00, 0x82, 0x31, 0x86, 0xa5, 0x55, 0x06, 0xbe, 0x39, 0x86, 0xbe, 0x38, 0xa5,
+    0x96, 0x3a, 0x07, 0x00, 0x20, 0x6b, 0xae, 0xbe, 0x38, 0x16, 0xbe, 0x39, 0x86, 0xa5, 0x75, 0x10,
+    0xa2, 0x08, 0x41, 0x94, 0xd3, 0xbe, 0x38, 0xbe, 0x38, 0x15, 0xbe, 0x39, 0x87, 0xbe, 0x38, 0x7c,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x7c, 0x30, 0xb5, 0xf8, 0x16, 0xbe, 0x39, 0x86, 0xbe,
+    0x38, 0x7c, 0x2f, 0x00, 0x00, 0x42, 0x69, 0xbe, 0x38, 0xbe, 0x38, 0x04, 0xbe, 0x39, 0x81, 0x5b,
+    0x0c, 0x0b, 0x00, 0x00, 0x82, 0x19, 0x04, 0xa5, 0x96, 0x05, 0xbe, 0x39, 0x85, 0x9d, 0x14, 0x08,
+    0x82, 0x19, 0x04, 0x7c, 0x30, 0xb5, 0xf8, 0x17, 0xbe, 0x39, 0x81, 0x7b, 0xef, 0x47, 0x00, 0x00,
+    0x81, 0x3a, 0x28, 0x06, 0xce, 0x9a, 0x81, 0x6b, 0xae, 0x0a, 0x00, 0x00, 0x82, 0x42, 0x28, 0xc6,
+    0x59, 0x07, 0xce, 0x9a, 0x84, 0xa5, 0x74, 0x21, 0x24, 0x00, 0x00, 0x63, 0x6d, 0x06, 0xce, 0x9a,
+    0x11, 0xc6, 0x79, 0x84, 0xbe, 0x18, 0x29, 0x65, 0x00, 0x00, 0x8c, 0x92, 0x06, 0xce, 0x9a, 0x0b,
+    0xc6, 0x79, 0x08, 0xce, 0x9a, 0x84, 0x63, 0x4d, 0x00, 0x00, 0x4a, 0x8a, 0xce, 0x7a, 0x05, 0xce,
+    0x9a, 0x81, 0xc6, 0x7a, 0x12, 0xc6, 0x79, 0x84, 0x9d, 0x14, 0x08, 0x41, 0x31, 0xa6, 0xc6, 0x39,
+    0x05, 0xce, 0x9a, 0x81, 0x8c, 0x71, 0x0b, 0x00, 0x00, 0x82, 0x08, 0x61, 0xa5, 0x75, 0x05, 0xce,
+    0x9a, 0x84, 0xb5, 0xf7, 0x21, 0x24, 0x4a, 0x8a, 0xce, 0x7a, 0x05, 0xce, 0x9a, 0x13, 0xc6, 0x79,
+    0x82, 0x9d, 0x14, 0x08, 0x41, 0x47, 0x00, 0x00, 0x81, 0x42, 0x48, 0x06, 0xdf, 0x1c, 0x81, 0x7b,
+    0xcf, 0x09, 0x00, 0x00, 0x82, 0x6b, 0xae, 0xde, 0xfb, 0x07, 0xdf, 0x1c, 0x85, 0x7c, 0x0f, 0x08,
+    0x61, 0x00, 0x00, 0x42, 0x28, 0xde, 0xfb, 0x05, 0xdf, 0x1c, 0x82, 0x94, 0xb2, 0x10, 0xa2, 0x10,
+    0x10, 0x82, 0x83, 0x08, 0x61, 0x00, 0x00, 0x73, 0xcf, 0x06, 0xdf, 0x1c, 0x81, 0x52, 0xca, 0x0b,
+    0x10, 0x82, 0x81, 0x7b, 0xef, 0x06, 0xdf, 0x1c, 0x84, 0xa5, 0x55, 0x00, 0x20, 0x4a, 0x69, 0xde,
+    0xfb, 0x05, 0xdf, 0x1c, 0x82, 0x7b, 0xef, 0x10, 0xc3, 0x12, 0x10, 0x82, 0x83, 0x00, 0x20, 0x19,
+    0x03, 0xce, 0x9a, 0x05, 0xdf, 0x1c, 0x82, 0xde, 0xfb, 0x39, 0xe7, 0x09, 0x10, 0xa2, 0x83, 0x18,
+    0xc3, 0x3a, 0x08, 0xad, 0x95, 0x05, 0xdf, 0x1c, 0x84, 0xd6, 0xfb, 0x39, 0xe7, 0x52, 0xaa, 0xde,
+    0xfb, 0x05, 0xdf, 0x1c, 0x85, 0x7b, 0xef, 0x10, 0x82, 0x08, 0x61, 0x10, 0x82, 0x10, 0x82, 0x03,
+    0x08, 0x82, 0x0c, 0x10, 0x82, 0x81, 0x00, 0x20, 0x48, 0x00, 0x00, 0x81, 0x4a, 0x49, 0x06, 0xe7,
+    0x5d, 0x81, 0x7c, 0x0f, 0x07, 0x00, 0x00, 0x82, 0x10, 0x82, 0x94, 0xf2, 0x07, 0xe7, 0x5d, 0x86,
+    0xe7, 0x1c, 0x5b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0xce, 0x99, 0x05, 0xe7, 0x5d, 0x82,
+    0xad, 0xb5, 0x08, 0x41, 0x12, 0x00, 0x00, 0x82, 0x52, 0xca, 0xe7, 0x3d, 0x05, 0xe7, 0x5d, 0x81,
+    0x7c, 0x0f, 0x0b, 0x00, 0x00, 0x82, 0x18, 0xe3, 0xce, 0x9a, 0x05, 0xe7, 0x5d, 0x84, 0xbe, 0x38,
+    0x08, 0x61, 0x29, 0x86, 0xde, 0xfb, 0x05, 0xe7, 0x5d, 0x82, 0xce, 0x79, 0x08, 0x41, 0x13, 0x00,
+    0x00, 0x82, 0x10, 0x82, 0xc6, 0x38, 0x07, 0xe7, 0x5d, 0x82, 0xe7, 0x5c, 0xe7, 0x5c, 0x09, 0xe7,
+    0x3c, 0x06, 0xe7, 0x5d, 0x84, 0xe7, 0x5c, 0x63, 0x0c, 0x29, 0x85, 0xde, 0xfb, 0x05, 0xe7, 0x5d,
+    0x82, 0xce, 0x79, 0x00, 0x20, 0x5c, 0x00, 0x00, 0x81, 0x4a, 0x49, 0x06, 0xe7, 0x5d, 0x81, 0x7c,
+    0x0f, 0x06, 0x00, 0x00, 0x82, 0x31, 0xc6, 0xc6, 0x38, 0x07, 0xe7, 0x5d, 0x86, 0xc6, 0x58, 0x3a,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0xb5, 0xf6, 0x06, 0xe7, 0x5d, 0x81, 0xce, 0x9a, 0x0c,
+    0xbe, 0x38, 0x81, 0x7c, 0x0f, 0x05, 0x00, 0x00, 0x82, 0x31, 0xc6, 0xde, 0xfb, 0x05, 0xe7, 0x5d,
+    0x82, 0xa5, 0x34, 0x00, 0x20, 0x0a, 0x00, 0x00, 0x82, 0x29, 0x45, 0xc6, 0x38, 0x05, 0xe7, 0x5d,
+    0x84, 0xce, 0x9a, 0x21, 0x24, 0x08, 0x61, 0xc6, 0x59, 0x07, 0xe7, 0x5d, 0x82, 0xd6, 0xdb, 0xc6,
+    0x38, 0x0d, 0xbe, 0x38, 0x86, 0xb5, 0xd6, 0x73, 0xae, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8c,
+    0x91, 0x18, 0xe7, 0x5d, 0x84, 0xe7, 0x3c, 0x6b, 0x8d, 0x10, 0xa2, 0xc6, 0x59, 0x07, 0xe7, 0x5d,
+    0x81, 0xd6, 0xba, 0x0a, 0xbe, 0x38, 0x87, 0xc6, 0x38, 0xc6, 0x38, 0xbe, 0x38, 0xbe, 0x38, 0xb5,
+    0xd6, 0x73, 0xce, 0x08, 0x41, 0x4b, 0x00, 0x00, 0x81, 0x4a, 0x49, 0x06, 0xe7, 0x5d, 0x81, 0x7c,
+    0x0f, 0x05, 0x00, 0x00, 0x82, 0x42, 0x48, 0xd6, 0xdb, 0x07, 0xe7, 0x5d, 0x82, 0xad, 0x75, 0x18,
+    0xe3, 0x03, 0x00, 0x00, 0x81, 0x9d, 0x13, 0x13, 0xe7, 0x5d, 0x82, 0xbe, 0x17, 0x08, 0x61, 0x04,
+    0x00, 0x00, 0x82, 0x18, 0xc3, 0xd6, 0xba, 0x05, 0xe7, 0x5d, 0x84, 0xc6, 0x18, 0x08, 0x61, 0x00,
+    0x00, 0x7c, 0x10, 0x06, 0xa5, 0x54, 0x84, 0xa5, 0x55, 0xa5, 0x55, 0xb5, 0xf7, 0xe7, 0x3c, 0x05,
+    0xe7, 0x5d, 0x85, 0xe7, 0x3c, 0x39, 0xe7, 0x00, 0x00, 0x3a, 0x08, 0xe7, 0x5c, 0x17, 0xe7, 0x5d,
+    0x85, 0xe7, 0x5c, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x06, 0x4a, 0x69, 0x82, 0x6b,
+    0x8d, 0xe7, 0x3c, 0x07, 0xe7, 0x5d, 0x82, 0xde, 0xdb, 0x5a, 0xeb, 0x06, 0x4a, 0x69, 0x85, 0x42,
+    0x28, 0x10, 0xa2, 0x00, 0x00, 0x39, 0xe7, 0xe7, 0x3d, 0x18, 0xe7, 0x5d, 0x81, 0x21, 0x24, 0x4b,
+    0x00, 0x00, 0x81, 0x4a, 0x49, 0x06, 0xe7, 0x5d, 0x81, 0x7c, 0x0f, 0x04, 0x00, 0x00, 0x82, 0x7b,
+    0xcf, 0xe7, 0x3c, 0x06, 0xe7, 0x5d, 0x83, 0xe7, 0x5c, 0x7b, 0xef, 0x00, 0x20, 0x03, 0x00, 0x00,
+    0x81, 0x7b, 0xef, 0x05, 0xe7, 0x5d, 0x82, 0xe7, 0x3c, 0x73, 0xce, 0x0d, 0x6b, 0x6d, 0x81, 0x21,
+    0x24, 0x04, 0x00, 0x00, 0x82, 0x08, 0x41, 0xb5, 0xf6, 0x05, 0xe7, 0x5d, 0x84, 0xd6, 0xba, 0x21,
+    0x04, 0x00, 0x00, 0x7b, 0xef, 0x0f, 0xe7, 0x5d, 0x82, 0xce, 0x79, 0x39, 0xe7, 0x03, 0x00, 0x00,
+    0x82, 0x29, 0x85, 0x63, 0x2c, 0x0e, 0x6b, 0x6d, 0x82, 0x84, 0x30, 0xe7, 0x3c, 0x06, 0xe7, 0x5d,
+    0x81, 0x8c, 0x71, 0x09, 0x00, 0x00, 0x82, 0x08, 0x61, 0xbe, 0x17, 0x07, 0xe7, 0x5d, 0x82, 0xe7,
+    0x3c, 0x4a, 0x69, 0x0b, 0x00, 0x00, 0x82, 0x29, 0x85, 0x5a, 0xcb, 0x0e, 0x6b, 0x6d, 0x82, 0x84,
+    0x31, 0xe7, 0x3d, 0x06, 0xe7, 0x5d, 0x81, 0x94, 0xd2, 0x4c, 0x00, 0x00, 0x8d, 0x4a, 0x49, 0xe7,
+    0x3c, 0xe7, 0x5d, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x5d, 0xe7, 0x3c, 0x7c, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x82, 0xad, 0x75, 0xe7, 0x5d, 0x05, 0xe7, 0x3d, 0x83, 0xe7, 0x5d, 0xdf, 0x1c, 0x52,
+    0xaa, 0x04, 0x00, 0x00, 0x82, 0x52, 0xca, 0xe7, 0x3c, 0x03, 0xe7, 0x3d, 0x83, 0xe7, 0x5d, 0xe7,
+    0x5d, 0x73, 0xae, 0x13, 0x00, 0x00, 0x81, 0x9c, 0xf3, 0x04, 0xe7, 0x3d, 0x88, 0xe7, 0x5d, 0xdf,
+    0x1c, 0x39, 0xe7, 0x00, 0x00, 0x39, 0xc7, 0xe7, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0x04, 0xe7, 0x3d,
+    0x82, 0xe7, 0x5d, 0xad, 0xb5, 0x03, 0x94, 0xd3, 0x85, 0x94, 0xb2, 0x8c, 0x91, 0x84, 0x30, 0x52,
+    0xaa, 0x08, 0x41, 0x14, 0x00, 0x00, 0x82, 0x31, 0x86, 0xe7, 0x1c, 0x05, 0xe7, 0x3d, 0x82, 0xb5,
+    0xd7, 0x08, 0x41, 0x08, 0x00, 0x00, 0x82, 0x00, 0x20, 0xa5, 0x14, 0x07, 0xe7, 0x3d, 0x82, 0xe7,
+    0x5c, 0x73, 0xae, 0x1c, 0x00, 0x00, 0x82, 0x29, 0x85, 0xe7, 0x3c, 0x03, 0xe7, 0x3d, 0x84, 0xe7,
+    0x5d, 0xe7, 0x3d, 0xad, 0xb6, 0x08, 0x41, 0x4c, 0x00, 0x00, 0x83, 0x42, 0x28, 0xd6, 0xfb, 0xde,
+    0xfb, 0x03, 0xde, 0xfc, 0x85, 0xde, 0xfb, 0x94, 0xd3, 0x42, 0x29, 0x73, 0xaf, 0xbe, 0x18, 0x03,
+    0xde, 0xfc, 0x86, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xde, 0xfc, 0xce, 0x79, 0x29, 0x65, 0x04,
+    0x00, 0x00, 0x82, 0x31, 0xa6, 0xce, 0x9a, 0x03, 0xde, 0xfc, 0x84, 0xde, 0xfb, 0xde, 0xfb, 0xbe,
+    0x18, 0x4a, 0x8a, 0x10, 0x42, 0x28, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0xde, 0xfb, 0xde,
+    0xfc, 0xde, 0xfb, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfb, 0x5a, 0xeb, 0x03, 0x00, 0x00, 0x8a, 0x52,
+    0xaa, 0xce, 0x79, 0xde, 0xfb, 0xde, 0xfc, 0xde, 0xfc, 0xd6, 0xfb, 0xde, 0xfc, 0xde, 0xfb, 0xce,
+    0x79, 0x42, 0x28, 0x07, 0x00, 0x00, 0x81, 0x21, 0x45, 0x12, 0x42, 0x28, 0x83, 0x4a, 0x8a, 0xbd,
+    0xf7, 0xde, 0xfc, 0x04, 0xde, 0xfb, 0x82, 0xc6, 0x38, 0x18, 0xc3, 0x09, 0x00, 0x00, 0x81, 0x73,
+    0xaf, 0x06, 0xde, 0xfc, 0x83, 0xd6, 0xfc, 0xd6, 0xfc, 0x94, 0xb2, 0x09, 0x00, 0x00, 0x81, 0x29,
+    0x45, 0x11, 0x42, 0x28, 0x85, 0x31, 0xc7, 0x4a, 0x8a, 0xb5, 0xf7, 0xde, 0xfc, 0xde, 0xfb, 0x03,
+    0xde, 0xfc, 0x82, 0xbe, 0x18, 0x18, 0xc3, 0x4d, 0x00, 0x00, 0x89, 0x3a, 0x08, 0xce, 0x9a, 0xce,
+    0x9a, 0xce, 0x7a, 0xce, 0x9a, 0xce, 0x9a, 0xce, 0x7a, 0xce, 0x9a, 0xce, 0x7a, 0x07, 0xce, 0x9a,
+    0x83, 0xce, 0x7a, 0x94, 0xd2, 0x10, 0xa2, 0x04, 0x00, 0x00, 0x83, 0x10, 0xa2, 0xb5, 0xb7, 0xce,
+    0x7a, 0x03, 0xce, 0x9b, 0x03, 0xce, 0x9a, 0x8b, 0xc6, 0x9a, 0xc6, 0x7a, 0xc6, 0x7a, 0xc6, 0x9a,
+    0xc6, 0x9a, 0xc6, 0x7a, 0xc6, 0x7a, 0xc6, 0x9a, 0xc6, 0x9a, 0xc6, 0x7a, 0xc6, 0x7a, 0x05, 0xce,
+    0x9a, 0x8a, 0x63, 0x4d, 0x00, 0x00, 0x42, 0x29, 0xc6, 0x9a, 0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9a,
+    0xce, 0x7a, 0xce, 0x7a, 0x73, 0xae, 0x05, 0x00, 0x00, 0x85, 0x18, 0xc3, 0x94, 0xd3, 0xce, 0x9a,
+    0xce, 0x9a, 0xc6, 0x9a, 0x03, 0xce, 0x9a, 0x83, 0xc6, 0x7a, 0x73, 0xcf, 0x08, 0x41, 0x04, 0x00,
+    0x00, 0x82, 0x21, 0x24, 0xb5, 0xf8, 0x14, 0xce, 0x9a, 0x81, 0xc6, 0x9b, 0x03, 0xce, 0x9a, 0x82,
+    0xa5, 0x55, 0x21, 0x24, 0x09, 0x00, 0x00, 0x83, 0x4a, 0x8a, 0xc6, 0x7a, 0xc6, 0x9a, 0x03, 0xce,
+    0x9b, 0x85, 0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9a, 0xa5, 0x75, 0x08, 0x41, 0x08, 0x00, 0x00, 0x82,
+    0x19, 0x04, 0xb5, 0xd8, 0x0f, 0xce, 0x9a, 0x84, 0xce, 0x7a, 0xce, 0x9a, 0xce, 0x9a, 0xc6, 0x7a,
+    0x04, 0xce, 0x9a, 0x83, 0xce, 0x7a, 0xad, 0x55, 0x21, 0x45, 0x4e, 0x00, 0x00, 0x83, 0x29, 0x45,
+    0xbe, 0x19, 0xbe, 0x19, 0x0a, 0xbe, 0x39, 0x84, 0xbe, 0x19, 0xbe, 0x39, 0xb5, 0xf8, 0x52, 0xcb,
+    0x05, 0x00, 0x00, 0x82, 0x00, 0x20, 0x9c, 0xf3, 0x17, 0xbe, 0x19, 0x84, 0x84, 0x31, 0x00, 0x00,
+    0x29, 0x45, 0xb5, 0xf8, 0x05, 0xbe, 0x19, 0x81, 0x8c, 0x71, 0x08, 0x00, 0x00, 0x8e, 0x52, 0xeb,
+    0xad, 0xb7, 0xbe, 0x19, 0xbe, 0x19, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x19, 0xbe, 0x19, 0x9c, 0xf3,
+    0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0xa5, 0x55, 0x16, 0xbe, 0x19, 0x83, 0xbd, 0xf8,
+    0x8c, 0xb3, 0x42, 0x49, 0x0a, 0x00, 0x00, 0x82, 0x29, 0x45, 0xb5, 0xf8, 0x07, 0xbe, 0x19, 0x82,
+    0xa5, 0x76, 0x10, 0xa2, 0x08, 0x00, 0x00, 0x82, 0x08, 0x61, 0x9d, 0x55, 0x16, 0xbe, 0x19, 0x84,
+    0xad, 0xd7, 0x8c, 0xb3, 0x42, 0x49, 0x00, 0x20, 0x50, 0x00, 0x00, 0x82, 0x84, 0x51, 0xb5, 0xf9,
+    0x08, 0xb5, 0xf8, 0x85, 0xb5, 0xf9, 0xb5, 0xf8, 0x9d, 0x55, 0x5b, 0x4d, 0x10, 0xa3, 0x06, 0x00,
+    0x00, 0x81, 0x00, 0x20, 0x18, 0x08, 0x81, 0x83, 0x00, 0x20, 0x00, 0x00, 0x08, 0x41, 0x05, 0x08,
+    0x81, 0x82, 0x08, 0x61, 0x00, 0x20, 0x09, 0x00, 0x00, 0x82, 0x08, 0x41, 0x08, 0x61, 0x05, 0x08,
+    0x81, 0x85, 0x08, 0x61, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x17, 0x08, 0x61, 0x81,
+    0x00, 0x20, 0x0c, 0x00, 0x00, 0x81, 0x08, 0x41, 0x08, 0x08, 0x61, 0x81, 0x08, 0x41, 0x09, 0x00,
+    0x00, 0x81, 0x00, 0x20, 0x17, 0x08, 0x61, 0x81, 0x00, 0x20, 0x53, 0x00, 0x00, 0x82, 0x00, 0x20,
+    0x29, 0x85, 0x08, 0x31, 0xa6, 0x83, 0x31, 0x86, 0x21, 0x24, 0x00, 0x20, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x32, 0x00, 0x00, 0x7f, 0x00, 0x20, 0x7f, 0x00, 0x20, 0x7f, 0x00,
+    0x20, 0x7f, 0x00, 0x20, 0x7f, 0x00, 0x20, 0x7f, 0x00, 0x20, 0x7f, 0x00, 0x20, 0x7f, 0x00, 0x20,
+    0x7f, 0x00, 0x20, 0x7f, 0x00, 0x20, 0x7f, 0x00, 0x20, 0x6d, 0x00, 0x20, 0x84, 0x21, 0x24, 0x5b,
+    0x2c, 0x7c, 0x10, 0x94, 0xd3, 0x05, 0x94, 0xf3, 0x04, 0x94, 0xd3, 0x85, 0x94, 0xf3, 0x94, 0xd3,
+    0x94, 0xd3, 0x94, 0xf3, 0x94, 0xf3, 0x07, 0x94, 0xd3, 0x8b, 0x8c, 0x93, 0x84, 0x92, 0x8c, 0x72,
+    0x84, 0x71, 0x84, 0x71, 0x84, 0x52, 0x7c, 0x31, 0x7c, 0x51, 0x7c, 0x51, 0x6b, 0x6e, 0x08, 0x81,
+    0x03, 0x00, 0x20, 0x83, 0x31, 0xc7, 0x6b, 0x6d, 0x7c, 0x31, 0x18, 0x94, 0xd3, 0x08, 0x94, 0xf3,
+    0x86, 0x7c, 0x30, 0x00, 0x40, 0x00, 0x20, 0x10, 0xa2, 0x52, 0xcb, 0x7b, 0xf0, 0x1f, 0x7c, 0x51,
+    0x82, 0x6b, 0xaf, 0x10, 0xa2, 0x7e, 0x00, 0x20, 0x86, 0x52, 0xeb, 0xb5, 0xd8, 0xb5, 0xf8, 0xb5,
+    0xf9, 0xb5, 0xf9, 0xb5, 0xf8, 0x1d, 0xb5, 0xf9, 0x87, 0xb5, 0xf8, 0x31, 0xe7, 0x00, 0x20, 0x08,
+    0x82, 0x8c, 0x71, 0xb5, 0xf8, 0xb5, 0xf8, 0x19, 0xb5, 0xf9, 0x06, 0xb5, 0xf8, 0x87, 0xb5, 0xf9,
+    0xa5, 0x97, 0x21, 0x45, 0x00, 0x20, 0x3a, 0x08, 0xa5, 0x76, 0xb5, 0xf8, 0x0f, 0xb5, 0xf9, 0x0e,
+    0xb5, 0xf8, 0x03, 0xb5, 0xf9, 0x82, 0xb5, 0xf8, 0x4a, 0x8a, 0x3d, 0x00, 0x20, 0x40, 0x00, 0x40,
+    0x82, 0x42, 0x48, 0xbd, 0xf8, 0x07, 0xb6, 0x19, 0x14, 0xb5, 0xf9, 0x04, 0xb5, 0xf8, 0x03, 0xb5,
+    0xf9, 0x84, 0x84, 0x71, 0x00, 0x40, 0x00, 0x60, 0x8c, 0xb2, 0x0e, 0xbe, 0x19, 0x15, 0xbe, 0x39,
+    0x84, 0x3a, 0x48, 0x00, 0x40, 0x31, 0xc6, 0xb5, 0xf8, 0x1c, 0xbe, 0x19, 0x83, 0xbe, 0x39, 0xbe,
+    0x19, 0xbe, 0x39, 0x03, 0xbe, 0x19, 0x82, 0x9d, 0x14, 0x08, 0x81, 0x7c, 0x00, 0x40, 0x8b, 0x29,
+    0xa5, 0xc6, 0x59, 0xce, 0x9a, 0xc6, 0x9a, 0xc6, 0x9a, 0xce, 0x9a, 0x9d, 0x14, 0x84, 0x72, 0x7c,
+    0x51, 0x7c, 0x51, 0x84, 0x71, 0x08, 0x7c, 0x51, 0x81, 0x84, 0x51, 0x04, 0x84, 0x71, 0x87, 0x7c,
+    0x51, 0x84, 0x51, 0x7c, 0x51, 0x7c, 0x31, 0x84, 0x71, 0x7c, 0x51, 0x8c, 0xd3, 0x04, 0xc6, 0x5a,
+    0x85, 0xc6, 0x7a, 0x9d, 0x55, 0x08, 0xa2, 0x00, 0x40, 0x7c, 0x30, 0x04, 0xce, 0x9a, 0x88, 0xc6,
+    0x7a, 0x8c, 0xb2, 0x7c, 0x51, 0x7c, 0x51, 0x7c, 0x30, 0x8c, 0x72, 0x8c, 0x72, 0x84, 0x51, 0x03,
+    0x84, 0x71, 0x85, 0x7c, 0x31, 0x7c, 0x31, 0x7c, 0x51, 0x7c, 0x50, 0x7c, 0x30, 0x03, 0x84, 0x71,
+    0x90, 0x7c, 0x50, 0x7c, 0x51, 0x8c, 0x71, 0x8c, 0x71, 0x84, 0x51, 0x84, 0x51, 0x8c, 0x71, 0x84,
+    0x71, 0x8c, 0x92, 0x8c, 0x92, 0x84, 0x71, 0x84, 0x71, 0x5a, 0xeb, 0x00, 0x40, 0x19, 0x03, 0xbe,
+    0x18, 0x04, 0xce, 0x9b, 0x87, 0xa5, 0x55, 0x7c, 0x51, 0x84, 0x51, 0x84, 0x71, 0x84, 0x71, 0x7c,
+    0x51, 0x7c, 0x30, 0x04, 0x84, 0x71, 0x95, 0x8c, 0x92, 0x84, 0x71, 0x84, 0x71, 0x84, 0x51, 0x84,
+    0x51, 0x84, 0x71, 0x84, 0x71, 0x8c, 0x92, 0x8c, 0x92, 0x84, 0x71, 0x84, 0x51, 0x84, 0x71, 0x7c,
+    0x31, 0x8c, 0xd3, 0xce, 0x9a, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0x9a, 0xce, 0x9b, 0xbe, 0x18, 0x19,
+    0x03, 0x7c, 0x00, 0x40, 0x82, 0x10, 0xe3, 0xce, 0x79, 0x04, 0xdf, 0x1c, 0x82, 0xad, 0x95, 0x08,
+    0x81, 0x17, 0x00, 0x40, 0x82, 0x52, 0xca, 0x8c, 0x91, 0x04, 0x8c, 0x71, 0x83, 0x29, 0x65, 0x00,
+    0x40, 0x63, 0x6d, 0x05, 0xdf, 0x1c, 0x81, 0x52, 0xeb, 0x1f, 0x00, 0x40, 0x82, 0x08, 0x81, 0xb5,
+    0xd7, 0x04, 0xdf, 0x1c, 0x82, 0xc6, 0x38, 0x10, 0xe2, 0x17, 0x00, 0x40, 0x81, 0x8c, 0x91, 0x04,
+    0xdf, 0x1c, 0x82, 0xd6, 0xba, 0x3a, 0x07, 0x7c, 0x00, 0x40, 0x82, 0x08, 0xa1, 0xb5, 0xf7, 0x05,
+    0xe7, 0x5d, 0x81, 0x8c, 0x91, 0x1a, 0x7c, 0x0f, 0x82, 0x73, 0xce, 0x31, 0xe6, 0x03, 0x00, 0x40,
+    0x82, 0x3a, 0x27, 0xe7, 0x3c, 0x04, 0xe7, 0x5d, 0x81, 0xce, 0x9a, 0x1b, 0x7c, 0x0f, 0x86, 0x63,
+    0x4c, 0x08, 0xa1, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0xa5, 0x34, 0x04, 0xe7, 0x5d, 0x82, 0xd6,
+    0xdb, 0x29, 0x85, 0x17, 0x00, 0x40, 0x81, 0x6b, 0x6d, 0x04, 0xe7, 0x5d, 0x82, 0xe7, 0x3d, 0x5b,
+    0x0b, 0x7d, 0x00, 0x40, 0x81, 0x94, 0xf3, 0x22, 0xe7, 0x5d, 0x85, 0xde, 0xfb, 0x08, 0x81, 0x00,
+    0x40, 0x29, 0x85, 0xd6, 0xdb, 0x22, 0xe7, 0x5d, 0x84, 0x63, 0x2c, 0x00, 0x40, 0x00, 0x40, 0x7c,
+    0x30, 0x04, 0xe7, 0x5d, 0x82, 0xe7, 0x3c, 0x4a, 0x89, 0x17, 0x00, 0x40, 0x82, 0x42, 0x48, 0xe7,
+    0x3c, 0x04, 0xe7, 0x5d, 0x81, 0x84, 0x30, 0x7d, 0x00, 0x40, 0x81, 0x73, 0xce, 0x23, 0xe7, 0x5d,
+    0x84, 0x8c, 0x71, 0x00, 0x20, 0x10, 0xc2, 0xce, 0x79, 0x22, 0xe7, 0x5d, 0x84, 0xd6, 0xdb, 0x29,
+    0x85, 0x00, 0x40, 0x5b, 0x0b, 0x05, 0xe7, 0x5d, 0x81, 0x6b, 0x8d, 0x17, 0x00, 0x40, 0x82, 0x29,
+    0xa5, 0xd6, 0xdb, 0x04, 0xe7, 0x5d, 0x81, 0xa5, 0x35, 0x7d, 0x00, 0x40, 0x87, 0x4a, 0x89, 0xe7,
+    0x3c, 0xe7, 0x3d, 0xe7, 0x3d, 0xe7, 0x5d, 0xe7, 0x3d, 0xc6, 0x59, 0x17, 0xc6, 0x38, 0x81, 0xde,
+    0xfb, 0x05, 0xe7, 0x5d, 0x84, 0xad, 0x75, 0x00, 0x60, 0x00, 0x40, 0x8c, 0x71, 0x1d, 0xc6, 0x38,
+    0x81, 0xdf, 0x1c, 0x04, 0xdf, 0x3c, 0x85, 0xdf, 0x1c, 0x52, 0xaa, 0x00, 0x40, 0x31, 0xe6, 0xdf,
+    0x1c, 0x04, 0xe7, 0x3c, 0x81, 0x8c, 0xb1, 0x17, 0x00, 0x40, 0x83, 0x10, 0xc2, 0xbe, 0x17, 0xe7,
+    0x3c, 0x03, 0xe7, 0x3d, 0x82, 0xb5, 0xf7, 0x10, 0xc2, 0x7c, 0x00, 0x40, 0x82, 0x29, 0xa5, 0xc6,
+    0x59, 0x04, 0xd6, 0xbb, 0x81, 0x94, 0xb2, 0x17, 0x00, 0x40, 0x88, 0x08, 0xa1, 0xbe, 0x18, 0xde,
+    0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xde, 0xfc, 0xbe, 0x18, 0x08, 0xa1, 0x1f, 0x00, 0x40, 0x90, 0x4a,
+    0x89, 0xce, 0x9a, 0xce, 0xba, 0xce, 0x9a, 0xce, 0xba, 0xce, 0x9a, 0x6b, 0x8d, 0x00, 0x40, 0x19,
+    0x23, 0xbe, 0x38, 0xce, 0xbb, 0xce, 0xba, 0xce, 0xba, 0xd6, 0xba, 0xa5, 0x55, 0x00, 0x60, 0x17,
+    0x00, 0x40, 0x87, 0x9d, 0x34, 0xd6, 0xba, 0xce, 0xba, 0xce, 0xbb, 0xce, 0xbb, 0xc6, 0x39, 0x21,
+    0x44, 0x7c, 0x00, 0x40, 0x82, 0x10, 0xe3, 0xa5, 0x95, 0x04, 0xbe, 0x39, 0x82, 0x94, 0xf3, 0x00,
+    0x60, 0x16, 0x00, 0x40, 0x8a, 0x00, 0x60, 0x8c, 0x91, 0xc6, 0x59, 0xc6, 0x59, 0xc6, 0x5a, 0xc6,
+    0x7a, 0xb5, 0xf7, 0x21, 0x64, 0x00, 0x40, 0x42, 0x89, 0x03, 0x7c, 0x30, 0x83, 0x7c, 0x50, 0x7c,
+    0x30, 0x19, 0x24, 0x17, 0x00, 0x40, 0x8a, 0x21, 0x65, 0xad, 0xb7, 0xb6, 0x18, 0xbe, 0x18, 0xb6,
+    0x18, 0xb6, 0x18, 0x7c, 0x0f, 0x00, 0x40, 0x08, 0x81, 0x95, 0x14, 0x03, 0xbe, 0x38, 0x83, 0xbe,
+    0x39, 0xa5, 0x95, 0x10, 0xc2, 0x17, 0x00, 0x40, 0x87, 0x73, 0xef, 0xbe, 0x39, 0xbe, 0x38, 0xbe,
+    0x39, 0xbe, 0x39, 0xbe, 0x18, 0x29, 0xa6, 0x44, 0x00, 0x40, 0x38, 0x00, 0x60, 0x83, 0x08, 0xa1,
+    0x8c, 0x91, 0xad, 0xd7, 0x03, 0xad, 0xd8, 0x82, 0x9d, 0x33, 0x11, 0x02, 0x16, 0x00, 0x60, 0x8b,
+    0x00, 0x40, 0x63, 0x6d, 0xb5, 0xf7, 0xad, 0xf7, 0xad, 0xf8, 0xad, 0xf8, 0xa5, 0xb6, 0x31, 0xe6,
+    0x00, 0x60, 0x32, 0x06, 0xad, 0xd7, 0x03, 0xad, 0xf8, 0x82, 0xad, 0xf7, 0x5b, 0x6c, 0x17, 0x00,
+    0x60, 0x82, 0x10, 0xe2, 0x9d, 0x55, 0x04, 0xad, 0xd7, 0x84, 0x8c, 0xd3, 0x08, 0xa1, 0x00, 0x60,
+    0x7c, 0x2f, 0x04, 0xad, 0xd7, 0x82, 0xa5, 0x96, 0x21, 0x44, 0x17, 0x00, 0x60, 0x81, 0x52, 0xca,
+    0x03, 0xad, 0xd7, 0x83, 0xad, 0xd8, 0xad, 0xd7, 0x42, 0x89, 0x7d, 0x00, 0x60, 0x83, 0x63, 0x8e,
+    0xa5, 0x96, 0xa5, 0x97, 0x03, 0xa5, 0x96, 0x81, 0x6b, 0xcf, 0x12, 0x4a, 0xaa, 0x04, 0x4a, 0xca,
+    0x84, 0x4a, 0xaa, 0x5b, 0x6d, 0xa5, 0x96, 0xa5, 0xb7, 0x03, 0xad, 0xb7, 0x84, 0x4a, 0xaa, 0x00,
+    0x60, 0x19, 0x44, 0x9d, 0x35, 0x04, 0xa5, 0x97, 0x82, 0x95, 0x14, 0x4a, 0xca, 0x17, 0x4a, 0xaa,
+    0x8b, 0x7c, 0x71, 0x9d, 0x76, 0x9d, 0x76, 0xa5, 0x76, 0x9d, 0x76, 0x8c, 0xd3, 0x10, 0xe2, 0x00,
+    0x60, 0x53, 0x0b, 0xa5, 0x96, 0xa5, 0x76, 0x03, 0xa5, 0x96, 0x81, 0x74, 0x10, 0x17, 0x4a, 0xaa,
+    0x87, 0x52, 0xeb, 0xa5, 0x76, 0xa5, 0x96, 0xa5, 0x96, 0xa5, 0x97, 0xa5, 0x76, 0x5b, 0x2c, 0x7d,
+    0x00, 0x60, 0x81, 0x4a, 0xaa, 0x08, 0x8c, 0xf4, 0x04, 0x94, 0xf4, 0x0e, 0x94, 0xf5, 0x09, 0x95,
+    0x15, 0x85, 0x63, 0x4c, 0x00, 0x60, 0x08, 0xa1, 0x7c, 0x51, 0x95, 0x15, 0x03, 0x94, 0xf4, 0x06,
+    0x94, 0xf5, 0x05, 0x94, 0xf4, 0x09, 0x8c, 0xf4, 0x0a, 0x8c, 0xd4, 0x85, 0x8c, 0xb3, 0x21, 0x44,
+    0x00, 0x60, 0x32, 0x07, 0x8c, 0xd4, 0x05, 0x8c, 0xf4, 0x83, 0x8c, 0xd4, 0x94, 0xd4, 0x8c, 0xf5,
+    0x19, 0x8c, 0xf4, 0x82, 0x8c, 0xf5, 0x63, 0x8e, 0x7d, 0x00, 0x60, 0x82, 0x21, 0x85, 0x8c, 0xd3,
+    0x22, 0x8c, 0xd4, 0x84, 0x63, 0x6d, 0x00, 0x80, 0x00, 0x60, 0x5b, 0x4d, 0x22, 0x8c, 0xd4, 0x85,
+    0x8c, 0xb3, 0x31, 0xc6, 0x00, 0x60, 0x19, 0x23, 0x8c, 0xb3, 0x22, 0x8c, 0xd4, 0x82, 0x6b, 0xcf,
+    0x08, 0xa1, 0x7d, 0x00, 0x60, 0x82, 0x19, 0x23, 0x6b, 0xce, 0x0d, 0x8c, 0xb3, 0x06, 0x84, 0x93,
+    0x0c, 0x84, 0x92, 0x83, 0x74, 0x11, 0x5b, 0x4c, 0x29, 0xa5, 0x03, 0x00, 0x60, 0x83, 0x21, 0x85,
+    0x6b, 0x8e, 0x7c, 0x52, 0x03, 0x84, 0x92, 0x06, 0x84, 0x93, 0x15, 0x8c, 0xb3, 0x88, 0x7c, 0x51,
+    0x63, 0x4d, 0x19, 0x44, 0x00, 0x60, 0x00, 0x60, 0x08, 0xc1, 0x63, 0x8e, 0x84, 0x72, 0x05, 0x8c,
+    0xb3, 0x85, 0x8c, 0x93, 0x8c, 0x93, 0x8c, 0xb3, 0x8c, 0xb3, 0x8c, 0x93, 0x10, 0x8c, 0xb3, 0x88,
+    0x8c, 0x93, 0x8c, 0x93, 0x8c, 0xb3, 0x8c, 0xb3, 0x7c, 0x71, 0x6b, 0xce, 0x3a, 0x48, 0x00, 0x80,
+    0x7f, 0x00, 0x60, 0x7f, 0x00, 0x60, 0x7f, 0x00, 0x60, 0x7f, 0x00, 0x60, 0x7f, 0x00, 0x60, 0x7f,
+    0x00, 0x60, 0x1e, 0x00, 0x60, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00,
+    0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80,
+    0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f,
+    0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x80, 0x72, 0x00, 0x80, 0x7f, 0x00,
+    0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0,
+    0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f,
+    0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x7f, 0x00, 0xa0, 0x0f, 0x00, 0xa0, 0x7f, 0x00,
+    0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0,
+    0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f,
+    0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00,
+    0xc0, 0x81, 0x00, 0xc0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0,
+    0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f,
+    0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00, 0xe0, 0x7f, 0x00,
+    0xe0, 0x0f, 0x00, 0xe0, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00,
+    0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f,
+    0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01,
+    0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x7f, 0x01, 0x00, 0x72, 0x01, 0x00, 0x7f, 0x01, 0x20,
+    0x7f, 0x01, 0x20, 0x7f, 0x01, 0x20, 0x7f, 0x01, 0x20, 0x7f, 0x01, 0x20, 0x7f, 0x01, 0x20, 0x7f,
+    0x01, 0x20, 0x47, 0x01, 0x20, 0x7f, 0x09, 0x20, 0x7f, 0x09, 0x20, 0x7f, 0x09, 0x20, 0x7f, 0x09,
+    0x20, 0x7f, 0x09, 0x20, 0x7f, 0x09, 0x20, 0x7f, 0x09, 0x20, 0x47, 0x09, 0x20, 0x7f, 0x09, 0x40,
+    0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f,
+    0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09,
+    0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40, 0x7f, 0x09, 0x40,
+    0x81, 0x09, 0x40, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f,
+    0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09,
+    0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60, 0x7f, 0x09, 0x60,
+    0x0f, 0x09, 0x60, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f,
+    0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09,
+    0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80,
+    0x7f, 0x09, 0x80, 0x7f, 0x09, 0x80, 0x81, 0x09, 0x80, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f,
+    0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09,
+    0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0,
+    0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x7f, 0x09, 0xa0, 0x81, 0x09, 0xa0, 0x7f,
+    0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09,
+    0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0,
+    0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f, 0x09, 0xc0, 0x7f,
+    0x09, 0xc0, 0x81, 0x09, 0xc0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09,
+    0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0,
+    0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f, 0x09, 0xe0, 0x7f,
+    0x09, 0xe0, 0x0f, 0x09, 0xe0, 0x7f, 0x0a, 0x00, 0x7f, 0x0a, 0x00, 0x7f, 0x0a, 0x00, 0x7f, 0x0a,
+    0x00, 0x7f, 0x0a, 0x00, 0x7f, 0x0a, 0x00, 0x7f, 0x0a, 0x00, 0x7f, 0x0a, 0x00, 0x7f, 0x0a, 0x00,
+    0x7f, 0x0a, 0x00, 0x7f, 0x0a, 0x00, 0x2b, 0x0a, 0x00, 0x7f, 0x0a, 0x01, 0x71, 0x0a, 0x01
+};
@@ -0,0 +1,54 @@
+// This file was generated by squareline/gen_icon_masks.py
+// Source asset: assets/BToff.png (alpha channel only)
+
+#include "../ui.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+// IMAGE DATA: assets/BToff.png as A8 mask
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_bt_mask_data[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x49,0x2D,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x6F,0xE1,0xB9,0x48,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x91,0xFD,0xFC,0xC7,0x54,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x92,0xFD,0xFF,0xFE,0xD1,0x61,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x92,0xFD,0xF3,0xEB,0xFE,0xDB,0x6F,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x2E,0x4F,0x1E,0x00,0x00,0x0A,0x92,0xFD,0xCB,0x81,0xD2,0xFD,0xE4,0x7D,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x9B,0xE6,0x9B,0x2D,0x01,0x0A,0x92,0xFD,0xC1,0x28,0x55,0xC8,0xFD,0xEA,0x83,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x8F,0xF6,0xF6,0xA5,0x30,0x0B,0x92,0xFD,0xC1,0x1F,0x08,0x72,0xED,0xFF,0xCF,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x2B,0xA0,0xF4,0xF7,0xAD,0x40,0x93,0xFD,0xC1,0x22,0x3D,0xB3,0xFA,0xF2,0x91,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x28,0x98,0xF2,0xF9,0xBA,0xC3,0xFD,0xC5,0x61,0xB8,0xFB,0xEE,0x91,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x93,0xEF,0xFC,0xF9,0xFF,0xE9,0xD6,0xFB,0xEC,0x8C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x8C,0xED,0xFF,0xFF,0xFE,0xFE,0xEA,0x83,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x88,0xF1,0xFF,0xFF,0xEC,0x80,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x6A,0xE9,0xFF,0xFF,0xE1,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x63,0xD4,0xFE,0xFF,0xFF,0xFD,0xD0,0x5A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x69,0xD8,0xFE,0xFE,0xFF,0xF4,0xEE,0xFE,0xD3,0x62,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x6E,0xDE,0xFE,0xDB,0xDA,0xFE,0xCD,0x88,0xD9,0xFE,0xD8,0x67,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x77,0xE1,0xFD,0xD0,0x64,0x9B,0xFD,0xC1,0x2A,0x63,0xD5,0xFE,0xDE,0x6C,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x6F,0xE5,0xFD,0xC9,0x54,0x12,0x92,0xFD,0xC1,0x1F,0x0B,0x76,0xED,0xFF,0xC9,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA3,0xF9,0xC3,0x4F,0x06,0x0A,0x92,0xFD,0xC1,0x21,0x31,0xA5,0xF8,0xF9,0xA6,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x4C,0x80,0x40,0x05,0x00,0x0A,0x92,0xFD,0xC4,0x5B,0xAE,0xF7,0xF6,0xA7,0x34,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x09,0x01,0x00,0x00,0x0A,0x92,0xFD,0xE7,0xD1,0xFA,0xF1,0x9A,0x2B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x92,0xFD,0xFE,0xFE,0xEB,0x8B,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x92,0xFD,0xFF,0xE5,0x7E,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x81,0xF6,0xDC,0x71,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x34,0x7D,0x56,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+const lv_image_dsc_t ui_img_bt_mask = {
+    .header.w = 32,
+    .header.h = 32,
+    .header.stride = 32,
+    .data_size = sizeof(ui_img_bt_mask_data),
+    .header.cf = LV_COLOR_FORMAT_A8,
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .data = ui_img_bt_mask_data
+};
+
@@ -0,0 +1,54 @@
+// This file was generated by squareline/gen_icon_masks.py
+// Source asset: assets/tpmsblack.png (alpha channel only)
+
+#include "../ui.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+// IMAGE DATA: assets/tpmsblack.png as A8 mask
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_tpms_mask_data[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x02,0x02,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x02,0x03,0x02,0x01,0x01,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x02,0x03,0x29,0x25,0x0D,0x02,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x02,0x02,0x1C,0x22,0x12,0x02,0x01,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x03,0x4C,0xFB,0xFF,0xA7,0x01,0x02,0x00,0x00,0x01,0x02,0x02,0x02,0x02,0x01,0x00,0x01,0x02,0x2E,0xF1,0xFF,0xCB,0x07,0x02,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x04,0x72,0xFF,0xFF,0xCF,0x01,0x02,0x00,0x01,0x02,0x09,0x2F,0x22,0x02,0x02,0x01,0x01,0x03,0x40,0xFD,0xFF,0xF3,0x0A,0x03,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x05,0x72,0xFF,0xFF,0x78,0x03,0x02,0x01,0x02,0x08,0x91,0xFF,0xEC,0x36,0x03,0x01,0x01,0x03,0x0A,0xD8,0xFF,0xF3,0x0A,0x04,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x03,0x05,0xC8,0xFF,0xF5,0x37,0x03,0x01,0x01,0x03,0x1B,0xFF,0xFF,0xFF,0xA2,0x03,0x02,0x01,0x02,0x03,0xAC,0xFF,0xFC,0x57,0x05,0x02,0x00,0x00,0x00,
+    0x00,0x00,0x02,0x04,0x3A,0xF6,0xFB,0x6F,0x04,0x02,0x01,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x01,0x03,0x18,0xCB,0xFF,0xCB,0x04,0x03,0x01,0x00,0x00,
+    0x00,0x01,0x03,0x02,0xBE,0xFF,0xD1,0x07,0x03,0x01,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x01,0x02,0x04,0x50,0xFC,0xFB,0x4C,0x04,0x02,0x00,0x00,
+    0x00,0x02,0x04,0x49,0xF9,0xD9,0x20,0x04,0x02,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x01,0x03,0x05,0x92,0xFF,0xD0,0x1B,0x03,0x01,0x00,
+    0x01,0x03,0x16,0xCD,0xFF,0x68,0x04,0x02,0x01,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x02,0x03,0x1C,0xD6,0xFF,0x63,0x03,0x02,0x00,
+    0x02,0x03,0x39,0xFF,0xB0,0x07,0x03,0x01,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x01,0x02,0x04,0x2C,0xFF,0xBD,0x02,0x03,0x01,
+    0x02,0x03,0x7B,0xFF,0x67,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x04,0x13,0xD6,0xDE,0x19,0x03,0x01,
+    0x03,0x03,0xB1,0xFF,0x2E,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x03,0x04,0xA5,0xFF,0x39,0x04,0x02,
+    0x03,0x04,0xB4,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0xA5,0xFF,0x5A,0x03,0x02,
+    0x03,0x26,0xFE,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x01,0x03,0x1B,0xFE,0xFF,0xFF,0xA1,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x9A,0xFF,0xAF,0x03,0x02,
+    0x03,0x1D,0xE9,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x0E,0xC3,0xFF,0xFB,0x5D,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0xA5,0xFF,0x86,0x03,0x02,
+    0x03,0x03,0xB1,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x16,0x70,0x50,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0xA5,0xFF,0x51,0x03,0x02,
+    0x03,0x03,0xB1,0xFF,0x2E,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x04,0x05,0x05,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x04,0xA5,0xFF,0x39,0x04,0x02,
+    0x02,0x03,0x9F,0xFF,0x7B,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x09,0x2A,0x1E,0x03,0x02,0x01,0x00,0x00,0x00,0x00,0x01,0x04,0x15,0xDF,0xF9,0x31,0x03,0x01,
+    0x02,0x04,0x38,0xFF,0xB5,0x08,0x03,0x01,0x00,0x00,0x00,0x00,0x02,0x07,0x8A,0xFF,0xE9,0x31,0x02,0x01,0x00,0x00,0x00,0x00,0x02,0x04,0x39,0xFF,0xC5,0x02,0x03,0x01,
+    0x01,0x03,0x12,0xD7,0xFF,0x64,0x04,0x02,0x01,0x00,0x00,0x00,0x02,0x1A,0xFF,0xFF,0xFF,0xA3,0x02,0x01,0x00,0x00,0x00,0x01,0x03,0x0C,0xD9,0xFF,0x70,0x03,0x02,0x00,
+    0x00,0x02,0x03,0x6C,0xFF,0xDF,0x0D,0x04,0x02,0x01,0x01,0x01,0x02,0x09,0xA6,0xFF,0xF6,0x43,0x03,0x02,0x01,0x01,0x01,0x03,0x05,0x62,0xFE,0xE3,0x16,0x03,0x01,0x00,
+    0x00,0x01,0x03,0x14,0xC1,0xFE,0x85,0x06,0x05,0x03,0x03,0x03,0x04,0x05,0x15,0x41,0x33,0x08,0x05,0x04,0x03,0x03,0x04,0x05,0x22,0xDB,0xF9,0x63,0x04,0x02,0x01,0x00,
+    0x00,0x00,0x02,0x04,0x44,0xF8,0xFD,0x7D,0x05,0x04,0x03,0x03,0x04,0x04,0x05,0x06,0x06,0x05,0x04,0x03,0x03,0x03,0x04,0x1F,0xD5,0xFF,0xC4,0x04,0x03,0x01,0x00,0x00,
+    0x00,0x00,0x01,0x03,0x05,0xE6,0xFF,0xFB,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xE4,0xFF,0xFF,0x72,0x05,0x02,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0x05,0xA2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x1A,0x04,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x04,0x71,0xFF,0xFF,0xE2,0x32,0x6D,0xFF,0xF6,0x2B,0x46,0xFF,0xBE,0x24,0x87,0xFF,0xE4,0x24,0x60,0xFF,0xFF,0xF3,0x09,0x03,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x02,0x1D,0x91,0x95,0x7C,0x05,0x35,0x96,0x8F,0x0A,0x1B,0x96,0x6A,0x05,0x47,0x95,0x84,0x08,0x2D,0x96,0x95,0x58,0x04,0x02,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x03,0x03,0x04,0x04,0x02,0x03,0x04,0x03,0x02,0x03,0x04,0x03,0x02,0x03,0x04,0x04,0x03,0x03,0x02,0x02,0x01,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
+};
+const lv_image_dsc_t ui_img_tpms_mask = {
+    .header.w = 32,
+    .header.h = 32,
+    .header.stride = 32,
+    .data_size = sizeof(ui_img_tpms_mask_data),
+    .header.cf = LV_COLOR_FORMAT_A8,
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .data = ui_img_tpms_mask_data
+};
+
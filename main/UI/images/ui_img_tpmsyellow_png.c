@@ -1,58 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.4
-// LVGL version: 9.2.2
-// Project name: SquareLine_Project
-
-#include "../ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/tpmsyellow.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_tpmsyellow_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC6,0xC7,0xBD,0x07,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC6,0xE7,0xC5,0x47,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xCE,0xA7,0xDE,0xC7,0xDE,0xA7,0xDE,0x86,0xD6,0x06,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xBD,0x66,0xD6,0xA6,0xDE,0xA7,0xDE,0xC7,0xDE,0xA7,0xDE,0x48,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xD6,0xC7,0xDE,0xC6,0xDE,0xA6,0x94,0xE7,0xA4,0xE6,0xA4,0x86,0xDE,0x06,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE7,0x07,0xE7,0x07,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xD6,0x46,0xEF,0x07,0xA5,0x46,0xAD,0x27,0xAD,0xE6,0xE6,0xC7,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xD6,0xE6,0xE6,0xAA,0xB5,0xE8,0xDE,0xC6,0xE6,0xA7,0xBD,0xE7,0xFF,0x66,0xD6,0x00,0x00,0x00,0x00,0xE7,0xE6,0x06,0xE7,0x07,0xE7,0x06,0xE7,0x07,0xE7,0xC8,0xDE,0x00,0x00,0x26,0xC6,0xA6,0xDE,0xE4,0x7B,0x88,0xD6,0xC6,0xE6,0x89,0xD6,0x68,0xD6,0xE6,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0xD6,0x06,0xE7,0x8A,0xD6,0x65,0xF7,0x43,0xFF,0xE5,0xBD,0xE7,0xFF,0x86,0xD6,0x00,0x00,0xC7,0xDE,0x06,0xE7,0x47,0xCE,0x89,0xD6,0x48,0xCE,0x25,0xEF,0xE6,0xE6,0x88,0xD6,0x47,0xC6,0xC6,0xDE,0xE4,0x7B,0x04,0xE7,0x43,0xF7,0x07,0xEF,0xC7,0xDE,0xE6,0xE6,0x67,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xDE,0x06,0xE7,0x05,0xDF,0x63,0xF7,0x64,0xF7,0x88,0xD6,0x46,0xF7,0x86,0xD6,0x87,0xB5,0xC7,0xDE,0x87,0xBD,0xC9,0xDE,0x45,0xEF,0x47,0xEF,0x09,0xC6,0x06,0xEF,0x87,0xD6,0xC6,0xB5,0xC6,0xDE,0x40,0x94,0x48,0xEF,0x63,0xF7,0x25,0xEF,0x26,0xEF,0x06,0xE7,0x86,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xCE,0x06,0xE7,0x66,0xF7,0x25,0xCE,0x63,0xF7,0x46,0xEF,0xE6,0x9C,0xE5,0xE6,0x66,0xD6,0xA7,0xBD,0xC6,0xE6,0x48,0xB5,0xC8,0xE6,0x43,0xF7,0x65,0xF7,0xC8,0xBD,0x45,0xF7,0xA7,0xDE,0xA7,0xB5,0xC6,0xDE,0xE5,0xFF,0x27,0xC6,0x65,0xF7,0x45,0xF7,0xA5,0x9C,0x06,0xE7,0xA6,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xA6,0xDE,0x06,0xE7,0xA4,0x9C,0x06,0xE7,0x64,0xF7,0x68,0xD6,0x86,0xFF,0xE6,0xE6,0x87,0xD6,0x07,0xC6,0xE6,0xE6,0x67,0xB5,0xC7,0xE6,0x42,0xFF,0x64,0xF7,0xE6,0xC5,0x25,0xEF,0xA6,0xDE,0x00,0x00,0xC7,0xDE,0x06,0xE7,0x85,0xB5,0x28,0xE7,0x63,0xF7,0xE6,0xC5,0x66,0xF7,0xC6,0xE6,0x66,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xD6,0xC6,0xDE,0xE5,0xFF,0xA7,0xD6,0x65,0xF7,0x67,0xD6,0x85,0xD6,0x06,0xEF,0xC7,0xDE,0x00,0x00,0x07,0xC6,0xC6,0xE6,0x86,0xB5,0xE6,0xE6,0x42,0xF7,0x84,0xF7,0xE6,0xC5,0x25,0xEF,0xA6,0xDE,0x00,0x00,0xA8,0xD6,0xE7,0xE6,0x06,0xE7,0x47,0xAD,0x47,0xEF,0x26,0xEF,0xC7,0xC5,0xC6,0xDE,0xA6,0xDE,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xA6,0xDE,0x06,0xE7,0xE8,0xCD,0x65,0xEF,0x48,0xF7,0x4A,0xD6,0x06,0xE7,0xE7,0xE6,0x00,0x00,0x00,0x00,0x06,0xC6,0xC6,0xDE,0x86,0xB5,0xE6,0xE6,0x42,0xF7,0x84,0xF7,0xE6,0xC5,0x25,0xEF,0xA6,0xDE,0x00,0x00,0x00,0x00,0xA7,0xD6,0xE6,0xE6,0x27,0xEF,0x48,0xCE,0x65,0xF7,0xE7,0xE6,0x04,0x84,0xC6,0xE6,0x86,0xD6,0x00,0x00,0x27,0xCE,0xC6,0xE6,0x04,0x8C,0x87,0xDE,0x46,0xEF,0xC7,0xBD,0x06,0xE7,0x06,0xE7,0xC8,0xDE,0x00,0x00,0x00,0x00,0x06,0xC6,0xC6,0xDE,0x85,0xB5,0xE6,0xE6,0x42,0xF7,0x84,0xF7,0xE6,0xC5,0x25,0xEF,0xA6,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xDE,0xE6,0xE6,0x85,0x94,0x88,0xDE,0x45,0xEF,0xA7,0xB5,0x46,0xEF,0xA6,0xDE,0x00,0x00,
-    0x86,0xDE,0xE6,0xE6,0xA6,0xBD,0xE6,0xE6,0xC7,0xDE,0x88,0xDE,0x06,0xE7,0xC7,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xC6,0xC6,0xDE,0x85,0xB5,0xE6,0xE6,0x43,0xF7,0x85,0xF7,0xE6,0xC5,0x25,0xEF,0xA6,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCE,0xC7,0xDE,0xE6,0xE6,0x48,0xCE,0x45,0xEF,0x66,0xD6,0xE6,0xFF,0xE6,0xE6,0x66,0xD6,0xC6,0xE6,0x65,0xF7,0x07,0xCE,0x85,0xF7,0xC6,0xBD,0x06,0xE7,0xE6,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xC6,0xC6,0xE6,0x85,0xB5,0xE6,0xE6,0x43,0xF7,0x85,0xF7,0xE6,0xC5,0x25,0xEF,0xA6,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xD6,0xC6,0xE6,0xA5,0x9C,0xC7,0xDE,0x25,0xEF,0x07,0xA5,0xE6,0xE6,0xC6,0xDE,
-    0xE5,0xE6,0xE5,0xE6,0xC7,0xDE,0x25,0xEF,0xE8,0xC5,0xC6,0xE6,0x66,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xC6,0xC6,0xE6,0x85,0xB5,0xE6,0xE6,0x43,0xF7,0x85,0xF7,0xE6,0xC5,0x25,0xEF,0x87,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xBD,0xA6,0xDE,0x05,0xE7,0x46,0xD6,0x66,0xF7,0x88,0xD6,0xE6,0xE6,0xA6,0xDE,0xE5,0xE6,0x85,0xBD,0xA6,0xF7,0xA5,0xE6,0x65,0x94,0xC5,0xDE,0xE6,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC6,0xC6,0xE6,0x86,0xB5,0xC6,0xE6,0x63,0xF7,0x64,0xF7,0xE8,0xC5,0x25,0xEF,0x86,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xD6,0x26,0xEF,0x65,0xB5,0x85,0xFF,0x86,0xD6,0x26,0xEF,0xC6,0xDE,
-    0x05,0xEF,0x05,0x84,0xC5,0xDE,0x85,0xDE,0xC3,0x83,0xC5,0xE6,0x85,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xBD,0xC6,0xE6,0x67,0xB5,0xC7,0xE6,0x63,0xF7,0x64,0xF7,0xE7,0xC5,0x25,0xEF,0x86,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xD6,0x46,0xEF,0x25,0xAD,0x85,0xFF,0x85,0xB5,0xE6,0xFF,0xE5,0xE6,0x05,0xEF,0x05,0x84,0x05,0xE7,0xA6,0xE6,0x04,0x8C,0xC5,0xE6,0xC5,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xDE,0x06,0xA5,0xA8,0xD6,0x84,0xF7,0x65,0xEF,0xA6,0xB5,0x26,0xEF,0x87,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xD6,0x45,0xEF,0x25,0xAD,0x85,0xFF,0xE5,0xC5,0x86,0xF7,0xE5,0xDE,
-    0xE5,0xE6,0x25,0xD6,0xA5,0xFF,0xE6,0xEE,0x45,0xAD,0xC5,0xE6,0x26,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0xDE,0xE6,0xE6,0x86,0xB5,0x27,0xCE,0xA6,0xBD,0x26,0xEF,0xC6,0xE6,0x87,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xDE,0x25,0xEF,0xE5,0xC5,0xA6,0xFF,0xC5,0xD6,0x26,0xEF,0xC5,0xDE,0xE5,0xE6,0x06,0xEF,0xE5,0xE6,0x45,0xF7,0xC7,0xDE,0xE6,0xE6,0xA6,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCE,0xC7,0xDE,0xE6,0xE6,0x06,0xE7,0x06,0xE7,0xE6,0xE6,0xA7,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xCE,0xE6,0xE6,0xE5,0xE6,0xE6,0xE6,0x45,0xEF,0x86,0xD6,0xE5,0xE6,0xA6,0xDE,
-    0xE6,0xE6,0xE5,0xFF,0xC6,0xC5,0x85,0xF7,0x47,0xCE,0x06,0xE7,0xE6,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xDE,0xE7,0xE6,0x48,0xCE,0xC8,0xDE,0x49,0xD6,0x06,0xE7,0xC7,0xDE,0x88,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xD6,0xE6,0xE6,0x86,0xB5,0x06,0xE7,0x06,0xE7,0x66,0x94,0x05,0xE7,0x86,0xD6,0xA6,0xDE,0x06,0xE7,0x27,0xCE,0x25,0xEF,0x27,0xEF,0x67,0xD6,0x06,0xE7,0xA7,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xE6,0x66,0xB5,0xC9,0xDE,0x45,0xEF,0x27,0xEF,0xE8,0xC5,0x07,0xE7,0xA8,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xE6,0x06,0xE7,0x67,0xD6,0x64,0xF7,0x85,0xDE,0xE6,0xFF,0xE6,0xE6,0x46,0xD6,
-    0x66,0xD6,0xE6,0xE6,0x65,0x94,0xE6,0xDE,0x46,0xEF,0x66,0xB5,0x06,0xE7,0xE6,0xE6,0x48,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xE6,0xE8,0xA4,0xC8,0xDE,0x44,0xF7,0x65,0xF7,0xA8,0xBD,0x86,0xF7,0xA8,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xD6,0x06,0xE7,0xA6,0xBD,0x68,0xD6,0x65,0xF7,0xE7,0xCD,0x66,0xF7,0xA6,0xDE,0x00,0x00,0x00,0x00,0xC6,0xDE,0x46,0xEF,0x27,0xCE,0x44,0xEF,0xA7,0xDE,0x07,0xC6,0xE6,0xE6,0xA6,0xDE,0x06,0xCE,0xE5,0xC5,0x06,0xC6,0x87,0xDE,0x87,0xB5,0xC7,0xDE,0x45,0xEF,0x46,0xEF,0xE8,0xC5,0xE6,0xE6,0x66,0xD6,0xC5,0xC5,0xE5,0xC5,0x66,0xD6,0xC6,0xDE,0x06,0xE7,0xA9,0xBD,0x66,0xEF,0xE7,0xDE,0x08,0xAD,0xE6,0xE6,0x66,0xD6,0x00,0x00,
-    0x00,0x00,0xA6,0xD6,0xE6,0xE6,0x65,0x94,0xE7,0xE6,0x65,0xF7,0xA9,0xD6,0x06,0xE7,0xE5,0xE6,0xC5,0xE6,0xC5,0xDE,0xA5,0xDE,0xC6,0xDE,0xE6,0xE6,0xA6,0xB5,0x08,0xDF,0x68,0xCE,0x05,0xCE,0xC6,0xE6,0xA5,0xDE,0xA5,0xDE,0xC5,0xDE,0xE5,0xE6,0x06,0xE7,0xA7,0xB5,0x28,0xE7,0x44,0xF7,0x07,0xCE,0x46,0xEF,0xE6,0xE6,0x47,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xDE,0xE6,0xE6,0x88,0xBD,0x46,0xF7,0x06,0xEF,0xC6,0xBD,0xC4,0xFF,0x85,0xFF,0xA5,0xFF,0xC6,0xFF,0x85,0xFF,0x85,0xFF,0x65,0xF7,0x66,0xF7,0x65,0xF7,0x65,0xF7,0x86,0xFF,0x86,0xFF,0xC6,0xFF,0xC5,0xFF,0xA5,0xFF,0x44,0xB5,0x87,0xD6,0x64,0xF7,0xC6,0xDE,0x26,0xEF,0x06,0xE7,0xA7,0xDE,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x87,0xD6,0xE6,0xE6,0x46,0xEF,0xA7,0xDE,0x63,0xF7,0x25,0xF7,0x66,0xDE,0x65,0xD6,0x65,0xD6,0x64,0xD6,0x65,0xD6,0x46,0xD6,0x65,0xD6,0x67,0xD6,0x66,0xD6,0x45,0xD6,0x65,0xD6,0x64,0xD6,0x65,0xD6,0x45,0xD6,0x65,0xD6,0xC7,0xDE,0x84,0xF7,0x64,0xF7,0xC7,0xC5,0x06,0xE7,0xE6,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xDE,0x06,0xE7,0x65,0xCE,0x64,0xF7,0x43,0xF7,0x45,0xF7,0x06,0xEF,0x45,0xEF,0x44,0xFF,0x43,0xF7,0x26,0xEF,0x25,0xEF,0x63,0xF7,0x44,0xF7,0x06,0xEF,0x25,0xF7,0x44,0xF7,0x44,0xF7,0x27,0xEF,0x26,0xF7,0x63,0xF7,0x44,0xFF,0x24,0xEF,0xC6,0xBD,0x06,0xE7,0xA6,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x86,0xD6,0xE6,0xE6,0xE6,0x9C,0xA7,0xF7,0x83,0xFF,0x27,0xE7,0x46,0xB5,0xE8,0xBD,0x46,0xF7,0xA8,0xDE,0x49,0xCE,0xC9,0xE6,0x46,0xF7,0x28,0xEF,0x29,0xD6,0xA7,0xBD,0x66,0xF7,0xC7,0xDE,0x28,0xCE,0x88,0xDE,0x46,0xF7,0x64,0xF7,0x88,0xD6,0xE6,0xC5,0xC6,0xE6,0x26,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xCE,0xC6,0xDE,0xA3,0x73,0x68,0xAD,0x08,0xCE,0x4A,0xCE,0x44,0xF7,0x29,0xA5,0x8A,0xD6,0xCA,0xBD,0x27,0xCE,0x6A,0xD6,0x8B,0xD6,0x8B,0xD6,0x05,0xEF,0xC8,0x9C,0x89,0xD6,0xCA,0xBD,0x05,0xC6,0x0A,0xC6,0x4A,0xCE,0xC8,0xBD,0x29,0xAD,0x86,0xDE,0x87,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xCE,0xE7,0xDE,0x06,0xE7,0x06,0xE7,0xE7,0xE6,0xC7,0xDE,0xC7,0xDE,0xC7,0xDE,0xE7,0xE6,0xC8,0xE6,0xE8,0xE6,0x07,0xE7,0xE7,0xE6,0xE8,0xE6,0xC8,0xE6,0xC7,0xE6,0xC7,0xDE,0xC7,0xDE,0xC7,0xE6,0xC6,0xE6,0xE6,0xE6,0xE7,0xE6,0xA7,0xDE,0x28,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xCE,0xA7,0xD6,0xA7,0xDE,0xA8,0xDE,0x89,0xD6,0x89,0xD6,0x89,0xD6,0x89,0xD6,0x89,0xD6,0xA9,0xDE,0xEA,0xE6,0xE9,0xE6,0x89,0xD6,0x89,0xD6,0x68,0xD6,0x88,0xD6,0x69,0xD6,0x69,0xD6,0xA8,0xDE,0x88,0xDE,0x68,0xD6,0x28,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-    //alpha channel data:
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x02,0x02,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x02,0x03,0x02,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x29,0x25,0x0D,0x02,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x02,0x02,0x1C,0x22,0x12,0x02,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x01,0x03,0x4C,0xFB,0xFF,0xA7,0x01,0x02,0x00,0x00,0x01,0x02,0x02,0x02,0x02,0x01,0x00,0x01,0x02,0x2E,0xF1,0xFF,0xCB,0x07,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x72,0xFF,0xFF,0xCF,0x01,0x02,0x00,0x01,0x02,0x09,0x2F,0x22,0x02,0x02,0x01,0x01,0x03,0x40,0xFD,0xFF,0xF3,0x0A,0x03,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x02,0x05,0x72,0xFF,0xFF,0x78,0x03,0x02,0x01,0x02,0x08,0x91,0xFF,0xEC,0x36,0x03,0x01,0x01,0x03,0x0A,0xD8,0xFF,0xF3,0x0A,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x05,0xC8,0xFF,0xF5,0x37,0x03,0x01,0x01,0x03,0x1B,0xFF,0xFF,0xFF,0xA2,0x03,0x02,0x01,0x02,0x03,0xAC,0xFF,0xFC,0x57,0x05,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x02,0x04,0x3A,0xF6,0xFB,0x6F,0x04,0x02,0x01,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x01,0x03,0x18,0xCB,0xFF,0xCB,0x04,0x03,0x01,0x00,0x00,0x00,0x01,0x03,0x02,0xBE,0xFF,0xD1,0x07,0x03,0x01,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x01,0x02,0x04,0x50,0xFC,0xFB,0x4C,0x04,0x02,0x00,0x00,
-    0x00,0x02,0x04,0x49,0xF9,0xD9,0x20,0x04,0x02,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x01,0x03,0x05,0x92,0xFF,0xD0,0x1B,0x03,0x01,0x00,0x01,0x03,0x16,0xCD,0xFF,0x68,0x04,0x02,0x01,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x02,0x03,0x1C,0xD6,0xFF,0x63,0x03,0x02,0x00,
-    0x02,0x03,0x39,0xFF,0xB0,0x07,0x03,0x01,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x01,0x02,0x04,0x2C,0xFF,0xBD,0x02,0x03,0x01,0x02,0x03,0x7B,0xFF,0x67,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x04,0x13,0xD6,0xDE,0x19,0x03,0x01,
-    0x03,0x03,0xB1,0xFF,0x2E,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x00,0x01,0x03,0x04,0xA5,0xFF,0x39,0x04,0x02,0x03,0x04,0xB4,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x01,0x03,0x1C,0xFE,0xFF,0xFF,0xA2,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0xA5,0xFF,0x5A,0x03,0x02,
-    0x03,0x26,0xFE,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x01,0x03,0x1B,0xFE,0xFF,0xFF,0xA1,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x9A,0xFF,0xAF,0x03,0x02,0x03,0x1D,0xE9,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x0E,0xC3,0xFF,0xFB,0x5D,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0xA5,0xFF,0x86,0x03,0x02,
-    0x03,0x03,0xB1,0xFF,0x2E,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x16,0x70,0x50,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0xA5,0xFF,0x51,0x03,0x02,0x03,0x03,0xB1,0xFF,0x2E,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x04,0x05,0x05,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x04,0xA5,0xFF,0x39,0x04,0x02,
-    0x02,0x03,0x9F,0xFF,0x7B,0x04,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x09,0x2A,0x1E,0x03,0x02,0x01,0x00,0x00,0x00,0x00,0x01,0x04,0x15,0xDF,0xF9,0x31,0x03,0x01,0x02,0x04,0x38,0xFF,0xB5,0x08,0x03,0x01,0x00,0x00,0x00,0x00,0x02,0x07,0x8A,0xFF,0xE9,0x31,0x02,0x01,0x00,0x00,0x00,0x00,0x02,0x04,0x39,0xFF,0xC5,0x02,0x03,0x01,
-    0x01,0x03,0x12,0xD7,0xFF,0x64,0x04,0x02,0x01,0x00,0x00,0x00,0x02,0x1A,0xFF,0xFF,0xFF,0xA3,0x02,0x01,0x00,0x00,0x00,0x01,0x03,0x0C,0xD9,0xFF,0x70,0x03,0x02,0x00,0x00,0x02,0x03,0x6C,0xFF,0xDF,0x0D,0x04,0x02,0x01,0x01,0x01,0x02,0x09,0xA6,0xFF,0xF6,0x43,0x03,0x02,0x01,0x01,0x01,0x03,0x05,0x62,0xFE,0xE3,0x16,0x03,0x01,0x00,
-    0x00,0x01,0x03,0x14,0xC1,0xFE,0x85,0x06,0x05,0x03,0x03,0x03,0x04,0x05,0x15,0x41,0x33,0x08,0x05,0x04,0x03,0x03,0x04,0x05,0x22,0xDB,0xF9,0x63,0x04,0x02,0x01,0x00,0x00,0x00,0x02,0x04,0x44,0xF8,0xFD,0x7D,0x05,0x04,0x03,0x03,0x04,0x04,0x05,0x06,0x06,0x05,0x04,0x03,0x03,0x03,0x04,0x1F,0xD5,0xFF,0xC4,0x04,0x03,0x01,0x00,0x00,
-    0x00,0x00,0x01,0x03,0x05,0xE6,0xFF,0xFB,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xE4,0xFF,0xFF,0x72,0x05,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x05,0xA2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x1A,0x04,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x02,0x04,0x71,0xFF,0xFF,0xE2,0x32,0x6D,0xFF,0xF6,0x2B,0x46,0xFF,0xBE,0x24,0x87,0xFF,0xE4,0x24,0x60,0xFF,0xFF,0xF3,0x09,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x1D,0x91,0x95,0x7C,0x05,0x35,0x96,0x8F,0x0A,0x1B,0x96,0x6A,0x05,0x47,0x95,0x84,0x08,0x2D,0x96,0x95,0x58,0x04,0x02,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x03,0x03,0x04,0x04,0x02,0x03,0x04,0x03,0x02,0x03,0x04,0x03,0x02,0x03,0x04,0x04,0x03,0x03,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
-    
-};
-const lv_image_dsc_t ui_img_tpmsyellow_png = {
-    .header.w = 32,
-    .header.h = 32,
-    .data_size = sizeof(ui_img_tpmsyellow_png_data),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .data = ui_img_tpmsyellow_png_data
-};
-
@@ -29,6 +29,300 @@ lv_obj_t * ui_Image7 = NULL;
 lv_obj_t * ui_Image8 = NULL;
 lv_obj_t * ui_Image9 = NULL;
 lv_obj_t * ui_Image10 = NULL;
+// CONST STYLES (generated by squareline/gen_const_styles.py)
+
+static const lv_style_const_prop_t style_Unit_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Unit_main, style_Unit_main_props);
+
+static const lv_style_const_prop_t style_Label3_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-30),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_FONT(&ui_font_pressure_40),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label3_main, style_Label3_main_props);
+
+static const lv_style_const_prop_t style_Label4_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(30),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_FONT(&ui_font_pressure_40),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label4_main, style_Label4_main_props);
+
+static const lv_style_const_prop_t style_Arc2_main_props[] = {
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_HEIGHT(220),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x11, 0xFF, 0x00)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_WIDTH(3),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Arc2_main, style_Arc2_main_props);
+
+static const lv_style_const_prop_t style_Arc2_indicator_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x4A, 0xFF, 0x40)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Arc2_indicator, style_Arc2_indicator_props);
+
+static const lv_style_const_prop_t style_Arc2_knob_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_SHADOW_WIDTH(4),
+    LV_STYLE_CONST_SHADOW_SPREAD(4),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Arc2_knob, style_Arc2_knob_props);
+
+static const lv_style_const_prop_t style_Arc1_main_props[] = {
+    LV_STYLE_CONST_WIDTH(220),
+    LV_STYLE_CONST_HEIGHT(220),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x2A, 0xFF, 0x00)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_WIDTH(3),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Arc1_main, style_Arc1_main_props);
+
+static const lv_style_const_prop_t style_Arc1_indicator_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x40, 0xFF, 0x4F)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Arc1_indicator, style_Arc1_indicator_props);
+
+static const lv_style_const_prop_t style_Arc1_knob_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_SHADOW_WIDTH(4),
+    LV_STYLE_CONST_SHADOW_SPREAD(4),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Arc1_knob, style_Arc1_knob_props);
+
+static const lv_style_const_prop_t style_Spinner1_main_props[] = {
+    LV_STYLE_CONST_WIDTH(42),
+    LV_STYLE_CONST_HEIGHT(45),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x03, 0x2C, 0x0D)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_WIDTH(15),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Spinner1_main, style_Spinner1_main_props);
+
+static const lv_style_const_prop_t style_Spinner1_indicator_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x00, 0xFF, 0x24)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Spinner1_indicator, style_Spinner1_indicator_props);
+
+static const lv_style_const_prop_t style_Bar1_main_props[] = {
+    LV_STYLE_CONST_WIDTH(57),
+    LV_STYLE_CONST_HEIGHT(10),
+    LV_STYLE_CONST_X(1),
+    LV_STYLE_CONST_Y(-62),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x18, 0x3A, 0x1B)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Bar1_main, style_Bar1_main_props);
+
+static const lv_style_const_prop_t style_Bar1_indicator_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xFF, 0x13)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Bar1_indicator, style_Bar1_indicator_props);
+
+static const lv_style_const_prop_t style_Label5_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-43),
+    LV_STYLE_CONST_Y(50),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_RIGHT),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label5_main, style_Label5_main_props);
+
+static const lv_style_const_prop_t style_Label6_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-43),
+    LV_STYLE_CONST_Y(172),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_TOP_RIGHT),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label6_main, style_Label6_main_props);
+
+static const lv_style_const_prop_t style_Bar2_main_props[] = {
+    LV_STYLE_CONST_WIDTH(57),
+    LV_STYLE_CONST_HEIGHT(10),
+    LV_STYLE_CONST_X(-1),
+    LV_STYLE_CONST_Y(62),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x18, 0x3A, 0x1B)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Bar2_main, style_Bar2_main_props);
+
+static const lv_style_const_prop_t style_Bar2_indicator_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xFF, 0x13)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Bar2_indicator, style_Bar2_indicator_props);
+
+static const lv_style_const_prop_t style_Label7_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-88),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label7_main, style_Label7_main_props);
+
+static const lv_style_const_prop_t style_Label8_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(3),
+    LV_STYLE_CONST_Y(88),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label8_main, style_Label8_main_props);
+
+static const lv_style_const_prop_t style_Image1_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(58),
+    LV_STYLE_CONST_Y(-30),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0xDE, 0x44, 0x41)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image1_main, style_Image1_main_props);
+
+static const lv_style_const_prop_t style_Image3_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(58),
+    LV_STYLE_CONST_Y(30),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0xEE, 0xEA, 0x29)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image3_main, style_Image3_main_props);
+
+static const lv_style_const_prop_t style_Image4_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-36),
+    LV_STYLE_CONST_Y(-70),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image4_main, style_Image4_main_props);
+
+static const lv_style_const_prop_t style_Image5_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-36),
+    LV_STYLE_CONST_Y(65),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image5_main, style_Image5_main_props);
+
+static const lv_style_const_prop_t style_Image6_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-58),
+    LV_STYLE_CONST_Y(-30),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image6_main, style_Image6_main_props);
+
+static const lv_style_const_prop_t style_Image7_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-58),
+    LV_STYLE_CONST_Y(30),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x08, 0xE2, 0xFF)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image7_main, style_Image7_main_props);
+
+static const lv_style_const_prop_t style_Image8_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-93),
+    LV_STYLE_CONST_Y(-4),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image8_main, style_Image8_main_props);
+
+static const lv_style_const_prop_t style_Image9_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(93),
+    LV_STYLE_CONST_Y(-4),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image9_main, style_Image9_main_props);
+
+static const lv_style_const_prop_t style_Image10_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(55),
+    LV_STYLE_CONST_Y(-30),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image10_main, style_Image10_main_props);
+
 // event funtions
 
 // build funtions
@@ -39,253 +333,135 @@ void ui_Main_screen_init(void)
     lv_obj_remove_flag(ui_Main, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Unit = lv_label_create(ui_Main);
-    lv_obj_set_width(ui_Unit, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Unit, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_align(ui_Unit, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Unit, &style_Unit_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Unit, "PSI");
 
     ui_Label3 = lv_label_create(ui_Main);
-    lv_obj_set_width(ui_Label3, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label3, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label3, 0);
-    lv_obj_set_y(ui_Label3, -30);
-    lv_obj_set_align(ui_Label3, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label3, &style_Label3_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label3, "36.1");
-    lv_obj_set_style_text_font(ui_Label3, &lv_font_montserrat_40, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Label4 = lv_label_create(ui_Main);
-    lv_obj_set_width(ui_Label4, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label4, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label4, 0);
-    lv_obj_set_y(ui_Label4, 30);
-    lv_obj_set_align(ui_Label4, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label4, &style_Label4_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label4, "43.5");
-    lv_obj_set_style_text_font(ui_Label4, &lv_font_montserrat_40, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Arc2 = lv_arc_create(ui_Main);
-    lv_obj_set_width(ui_Arc2, 220);
-    lv_obj_set_height(ui_Arc2, 220);
-    lv_obj_set_align(ui_Arc2, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Arc2, &style_Arc2_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_remove_flag(ui_Arc2, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_GESTURE_BUBBLE);      /// Flags
     lv_arc_set_value(ui_Arc2, 80);
     lv_arc_set_bg_angles(ui_Arc2, 240, 300);
-    lv_obj_set_style_arc_color(ui_Arc2, lv_color_hex(0x11FF00), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Arc2, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(ui_Arc2, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_rounded(ui_Arc2, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    lv_obj_set_style_arc_color(ui_Arc2, lv_color_hex(0x4AFF40), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Arc2, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-
-    lv_obj_set_style_bg_color(ui_Arc2, lv_color_hex(0xFFFFFF), LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Arc2, 255, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_shadow_width(ui_Arc2, 4, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_shadow_spread(ui_Arc2, 4, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_left(ui_Arc2, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_right(ui_Arc2, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_top(ui_Arc2, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_bottom(ui_Arc2, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
+
+    lv_obj_add_style(ui_Arc2, &style_Arc2_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Arc2, &style_Arc2_knob, LV_PART_KNOB | LV_STATE_DEFAULT);
 
     ui_Arc1 = lv_arc_create(ui_Main);
-    lv_obj_set_width(ui_Arc1, 220);
-    lv_obj_set_height(ui_Arc1, 220);
-    lv_obj_set_align(ui_Arc1, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Arc1, &style_Arc1_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_remove_flag(ui_Arc1, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_GESTURE_BUBBLE);      /// Flags
     lv_arc_set_value(ui_Arc1, 23);
     lv_arc_set_bg_angles(ui_Arc1, 240, 300);
     lv_arc_set_mode(ui_Arc1, LV_ARC_MODE_REVERSE);
     lv_arc_set_rotation(ui_Arc1, 180);
-    lv_obj_set_style_arc_color(ui_Arc1, lv_color_hex(0x2AFF00), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Arc1, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(ui_Arc1, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_rounded(ui_Arc1, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    lv_obj_set_style_arc_color(ui_Arc1, lv_color_hex(0x40FF4F), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Arc1, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-
-    lv_obj_set_style_bg_color(ui_Arc1, lv_color_hex(0xFFFFFF), LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Arc1, 255, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_shadow_width(ui_Arc1, 4, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_shadow_spread(ui_Arc1, 4, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_left(ui_Arc1, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_right(ui_Arc1, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_top(ui_Arc1, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_bottom(ui_Arc1, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_row(ui_Arc1, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_column(ui_Arc1, 0, LV_PART_KNOB | LV_STATE_DEFAULT);
+
+    lv_obj_add_style(ui_Arc1, &style_Arc1_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Arc1, &style_Arc1_knob, LV_PART_KNOB | LV_STATE_DEFAULT);
 
     ui_Spinner1 = lv_spinner_create(ui_Main);
     //lv_spinner_set_anim_params(ui_Spinner1, 1000, 90);
-    lv_obj_set_width(ui_Spinner1, 42);
-    lv_obj_set_height(ui_Spinner1, 45);
-    lv_obj_set_align(ui_Spinner1, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Spinner1, &style_Spinner1_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Spinner1, LV_OBJ_FLAG_HIDDEN);     /// Flags
     lv_obj_remove_flag(ui_Spinner1, LV_OBJ_FLAG_CLICKABLE);      /// Flags
-    lv_obj_set_style_arc_color(ui_Spinner1, lv_color_hex(0x032C0D), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Spinner1, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(ui_Spinner1, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    lv_obj_set_style_arc_color(ui_Spinner1, lv_color_hex(0x00FF24), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Spinner1, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Spinner1, &style_Spinner1_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT);
 
     ui_Bar1 = lv_bar_create(ui_Main);
     lv_bar_set_range(ui_Bar1, 0, 65);
     lv_bar_set_value(ui_Bar1, 10, LV_ANIM_OFF);
     lv_bar_set_start_value(ui_Bar1, 0, LV_ANIM_OFF);
-    lv_obj_set_width(ui_Bar1, 57);
-    lv_obj_set_height(ui_Bar1, 10);
-    lv_obj_set_x(ui_Bar1, 1);
-    lv_obj_set_y(ui_Bar1, -62);
-    lv_obj_set_align(ui_Bar1, LV_ALIGN_CENTER);
-    lv_obj_set_style_bg_color(ui_Bar1, lv_color_hex(0x183A1B), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Bar1, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    lv_obj_set_style_bg_color(ui_Bar1, lv_color_hex(0x00FF13), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Bar1, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Bar1, &style_Bar1_main, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Bar1, &style_Bar1_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT);
 
     //Compensating for LVGL9.1 draw crash with bar/slider max value when top-padding is nonzero and right-padding is 0
     if(lv_obj_get_style_pad_top(ui_Bar1, LV_PART_MAIN) > 0) lv_obj_set_style_pad_right(ui_Bar1,
                                                                                            lv_obj_get_style_pad_right(ui_Bar1, LV_PART_MAIN) + 1, LV_PART_MAIN);
     ui_Label5 = lv_label_create(ui_Main);
-    lv_obj_set_width(ui_Label5, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label5, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label5, -43);
-    lv_obj_set_y(ui_Label5, 50);
-    lv_obj_set_align(ui_Label5, LV_ALIGN_TOP_RIGHT);
+    lv_obj_add_style(ui_Label5, &style_Label5_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label5, "23.2 C");
 
     ui_Label6 = lv_label_create(ui_Main);
-    lv_obj_set_width(ui_Label6, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label6, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label6, -43);
-    lv_obj_set_y(ui_Label6, 172);
-    lv_obj_set_align(ui_Label6, LV_ALIGN_TOP_RIGHT);
+    lv_obj_add_style(ui_Label6, &style_Label6_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label6, "23.2 C");
 
     ui_Bar2 = lv_bar_create(ui_Main);
     lv_bar_set_range(ui_Bar2, 0, 65);
     lv_bar_set_value(ui_Bar2, 10, LV_ANIM_OFF);
     lv_bar_set_start_value(ui_Bar2, 0, LV_ANIM_OFF);
-    lv_obj_set_width(ui_Bar2, 57);
-    lv_obj_set_height(ui_Bar2, 10);
-    lv_obj_set_x(ui_Bar2, -1);
-    lv_obj_set_y(ui_Bar2, 62);
-    lv_obj_set_align(ui_Bar2, LV_ALIGN_CENTER);
-    lv_obj_set_style_bg_color(ui_Bar2, lv_color_hex(0x183A1B), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Bar2, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    lv_obj_set_style_bg_color(ui_Bar2, lv_color_hex(0x00FF13), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Bar2, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Bar2, &style_Bar2_main, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Bar2, &style_Bar2_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT);
 
     //Compensating for LVGL9.1 draw crash with bar/slider max value when top-padding is nonzero and right-padding is 0
     if(lv_obj_get_style_pad_top(ui_Bar2, LV_PART_MAIN) > 0) lv_obj_set_style_pad_right(ui_Bar2,
                                                                                            lv_obj_get_style_pad_right(ui_Bar2, LV_PART_MAIN) + 1, LV_PART_MAIN);
     ui_Label7 = lv_label_create(ui_Main);
-    lv_obj_set_width(ui_Label7, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label7, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label7, 0);
-    lv_obj_set_y(ui_Label7, -88);
-    lv_obj_set_align(ui_Label7, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label7, &style_Label7_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label7, "80%");
 
     ui_Label8 = lv_label_create(ui_Main);
-    lv_obj_set_width(ui_Label8, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label8, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label8, 3);
-    lv_obj_set_y(ui_Label8, 88);
-    lv_obj_set_align(ui_Label8, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label8, &style_Label8_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label8, "80%");
 
     ui_Image1 = lv_image_create(ui_Main);
-    lv_image_set_src(ui_Image1, &ui_img_tpmsred_png);
-    lv_obj_set_width(ui_Image1, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image1, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image1, 58);
-    lv_obj_set_y(ui_Image1, -30);
-    lv_obj_set_align(ui_Image1, LV_ALIGN_CENTER);
+    lv_image_set_src(ui_Image1, &ui_img_tpms_mask);
+    lv_obj_add_style(ui_Image1, &style_Image1_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image1, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image1, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
     lv_image_set_scale(ui_Image1, 220);
 
     ui_Image3 = lv_image_create(ui_Main);
-    lv_image_set_src(ui_Image3, &ui_img_tpmsyellow_png);
-    lv_obj_set_width(ui_Image3, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image3, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image3, 58);
-    lv_obj_set_y(ui_Image3, 30);
-    lv_obj_set_align(ui_Image3, LV_ALIGN_CENTER);
+    lv_image_set_src(ui_Image3, &ui_img_tpms_mask);
+    lv_obj_add_style(ui_Image3, &style_Image3_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image3, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image3, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
     lv_image_set_scale(ui_Image3, 220);
 
     ui_Image4 = lv_image_create(ui_Main);
     lv_image_set_src(ui_Image4, &ui_img_temp_png);
-    lv_obj_set_width(ui_Image4, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image4, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image4, -36);
-    lv_obj_set_y(ui_Image4, -70);
-    lv_obj_set_align(ui_Image4, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Image4, &style_Image4_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image4, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image4, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
     lv_image_set_rotation(ui_Image4, 4);
 
     ui_Image5 = lv_image_create(ui_Main);
     lv_image_set_src(ui_Image5, &ui_img_temp_png);
-    lv_obj_set_width(ui_Image5, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image5, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image5, -36);
-    lv_obj_set_y(ui_Image5, 65);
-    lv_obj_set_align(ui_Image5, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Image5, &style_Image5_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image5, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image5, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Image6 = lv_image_create(ui_Main);
-    lv_image_set_src(ui_Image6, &ui_img_btoff_png);
-    lv_obj_set_width(ui_Image6, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image6, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image6, -58);
-    lv_obj_set_y(ui_Image6, -30);
-    lv_obj_set_align(ui_Image6, LV_ALIGN_CENTER);
+    lv_image_set_src(ui_Image6, &ui_img_bt_mask);
+    lv_obj_add_style(ui_Image6, &style_Image6_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image6, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image6, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Image7 = lv_image_create(ui_Main);
-    lv_image_set_src(ui_Image7, &ui_img_bton_png);
-    lv_obj_set_width(ui_Image7, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image7, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image7, -58);
-    lv_obj_set_y(ui_Image7, 30);
-    lv_obj_set_align(ui_Image7, LV_ALIGN_CENTER);
+    lv_image_set_src(ui_Image7, &ui_img_bt_mask);
+    lv_obj_add_style(ui_Image7, &style_Image7_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image7, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image7, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Image8 = lv_image_create(ui_Main);
     lv_image_set_src(ui_Image8, &ui_img_idle_png);
-    lv_obj_set_width(ui_Image8, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image8, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image8, -93);
-    lv_obj_set_y(ui_Image8, -4);
-    lv_obj_set_align(ui_Image8, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Image8, &style_Image8_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image8, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image8, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Image9 = lv_image_create(ui_Main);
     lv_image_set_src(ui_Image9, &ui_img_alert_png);
-    lv_obj_set_width(ui_Image9, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image9, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image9, 93);
-    lv_obj_set_y(ui_Image9, -4);
-    lv_obj_set_align(ui_Image9, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Image9, &style_Image9_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image9, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image9, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Image10 = lv_image_create(ui_Main);
-    lv_image_set_src(ui_Image10, &ui_img_tpmsblack_png);
-    lv_obj_set_width(ui_Image10, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image10, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image10, 55);
-    lv_obj_set_y(ui_Image10, -30);
-    lv_obj_set_align(ui_Image10, LV_ALIGN_CENTER);
+    lv_image_set_src(ui_Image10, &ui_img_tpms_mask);
+    lv_obj_add_style(ui_Image10, &style_Image10_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image10, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_Image10, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
     lv_image_set_scale(ui_Image10, 220);
@@ -12,6 +12,80 @@ lv_obj_t * ui_Label11 = NULL;
 lv_obj_t * ui_Spinner4 = NULL;
 lv_obj_t * ui_Label12 = NULL;
 lv_obj_t * ui_Label13 = NULL;
+// CONST STYLES (generated by squareline/gen_const_styles.py)
+
+static const lv_style_const_prop_t style_Label9_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(-2),
+    LV_STYLE_CONST_Y(-50),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label9_main, style_Label9_main_props);
+
+static const lv_style_const_prop_t style_Label10_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-23),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label10_main, style_Label10_main_props);
+
+static const lv_style_const_prop_t style_Label11_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(4),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFF, 0x00, 0x00)),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label11_main, style_Label11_main_props);
+
+static const lv_style_const_prop_t style_Spinner4_main_props[] = {
+    LV_STYLE_CONST_WIDTH(37),
+    LV_STYLE_CONST_HEIGHT(34),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(45),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_ARC_WIDTH(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Spinner4_main, style_Spinner4_main_props);
+
+static const lv_style_const_prop_t style_Spinner4_indicator_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x00, 0xFF, 0x24)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_WIDTH(5),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Spinner4_indicator, style_Spinner4_indicator_props);
+
+static const lv_style_const_prop_t style_Label12_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(87),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label12_main, style_Label12_main_props);
+
+static const lv_style_const_prop_t style_Label13_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(44),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label13_main, style_Label13_main_props);
+
 // event funtions
 
 // build funtions
@@ -22,60 +96,30 @@ void ui_Pair_screen_init(void)
     lv_obj_remove_flag(ui_Pair, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Label9 = lv_label_create(ui_Pair);
-    lv_obj_set_width(ui_Label9, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label9, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label9, -2);
-    lv_obj_set_y(ui_Label9, -50);
-    lv_obj_set_align(ui_Label9, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label9, &style_Label9_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label9, "SEARCHING FOR SENSOR");
 
     ui_Label10 = lv_label_create(ui_Pair);
-    lv_obj_set_width(ui_Label10, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label10, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label10, 0);
-    lv_obj_set_y(ui_Label10, -23);
-    lv_obj_set_align(ui_Label10, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label10, &style_Label10_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label10, " - FRONT WHEEL -");
 
     ui_Label11 = lv_label_create(ui_Pair);
-    lv_obj_set_width(ui_Label11, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label11, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label11, 0);
-    lv_obj_set_y(ui_Label11, 4);
-    lv_obj_set_align(ui_Label11, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label11, &style_Label11_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label11, "NOT YET FOUND");
-    lv_obj_set_style_text_color(ui_Label11, lv_color_hex(0xFF0000), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_opa(ui_Label11, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Spinner4 = lv_spinner_create(ui_Pair);
     //lv_spinner_set_anim_params(ui_Spinner4, 1000, 90);
-    lv_obj_set_width(ui_Spinner4, 37);
-    lv_obj_set_height(ui_Spinner4, 34);
-    lv_obj_set_x(ui_Spinner4, 0);
-    lv_obj_set_y(ui_Spinner4, 45);
-    lv_obj_set_align(ui_Spinner4, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Spinner4, &style_Spinner4_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_remove_flag(ui_Spinner4, LV_OBJ_FLAG_CLICKABLE);      /// Flags
-    lv_obj_set_style_arc_width(ui_Spinner4, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    lv_obj_set_style_arc_color(ui_Spinner4, lv_color_hex(0x00FF24), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Spinner4, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(ui_Spinner4, 5, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_rounded(ui_Spinner4, true, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Spinner4, &style_Spinner4_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT);
 
     ui_Label12 = lv_label_create(ui_Pair);
-    lv_obj_set_width(ui_Label12, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label12, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label12, 0);
-    lv_obj_set_y(ui_Label12, 87);
-    lv_obj_set_align(ui_Label12, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label12, &style_Label12_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label12, "LEFT: 60s");
 
     ui_Label13 = lv_label_create(ui_Pair);
-    lv_obj_set_width(ui_Label13, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Label13, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label13, 0);
-    lv_obj_set_y(ui_Label13, 44);
-    lv_obj_set_align(ui_Label13, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label13, &style_Label13_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label13, "PRESS 'PAIR' BUTTON");
     lv_obj_add_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);     /// Flags
 
@@ -11,6 +11,60 @@ lv_obj_t * ui_Splash = NULL;
 lv_obj_t * ui_Label2 = NULL;
 lv_obj_t * ui_Image2 = NULL;
 lv_obj_t * ui_Spinner3 = NULL;
+// CONST STYLES (generated by squareline/gen_const_styles.py)
+
+static const lv_style_const_prop_t style_Splash_main_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x0E, 0x43, 0x08)),
+    LV_STYLE_CONST_BG_MAIN_STOP(100),
+    LV_STYLE_CONST_BG_GRAD_STOP(255),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Splash_main, style_Splash_main_props);
+
+static const lv_style_const_prop_t style_Label2_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(100),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Label2_main, style_Label2_main_props);
+
+static const lv_style_const_prop_t style_Image2_main_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-24),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Image2_main, style_Image2_main_props);
+
+static const lv_style_const_prop_t style_Spinner3_main_props[] = {
+    LV_STYLE_CONST_WIDTH(37),
+    LV_STYLE_CONST_HEIGHT(34),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(45),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_ARC_WIDTH(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Spinner3_main, style_Spinner3_main_props);
+
+static const lv_style_const_prop_t style_Spinner3_indicator_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x00, 0xFF, 0x24)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_WIDTH(5),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_Spinner3_indicator, style_Spinner3_indicator_props);
+
 // event funtions
 
 // build funtions
@@ -19,46 +73,24 @@ void ui_Splash_screen_init(void)
 {
     ui_Splash = lv_obj_create(NULL);
     lv_obj_remove_flag(ui_Splash, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_obj_set_style_bg_color(ui_Splash, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_Splash, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_color(ui_Splash, lv_color_hex(0x0E4308), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_main_stop(ui_Splash, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_stop(ui_Splash, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_dir(ui_Splash, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Splash, &style_Splash_main, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Label2 = lv_label_create(ui_Splash);
-    lv_obj_set_width(ui_Label2, lv_pct(100));
-    lv_obj_set_height(ui_Label2, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Label2, 0);
-    lv_obj_set_y(ui_Label2, 100);
-    lv_obj_set_align(ui_Label2, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Label2, &style_Label2_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_label_set_text(ui_Label2, "V0.0.1");
-    lv_obj_set_style_text_align(ui_Label2, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
 
     ui_Image2 = lv_image_create(ui_Splash);
     lv_image_set_src(ui_Image2, &ui_img_942102620);
-    lv_obj_set_width(ui_Image2, LV_SIZE_CONTENT);   /// 1
-    lv_obj_set_height(ui_Image2, LV_SIZE_CONTENT);    /// 1
-    lv_obj_set_x(ui_Image2, 0);
-    lv_obj_set_y(ui_Image2, -24);
-    lv_obj_set_align(ui_Image2, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Image2, &style_Image2_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_add_flag(ui_Image2, LV_OBJ_FLAG_ADV_HITTEST);     /// Flags
     lv_obj_remove_flag(ui_Image2, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
     ui_Spinner3 = lv_spinner_create(ui_Splash);
     //lv_spinner_set_anim_params(ui_Spinner3, 1000, 90);
-    lv_obj_set_width(ui_Spinner3, 37);
-    lv_obj_set_height(ui_Spinner3, 34);
-    lv_obj_set_x(ui_Spinner3, 0);
-    lv_obj_set_y(ui_Spinner3, 45);
-    lv_obj_set_align(ui_Spinner3, LV_ALIGN_CENTER);
+    lv_obj_add_style(ui_Spinner3, &style_Spinner3_main, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_remove_flag(ui_Spinner3, LV_OBJ_FLAG_CLICKABLE);      /// Flags
-    lv_obj_set_style_arc_width(ui_Spinner3, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-    lv_obj_set_style_arc_color(ui_Spinner3, lv_color_hex(0x00FF24), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_Spinner3, 255, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(ui_Spinner3, 5, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_rounded(ui_Spinner3, true, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_add_style(ui_Spinner3, &style_Spinner3_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT);
 
     uic_Splash = ui_Splash;
     uic_Spinner3 = ui_Spinner3;
@@ -32,12 +32,10 @@ void ui_init(void)
     lv_theme_t * theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
                                                true, LV_FONT_DEFAULT);
     lv_disp_set_theme(dispp, theme);
-    ui_Splash_screen_init();
-    ui_Main_screen_init();
-    ui_Black_screen_init();
-    ui_Pair_screen_init();
+    // Screens are created on first use and one-shot screens deleted again
+    // by UIController (createScreen/loadScreen), see README "Screen Lifecycle".
+    // Re-apply this after a SquareLine export.
     ui____initial_actions0 = lv_obj_create(NULL);
-    lv_disp_load_scr(ui_Splash);
 }
 
 void ui_destroy(void)
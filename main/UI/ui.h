@@ -40,14 +40,14 @@ extern lv_obj_t * ui____initial_actions0;
 
 // IMAGES AND IMAGE SETS
 LV_IMG_DECLARE(ui_img_942102620);    // assets/splashlogo-pms.png
-LV_IMG_DECLARE(ui_img_tpmsred_png);    // assets/tpmsred.png
-LV_IMG_DECLARE(ui_img_tpmsyellow_png);    // assets/tpmsyellow.png
 LV_IMG_DECLARE(ui_img_temp_png);    // assets/temp.png
-LV_IMG_DECLARE(ui_img_btoff_png);    // assets/BToff.png
-LV_IMG_DECLARE(ui_img_bton_png);    // assets/BTon.png
 LV_IMG_DECLARE(ui_img_idle_png);    // assets/idle.png
 LV_IMG_DECLARE(ui_img_alert_png);    // assets/alert.png
-LV_IMG_DECLARE(ui_img_tpmsblack_png);    // assets/tpmsblack.png
+LV_IMG_DECLARE(ui_img_tpms_mask);    // assets/tpmsblack.png (A8, gen_icon_masks.py)
+LV_IMG_DECLARE(ui_img_bt_mask);    // assets/BToff.png (A8, gen_icon_masks.py)
+
+// FONTS
+LV_FONT_DECLARE(ui_font_pressure_40);    // Montserrat 40 "-.0-9" (A8, gen_digit_font.py)
 
 // UI INIT
 void ui_init(void);
@@ -0,0 +1,150 @@
+/**
+ * @file UICommandQueue.cpp
+ * @brief Preallocated cross-task queue of UI commands implementation
+ */
+
+#include "UICommandQueue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "UICommandQueue";
+
+/**
+ * @enum Coalesce
+ * @brief How a repeated command is merged into the queued ones
+ */
+enum class Coalesce : uint8_t {
+	None,    ///< Always queued
+	Queued,  ///< Dropped while a command of the same type is queued
+	Tail,    ///< Replaces the newest queued command if it has the same type
+};
+
+/// Coalescing rule, indexed by UICommand::Type
+static const Coalesce COALESCE[] = {
+	Coalesce::None,    // ShowMainScreen
+	Coalesce::None,    // ShowPairScreen
+	Coalesce::None,    // ShowWiFiScreen
+	Coalesce::Queued,  // UpdateLabels
+	Coalesce::Tail,    // SetPairingView
+	Coalesce::Tail,    // SetPairingTimeout
+};
+static_assert(sizeof(COALESCE) / sizeof(COALESCE[0]) ==
+			  static_cast<size_t>(UICommand::Type::Count),
+			  "COALESCE does not match UICommand::Type");
+
+/**
+ * @brief Get singleton instance
+ * @return Reference to the UICommandQueue singleton
+ */
+UICommandQueue &UICommandQueue::instance() {
+	static UICommandQueue queue;
+	return queue;
+}
+
+/**
+ * @brief Post a command
+ * @param cmd Command to copy into the queue
+ * @return false if the queue was full and the command was dropped
+ */
+bool UICommandQueue::post(const UICommand &cmd) {
+	const int64_t now = esp_timer_get_time();
+	const size_t typeIndex = static_cast<size_t>(cmd.type);
+	const uint32_t typeBit = 1UL << typeIndex;
+	bool queued = true;
+	bool dropped = false;
+
+	portENTER_CRITICAL(&m_lock);
+	const size_t tail = (m_head + m_count + CAPACITY - 1) % CAPACITY;
+	if (COALESCE[typeIndex] == Coalesce::Queued && (m_queuedTypes & typeBit)) {
+		m_coalesceCount++;
+		queued = false;
+	} else if (COALESCE[typeIndex] == Coalesce::Tail && m_count > 0 &&
+			   m_ring[tail].type == cmd.type) {
+		const int64_t postedUs = m_ring[tail].postedUs;
+		m_ring[tail] = cmd;
+		m_ring[tail].postedUs = postedUs;
+		m_coalesceCount++;
+		queued = false;
+	} else if (m_count == CAPACITY) {
+		m_dropCount++;
+		dropped = true;
+	} else {
+		UICommand &slot = m_ring[(m_head + m_count) % CAPACITY];
+		slot = cmd;
+		slot.postedUs = now;
+		m_count++;
+		m_queuedTypes |= typeBit;
+	}
+	TaskHandle_t consumer = m_consumer;
+	portEXIT_CRITICAL(&m_lock);
+
+	if (dropped) {
+		ESP_LOGW(TAG, "Queue full, dropped command %u", static_cast<unsigned>(typeIndex));
+		return false;
+	}
+	if (queued && consumer != nullptr) {
+		xTaskNotifyGive(consumer);
+	}
+	return true;
+}
+
+/**
+ * @brief Post a command without payload
+ * @param type Command type
+ * @return false if the queue was full and the command was dropped
+ */
+bool UICommandQueue::post(UICommand::Type type) {
+	UICommand cmd = {};
+	cmd.type = type;
+	return post(cmd);
+}
+
+/**
+ * @brief Take the oldest command
+ * @param cmd Receives the command
+ * @return false if the queue is empty
+ * @details The type bit is cleared when the last queued command of the type
+ *          is taken.
+ */
+bool UICommandQueue::pop(UICommand &cmd) {
+	portENTER_CRITICAL(&m_lock);
+	if (m_count == 0) {
+		portEXIT_CRITICAL(&m_lock);
+		return false;
+	}
+	cmd = m_ring[m_head];
+	m_head = (m_head + 1) % CAPACITY;
+	m_count--;
+
+	bool typeQueued = false;
+	for (size_t i = 0; i < m_count; i++) {
+		if (m_ring[(m_head + i) % CAPACITY].type == cmd.type) {
+			typeQueued = true;
+			break;
+		}
+	}
+	if (!typeQueued) {
+		m_queuedTypes &= ~(1UL << static_cast<size_t>(cmd.type));
+	}
+	portEXIT_CRITICAL(&m_lock);
+	return true;
+}
+
+/**
+ * @brief Execute the queued commands in posting order
+ * @param handler Function executing one command
+ * @return Number of commands executed
+ */
+size_t UICommandQueue::drain(Handler handler) {
+	portENTER_CRITICAL(&m_lock);
+	size_t pending = m_count;
+	portEXIT_CRITICAL(&m_lock);
+
+	size_t executed = 0;
+	UICommand cmd;
+	while (executed < pending && pop(cmd)) {
+		handler(cmd);
+		executed++;
+	}
+	return executed;
+}
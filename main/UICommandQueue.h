@@ -0,0 +1,147 @@
+/**
+ * @file UICommandQueue.h
+ * @brief Preallocated cross-task queue of UI commands
+ * @details LVGL may only be used from the LVGL task. Other tasks (control
+ *          loop, pairing, BLE) post typed commands here instead of calling
+ *          lv_async_call(), which allocates a timer in the LVGL heap from a
+ *          foreign task. The LVGL task drains the queue once per frame.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct UICommand
+ * @brief One UI update posted to the LVGL task
+ */
+struct UICommand {
+	/**
+	 * @enum Type
+	 * @brief Command types
+	 */
+	enum class Type : uint8_t {
+		ShowMainScreen,     ///< Load the main sensor screen
+		ShowPairScreen,     ///< Load the pairing screen
+		ShowWiFiScreen,     ///< Load the splash screen with the WiFi mode label
+		UpdateLabels,       ///< Redraw the main screen from State (collapsed while queued)
+		SetPairingView,     ///< Set all pairing screen widgets (replaces a queued view)
+		SetPairingTimeout,  ///< Set the pairing countdown (replaces a queued countdown)
+		Count
+	};
+
+	/**
+	 * @struct PairingView
+	 * @brief Content of the pairing screen widgets
+	 */
+	struct PairingView {
+		char wheel[16];         ///< Wheel title (ui_Label10)
+		char status[24];        ///< Status text or sensor address (ui_Label11)
+		uint32_t statusColor;   ///< Status text color, RGB888
+		bool spinner;           ///< Show the scan spinner (ui_Spinner4)
+		bool buttonIcon;        ///< Show the "press button" icon (ui_Label13)
+		char timeout[8];        ///< Countdown text (ui_Label12)
+	};
+
+	Type type;                  ///< What to do
+	PairingView pairing;        ///< Payload of SetPairingView, `timeout` of SetPairingTimeout
+	int64_t postedUs;           ///< Set by post(): time the command was queued (kept when coalesced)
+};
+
+/**
+ * @class UICommandQueue
+ * @brief Fixed-size ring of UI commands, safe to post to from any task
+ * @details Singleton. post() copies the command into a preallocated slot
+ *          under a spinlock and never allocates. Repeated commands are
+ *          coalesced:
+ *          - UpdateLabels is dropped while one is still queued, it reads the
+ *            latest State anyway
+ *          - SetPairingView and SetPairingTimeout replace the payload of the
+ *            newest queued command if it has the same type, so the order of
+ *            the other commands is kept
+ *
+ *          The consumer task is notified (xTaskNotifyGive) on each post.
+ */
+class UICommandQueue {
+public:
+	/**
+	 * @brief Function executing a command in the LVGL task
+	 */
+	using Handler = void (*)(const UICommand &cmd);
+
+	/**
+	 * @brief Get singleton instance
+	 * @return Reference to the UICommandQueue singleton
+	 */
+	static UICommandQueue &instance();
+
+	/**
+	 * @brief Post a command
+	 * @param cmd Command to copy into the queue
+	 * @return false if the queue was full and the command was dropped
+	 */
+	bool post(const UICommand &cmd);
+
+	/**
+	 * @brief Post a command without payload
+	 * @param type Command type
+	 * @return false if the queue was full and the command was dropped
+	 */
+	bool post(UICommand::Type type);
+
+	/**
+	 * @brief Set the task notified when a command is posted
+	 * @param task Task draining the queue (the LVGL task)
+	 */
+	void setConsumer(TaskHandle_t task) { m_consumer = task; }
+
+	/**
+	 * @brief Execute the queued commands in posting order
+	 * @param handler Function executing one command
+	 * @return Number of commands executed
+	 * @details Only the commands queued when drain() starts are executed, so
+	 *          a handler posting commands cannot keep the LVGL task busy. The
+	 *          lock is not held while the handler runs.
+	 */
+	size_t drain(Handler handler);
+
+	/**
+	 * @brief Get the number of commands dropped because the queue was full
+	 * @return Dropped commands since boot
+	 */
+	uint32_t getDropCount() const { return m_dropCount; }
+
+	/**
+	 * @brief Get the number of commands merged into a queued one
+	 * @return Coalesced commands since boot
+	 */
+	uint32_t getCoalesceCount() const { return m_coalesceCount; }
+
+private:
+	UICommandQueue() = default;
+	~UICommandQueue() = default;
+
+	UICommandQueue(const UICommandQueue &) = delete;
+	UICommandQueue &operator=(const UICommandQueue &) = delete;
+
+	/**
+	 * @brief Take the oldest command
+	 * @param cmd Receives the command
+	 * @return false if the queue is empty
+	 */
+	bool pop(UICommand &cmd);
+
+	static constexpr size_t CAPACITY = 16;  ///< Commands queued at most (drained every frame)
+
+	UICommand m_ring[CAPACITY] = {};  ///< Command slots
+	size_t m_head = 0;                ///< Index of the oldest command
+	size_t m_count = 0;               ///< Number of queued commands
+	uint32_t m_queuedTypes = 0;       ///< Bit per UICommand::Type with a queued command
+	uint32_t m_dropCount = 0;         ///< Commands dropped (queue full)
+	uint32_t m_coalesceCount = 0;     ///< Commands merged into a queued one
+	TaskHandle_t m_consumer = nullptr; ///< Task notified on post
+	portMUX_TYPE m_lock = portMUX_INITIALIZER_UNLOCKED;  ///< Guards the ring
+};
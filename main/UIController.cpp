@@ -6,16 +6,80 @@
  *          and unit conversions (PSI/BAR).
  */
 
+// The per-screen LVGL heap report is logged at INFO. The committed sdkconfig
+// compiles out everything below ERROR, so this file keeps its INFO lines.
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+
 #include "UIController.h"
 #include "Application.h"
+#include "BacklightController.h"
+#include "BootTimeline.h"
+#include "LatencyTracker.h"
 #include "State.h"
 #include "UI/ui.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_log.h"
 #include "lvgl.h"
+#include "src/display/lv_display_private.h"
 #include <cstdio>
 
+static const char *TAG = "UIController";
+
+// Recolor values for the A8 state icons (ui_img_tpms_mask, ui_img_bt_mask)
+static constexpr uint32_t ICON_COLOR_TPMS_LOW = 0xDE4441;  ///< Pressure < 75% of ideal
+static constexpr uint32_t ICON_COLOR_TPMS_WARN = 0xEEEA29; ///< Pressure < 90% of ideal
+static constexpr uint32_t ICON_COLOR_BT_ON = 0x08E2FF;     ///< Sensor seen recently
+static constexpr uint32_t ICON_COLOR_OFF = 0x000000;       ///< Inactive / no data
+
+/**
+ * @brief Set the recolor of an A8 mask icon
+ * @param icon Image object showing an A8 mask
+ * @param color RGB888 color
+ * @details State icons share one alpha mask per shape, so a state change is a
+ *          style change. The current value is checked first so an unchanged
+ *          state does not invalidate the icon area.
+ */
+static void setIconColor(lv_obj_t *icon, uint32_t color) {
+	lv_color_t c = lv_color_hex(color);
+	if (lv_color_eq(lv_obj_get_style_image_recolor(icon, LV_PART_MAIN), c)) {
+		return;
+	}
+	lv_obj_set_style_image_recolor(icon, c, LV_PART_MAIN);
+}
+
+/**
+ * @struct ScreenDef
+ * @brief SquareLine screen object and its generated init/destroy functions
+ */
+struct ScreenDef {
+	const char *name;          ///< Name used in log output
+	lv_obj_t **obj;            ///< Generated screen variable (nullptr while not created)
+	void (*create)(void);      ///< ui_<Name>_screen_init
+	void (*destroy)(void);     ///< ui_<Name>_screen_destroy
+	bool destroyOnLeave;       ///< Delete the screen after it has been unloaded
+};
+
+/// Indexed by UIController::Screen
+static const ScreenDef SCREEN_DEFS[] = {
+	{"Splash", &ui_Splash, ui_Splash_screen_init, ui_Splash_screen_destroy, true},
+	{"Main", &ui_Main, ui_Main_screen_init, ui_Main_screen_destroy, false},
+	{"Pair", &ui_Pair, ui_Pair_screen_init, ui_Pair_screen_destroy, true},
+};
+static_assert(sizeof(SCREEN_DEFS) / sizeof(SCREEN_DEFS[0]) == static_cast<size_t>(UIController::Screen::Count),
+			  "SCREEN_DEFS does not match UIController::Screen");
+
+/**
+ * @brief Get the LVGL heap usage
+ * @param mon Filled with the current lv_mem_monitor() result
+ * @return Bytes in use in the LVGL heap
+ */
+static uint32_t lvglHeapUsed(lv_mem_monitor_t &mon) {
+	lv_mem_monitor(&mon);
+	return mon.total_size - mon.free_size;
+}
+
 /**
  * @brief Get singleton instance
  * @return Reference to UIController singleton (static local variable)
@@ -46,8 +110,8 @@ void UIController::startLVGLTickTimer() {
 
 /**
  * @brief Start LVGL handler task
- * @details Creates FreeRTOS task running lv_timer_handler() at ~50 FPS.
- *          Task priority: tskIDLE_PRIORITY + 5
+ * @details Creates FreeRTOS task running lv_timer_handler() when the next
+ *          LVGL timer is due. Task priority: tskIDLE_PRIORITY + 5
  */
 void UIController::startLVGLTask() {
 	// Create LVGL timer handler task (handles GUI updates)
@@ -65,15 +129,90 @@ void UIController::lvglTickCallback(void *arg) {
 	lv_tick_inc(1);
 }
 
+/**
+ * @brief Wake the LVGL task early
+ * @param data Handle of the LVGL task
+ * @details A new or resumed timer may be due before the task would wake up,
+ *          so the sleep is cut short. Extra notifications are harmless.
+ */
+void UIController::lvglTimerResumeCallback(void *data) {
+	TaskHandle_t task = static_cast<TaskHandle_t>(data);
+	if (task != nullptr && task != xTaskGetCurrentTaskHandle()) {
+		xTaskNotifyGive(task);
+	}
+}
+
+/**
+ * @brief Record the first main/pair screen in the boot timeline
+ * @details Reported once, not on later pairing or WiFi mode changes
+ */
+static void markMainScreen() {
+	BootTimeline &boot = BootTimeline::instance();
+	if (!boot.isReached(BootTimeline::Phase::MainScreen)) {
+		boot.mark(BootTimeline::Phase::MainScreen);
+		boot.report();
+	}
+}
+
+/**
+ * @brief Execute a command of the UICommandQueue
+ * @param cmd Command posted by an other task
+ */
+void UIController::runCommand(const UICommand &cmd) {
+	UIController &ui = instance();
+	switch (cmd.type) {
+	case UICommand::Type::ShowMainScreen:
+		ui.showMainScreen();
+		markMainScreen();
+		break;
+	case UICommand::Type::ShowPairScreen:
+		ui.showPairScreen();
+		markMainScreen();
+		break;
+	case UICommand::Type::ShowWiFiScreen:
+		ui.showWiFiScreen();
+		break;
+	case UICommand::Type::UpdateLabels:
+		ui.updateFromState(cmd.postedUs);
+		break;
+	case UICommand::Type::SetPairingView:
+		ui.setPairingView(cmd.pairing);
+		break;
+	case UICommand::Type::SetPairingTimeout:
+		ui.setPairingTimeout(cmd.pairing.timeout);
+		break;
+	default:
+		break;
+	}
+}
+
 /**
  * @brief LVGL handler task loop
- * @details Runs lv_timer_handler() every 20ms (~50 FPS) and triggers
- *          sensor data cleanup to remove old/stale sensor entries
+ * @details Executes the UI commands posted by other tasks, then runs
+ *          lv_timer_handler() and sleeps until the next LVGL timer is due or
+ *          a command is posted, but at most 20ms so the sensor data cleanup
+ *          still removes old/stale sensor entries in time.
+ *          lv_timer_handler() returns the exact time until the next timer,
+ *          so an idle UI does not wake up every frame.
  */
 void UIController::lvglTimerTask() {
+	lv_timer_handler_set_resume_cb(lvglTimerResumeCallback, xTaskGetCurrentTaskHandle());
+	UICommandQueue &commands = UICommandQueue::instance();
+	commands.setConsumer(xTaskGetCurrentTaskHandle());
 	for (;;) {
-		lv_timer_handler();
-		vTaskDelay(pdMS_TO_TICKS(20)); // ~50 FPS
+		lv_lock();
+		commands.drain(runCommand);
+		lv_unlock();
+
+		uint32_t sleepMs = lv_timer_handler();
+		if (sleepMs > LVGL_TASK_MAX_SLEEP_MS) {
+			sleepMs = LVGL_TASK_MAX_SLEEP_MS;
+		}
+		TickType_t sleepTicks = pdMS_TO_TICKS(sleepMs);
+		if (sleepTicks == 0) {
+			sleepTicks = 1; // Let lower priority tasks run
+		}
+		ulTaskNotifyTake(pdTRUE, sleepTicks);
 		State &state = State::getInstance();
 		state.cleanupOldSensors();
 	}
@@ -106,28 +245,312 @@ void UIController::setWiFiModeLabel() {
 	lv_label_set_text(ui_Label2, "WIFI MODE");
 }
 
+/**
+ * @brief Set the widgets of the pairing screen
+ * @param view Texts, color and visibility of the pairing widgets
+ */
+void UIController::setPairingView(const UICommand::PairingView &view) {
+	createScreen(Screen::Pair);
+
+	lv_label_set_text(ui_Label10, view.wheel);
+	lv_label_set_text(ui_Label11, view.status);
+	lv_obj_set_style_text_color(ui_Label11, lv_color_hex(view.statusColor), LV_PART_MAIN);
+	if (view.spinner) {
+		lv_obj_remove_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);
+	} else {
+		lv_obj_add_flag(ui_Spinner4, LV_OBJ_FLAG_HIDDEN);
+	}
+	if (view.buttonIcon) {
+		lv_obj_remove_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);
+	} else {
+		lv_obj_add_flag(ui_Label13, LV_OBJ_FLAG_HIDDEN);
+	}
+	lv_label_set_text(ui_Label12, view.timeout);
+}
+
+/**
+ * @brief Set the pairing countdown label
+ * @param text Countdown text (e.g. "42s")
+ */
+void UIController::setPairingTimeout(const char *text) {
+	// ui_Pair is created by the first setPairingView()
+	if (ui_Pair == nullptr) {
+		return;
+	}
+	lv_label_set_text(ui_Label12, text);
+}
+
+/**
+ * @brief Update the main screen from the sensor data in State
+ * @param postedUs Time the UpdateLabels command was posted
+ * @details Looks up the front/rear sensor data by address, updates the
+ *          alert blink state and refreshes all sensor displays. A reading
+ *          that invalidated part of the screen is completed by the next frame.
+ */
+void UIController::updateFromState(int64_t postedUs) {
+	LV_PROFILER_BEGIN_TAG("ui_diff");
+	State &state = State::getInstance();
+
+	// The BLE task deletes replaced readings: hold the map until they are applied
+	state.lock();
+
+	// Look up sensor data by address
+	TPMSUtil *frontSensor = nullptr;
+	TPMSUtil *rearSensor = nullptr;
+
+	auto frontIt = state.getData().find(state.getFrontAddress());
+	if (frontIt != state.getData().end()) {
+		frontSensor = frontIt->second;
+	}
+
+	auto rearIt = state.getData().find(state.getRearAddress());
+	if (rearIt != state.getData().end()) {
+		rearSensor = rearIt->second;
+	}
+
+	// Update alert blink state for warning indicators
+	uint32_t currentTime = esp_timer_get_time() / 1000;
+	updateAlertBlinkState(currentTime);
+
+	// Update UI with current sensor readings
+	updateSensorUI(frontSensor, rearSensor, state.getFrontIdealPSI(),
+				   state.getRearIdealPSI(), currentTime);
+
+	if (isActive(Screen::Main)) {
+		const bool repaint = lv_display_get_default()->inv_p > 0;
+		LatencyTracker &latency = LatencyTracker::instance();
+		latency.onApplied(LatencyTracker::Wheel::Front, frontSensor, postedUs, repaint);
+		latency.onApplied(LatencyTracker::Wheel::Rear, rearSensor, postedUs, repaint);
+	}
+	state.unlock();
+	LV_PROFILER_END_TAG("ui_diff");
+}
+
 /**
  * @brief Show splash screen
- * @details Transitions to splash screen with 1s fade animation
  */
 void UIController::showSplashScreen() {
-	lv_screen_load_anim(ui_Splash, LV_SCR_LOAD_ANIM_FADE_ON, 1000, 0, false);
+	loadScreen(Screen::Splash);
 }
 
 /**
  * @brief Show main sensor screen
- * @details Transitions to main screen with 1s fade animation
  */
 void UIController::showMainScreen() {
-	lv_screen_load_anim(ui_Main, LV_SCR_LOAD_ANIM_FADE_ON, 1000, 0, false);
+	loadScreen(Screen::Main);
 }
 
 /**
  * @brief Show pairing screen
- * @details Transitions to pairing screen with 1s fade animation
  */
 void UIController::showPairScreen() {
-	lv_screen_load_anim(ui_Pair, LV_SCR_LOAD_ANIM_FADE_ON, 1000, 0, false);
+	loadScreen(Screen::Pair);
+}
+
+/**
+ * @brief Show splash screen with the WiFi mode label
+ * @details The splash screen is deleted when it is left, so it is created
+ *          first to set the label before the transition
+ */
+void UIController::showWiFiScreen() {
+	createScreen(Screen::Splash);
+	setWiFiModeLabel();
+	loadScreen(Screen::Splash);
+}
+
+/**
+ * @brief Create a screen if it does not exist yet
+ * @param screen Screen to create
+ * @return The LVGL screen object
+ * @details The widget tree size is the LVGL heap usage before/after the
+ *          generated init function (including the label/static layer setup
+ *          of ui_Main). The screen gets a SCREEN_UNLOADED handler for the
+ *          heap report and, for one-shot screens, the deletion.
+ */
+lv_obj_t *UIController::createScreen(Screen screen) {
+	const ScreenDef &def = SCREEN_DEFS[static_cast<size_t>(screen)];
+	ScreenStats &stats = m_screenStats[static_cast<size_t>(screen)];
+
+	lv_lock();
+	if (*def.obj != nullptr) {
+		lv_unlock();
+		return *def.obj;
+	}
+
+	lv_mem_monitor_t mon;
+	const uint32_t usedBefore = lvglHeapUsed(mon);
+	def.create();
+	if (screen == Screen::Main) {
+		initializeLabels();
+		initStaticLayer();
+	}
+	const uint32_t usedAfter = lvglHeapUsed(mon);
+	stats.widgetBytes = usedAfter > usedBefore ? usedAfter - usedBefore : 0;
+	stats.createCount++;
+
+	lv_obj_add_event_cb(*def.obj, screenUnloadedCallback, LV_EVENT_SCREEN_UNLOADED, &stats);
+	if (m_heapSampleTimer == nullptr) {
+		m_heapSampleTimer = lv_timer_create(heapSampleTimerCallback, HEAP_SAMPLE_PERIOD_MS, this);
+	}
+	sampleHeap(screen);
+	lv_obj_t *obj = *def.obj;
+	lv_unlock();
+
+	ESP_LOGI(TAG, "Created %s screen: %lu bytes, LVGL heap %lu/%lu bytes used",
+			 def.name, stats.widgetBytes, usedAfter, mon.total_size);
+	return obj;
+}
+
+/**
+ * @brief Check whether a screen exists and is the active screen
+ * @param screen Screen to check
+ * @return true if the screen is currently loaded
+ */
+bool UIController::isActive(Screen screen) const {
+	lv_obj_t *obj = *SCREEN_DEFS[static_cast<size_t>(screen)].obj;
+	return obj != nullptr && obj == lv_screen_active();
+}
+
+/**
+ * @brief Record the LVGL heap usage attributed to a screen
+ * @param screen Screen the usage is attributed to
+ */
+void UIController::sampleHeap(Screen screen) {
+	lv_mem_monitor_t mon;
+	const uint32_t used = lvglHeapUsed(mon);
+	ScreenStats &stats = m_screenStats[static_cast<size_t>(screen)];
+	if (used > stats.peakUsedBytes) {
+		stats.peakUsedBytes = used;
+	}
+}
+
+/**
+ * @brief Sample the heap usage of the active screen
+ * @param timer Periodic LVGL timer, user data is the UIController
+ * @details During a screen load animation both screens are allocated; the
+ *          sample goes to the screen that is active at that moment.
+ */
+void UIController::heapSampleTimerCallback(lv_timer_t *timer) {
+	UIController *self = static_cast<UIController *>(lv_timer_get_user_data(timer));
+	for (size_t i = 0; i < static_cast<size_t>(Screen::Count); i++) {
+		const Screen screen = static_cast<Screen>(i);
+		if (self->isActive(screen)) {
+			self->sampleHeap(screen);
+			return;
+		}
+	}
+}
+
+/**
+ * @brief Report a screen's heap usage and schedule its deletion
+ * @param e LVGL event (SCREEN_UNLOADED), user data is the screen's ScreenStats
+ * @details The deletion is deferred with lv_async_call: the display still
+ *          references the screen while its unload events are sent.
+ */
+void UIController::screenUnloadedCallback(lv_event_t *e) {
+	ScreenStats *stats = static_cast<ScreenStats *>(lv_event_get_user_data(e));
+	const ScreenDef &def = SCREEN_DEFS[static_cast<size_t>(stats->screen)];
+	instance().sampleHeap(stats->screen);
+
+	lv_mem_monitor_t mon;
+	lv_mem_monitor(&mon);
+	ESP_LOGI(TAG, "Screen %s left: widgets %lu bytes, peak LVGL heap %lu/%lu bytes (high-water %lu)",
+			 def.name, stats->widgetBytes, stats->peakUsedBytes, mon.total_size, mon.max_used);
+
+	if (def.destroyOnLeave) {
+		lv_async_call(destroyScreenCallback, stats);
+	}
+}
+
+/**
+ * @brief Delete a one-shot screen
+ * @param arg The screen's ScreenStats
+ */
+void UIController::destroyScreenCallback(void *arg) {
+	ScreenStats *stats = static_cast<ScreenStats *>(arg);
+	const ScreenDef &def = SCREEN_DEFS[static_cast<size_t>(stats->screen)];
+	if (*def.obj == nullptr || instance().isActive(stats->screen)) {
+		return;
+	}
+
+	lv_mem_monitor_t mon;
+	const uint32_t usedBefore = lvglHeapUsed(mon);
+	def.destroy();
+	const uint32_t usedAfter = lvglHeapUsed(mon);
+
+	ESP_LOGI(TAG, "Deleted %s screen: %lu bytes freed, LVGL heap %lu/%lu bytes used, largest free block %lu",
+			 def.name, usedBefore > usedAfter ? usedBefore - usedAfter : 0,
+			 usedAfter, mon.total_size, mon.free_biggest_size);
+}
+
+#if UI_BACKLIGHT_TRANSITIONS
+/**
+ * @brief Switch to a screen behind a backlight fade
+ * @param screen Screen to load (created while the backlight is off)
+ * @details The LEDC hardware fades the backlight out while LVGL keeps
+ *          running. A request arriving during the fade-out only replaces the
+ *          target screen. A request during the fade-in starts a new fade-out
+ *          from the current brightness.
+ */
+void UIController::loadScreen(Screen screen) {
+	m_pendingScreen = screen;
+	if (m_transitionTimer != nullptr) {
+		return;
+	}
+	if (isActive(screen)) {
+		return;
+	}
+
+	BacklightController::instance().fadeOut(TRANSITION_FADE_OUT_MS);
+	m_transitionTimer = lv_timer_create(transitionTimerCallback, TRANSITION_FADE_OUT_MS, this);
+	lv_timer_set_repeat_count(m_transitionTimer, 1);
+}
+
+/**
+ * @brief Swap screens once the backlight is off
+ * @param timer One-shot LVGL timer (deleted by LVGL after this call)
+ * @details The new screen is rendered and flushed completely right away, so
+ *          the panel already shows it when the backlight comes back. That is
+ *          one full-screen render instead of a second of alpha-blended frames.
+ */
+void UIController::transitionTimerCallback(lv_timer_t *timer) {
+	UIController *self = static_cast<UIController *>(lv_timer_get_user_data(timer));
+	self->m_transitionTimer = nullptr;
+
+	lv_screen_load(self->createScreen(self->m_pendingScreen));
+	lv_refr_now(nullptr);
+
+	BacklightController::instance().fadeIn(TRANSITION_FADE_IN_MS);
+}
+#else
+/**
+ * @brief Switch to a screen with a 1s LVGL fade animation
+ * @param screen Screen to load (created if needed)
+ */
+void UIController::loadScreen(Screen screen) {
+	if (isActive(screen)) {
+		return;
+	}
+	lv_screen_load_anim(createScreen(screen), LV_SCR_LOAD_ANIM_FADE_ON, 1000, 0, false);
+}
+#endif
+
+/**
+ * @brief Set up the cached static layer of the main screen
+ * @details The background, unit label, temperature icons and the arc tracks
+ *          are rendered once into the layer. The arc indicators, bars, value
+ *          labels and state icons stay dynamic. A unit switch changes ui_Unit
+ *          and is picked up by the layer automatically.
+ */
+void UIController::initStaticLayer() {
+#if UI_STATIC_LAYER_CACHE
+	m_mainStaticLayer.addStatic(ui_Unit);
+	m_mainStaticLayer.addStatic(ui_Image4);
+	m_mainStaticLayer.addStatic(ui_Image5);
+	m_mainStaticLayer.addStaticPart(ui_Arc1, LV_PART_MAIN);
+	m_mainStaticLayer.addStaticPart(ui_Arc2, LV_PART_MAIN);
+	m_mainStaticLayer.attach(ui_Main);
+#endif
 }
 
 /**
@@ -150,10 +573,10 @@ void UIController::initializeLabels() {
 	lv_label_set_text(ui_Label8, "--%");
 	lv_arc_set_value(ui_Arc1, 0);
 	lv_arc_set_value(ui_Arc2, 0);
-	lv_image_set_src(ui_Image1, &ui_img_tpmsblack_png);
-	lv_image_set_src(ui_Image3, &ui_img_tpmsblack_png);
-	lv_image_set_src(ui_Image6, &ui_img_btoff_png);
-	lv_image_set_src(ui_Image7, &ui_img_btoff_png);
+	setIconColor(ui_Image1, ICON_COLOR_OFF);
+	setIconColor(ui_Image3, ICON_COLOR_OFF);
+	setIconColor(ui_Image6, ICON_COLOR_OFF);
+	setIconColor(ui_Image7, ICON_COLOR_OFF);
 	lv_image_set_src(ui_Image9, &ui_img_idle_png);
 	lv_image_set_src(ui_Image10, &ui_img_idle_png);
 }
@@ -171,8 +594,11 @@ void UIController::initializeLabels() {
 void UIController::updateSensorUI(TPMSUtil *frontSensor, TPMSUtil *rearSensor,
 								  float frontIdealPSI, float rearIdealPSI,
 								  uint32_t currentTime) {
+	// ui_Main is created by the first showMainScreen()
+	if (ui_Main == nullptr) {
+		return;
+	}
 
-	
 	bool alertFront = false;
 	bool alertRear = false;
 
@@ -193,6 +619,11 @@ void UIController::updateSensorUI(TPMSUtil *frontSensor, TPMSUtil *rearSensor,
 	}
 
 	updateAlertIcons(alertFront, alertRear);
+
+	// Boot metric: first pressure on the visible main screen
+	if ((frontSensor || rearSensor) && isActive(Screen::Main)) {
+		BootTimeline::instance().mark(BootTimeline::Phase::FirstReading);
+	}
 }
 
 /**
@@ -250,18 +681,18 @@ void UIController::updateFrontSensorUI(TPMSUtil *frontSensor,
 
 	// Update pressure indicator icon
 	if (frontSensor->pressurePSI < frontIdealPSI * 0.75f) {
-		lv_image_set_src(ui_Image1, &ui_img_tpmsred_png);
+		setIconColor(ui_Image1, ICON_COLOR_TPMS_LOW);
 	} else if (frontSensor->pressurePSI < frontIdealPSI * 0.9f) {
-		lv_image_set_src(ui_Image1, &ui_img_tpmsyellow_png);
+		setIconColor(ui_Image1, ICON_COLOR_TPMS_WARN);
 	} else {
-		lv_image_set_src(ui_Image1, &ui_img_tpmsblack_png);
+		setIconColor(ui_Image1, ICON_COLOR_OFF);
 	}
 
 	// Update BLE connection status icon
 	if (frontSensor->timestamp + 200 < currentTime) {
-		lv_image_set_src(ui_Image6, &ui_img_btoff_png);
+		setIconColor(ui_Image6, ICON_COLOR_OFF);
 	} else {
-		lv_image_set_src(ui_Image6, &ui_img_bton_png);
+		setIconColor(ui_Image6, ICON_COLOR_BT_ON);
 	}
 }
 
@@ -314,18 +745,18 @@ void UIController::updateRearSensorUI(TPMSUtil *rearSensor, float rearIdealPSI,
 
 	// Update pressure indicator icon
 	if (rearSensor->pressurePSI < rearIdealPSI * 0.75f) {
-		lv_image_set_src(ui_Image3, &ui_img_tpmsred_png);
+		setIconColor(ui_Image3, ICON_COLOR_TPMS_LOW);
 	} else if (rearSensor->pressurePSI < rearIdealPSI * 0.9f) {
-		lv_image_set_src(ui_Image3, &ui_img_tpmsyellow_png);
+		setIconColor(ui_Image3, ICON_COLOR_TPMS_WARN);
 	} else {
-		lv_image_set_src(ui_Image3, &ui_img_tpmsblack_png);
+		setIconColor(ui_Image3, ICON_COLOR_OFF);
 	}
 
 	// Update BLE connection status icon
 	if (rearSensor->timestamp + 200 < currentTime) {
-		lv_image_set_src(ui_Image7, &ui_img_btoff_png);
+		setIconColor(ui_Image7, ICON_COLOR_OFF);
 	} else {
-		lv_image_set_src(ui_Image7, &ui_img_bton_png);
+		setIconColor(ui_Image7, ICON_COLOR_BT_ON);
 	}
 }
 
@@ -358,8 +789,8 @@ void UIController::clearFrontSensorUI(bool applyBlink) {
 	lv_label_set_text(ui_Label7, "--%");
 	lv_arc_set_value(ui_Arc2, 0);
 	lv_bar_set_value(ui_Bar1, -10, LV_ANIM_ON);
-	lv_image_set_src(ui_Image1, &ui_img_tpmsblack_png);
-	lv_image_set_src(ui_Image6, &ui_img_btoff_png);
+	setIconColor(ui_Image1, ICON_COLOR_OFF);
+	setIconColor(ui_Image6, ICON_COLOR_OFF);
 }
 
 /**
@@ -390,8 +821,8 @@ void UIController::clearRearSensorUI(bool applyBlink) {
 	lv_label_set_text(ui_Label8, "--%");
 	lv_arc_set_value(ui_Arc1, 0);
 	lv_bar_set_value(ui_Bar2, -10, LV_ANIM_ON);
-	lv_image_set_src(ui_Image3, &ui_img_tpmsblack_png);
-	lv_image_set_src(ui_Image7, &ui_img_btoff_png);
+	setIconColor(ui_Image3, ICON_COLOR_OFF);
+	setIconColor(ui_Image7, ICON_COLOR_OFF);
 }
 
 /**
@@ -8,23 +8,43 @@
 
 #pragma once
 
+#include "StaticLayerCache.h"
 #include "TPMSUtil.h"
+#include "UICommandQueue.h"
 #include <cstdint>
 
+#ifndef UI_BACKLIGHT_TRANSITIONS
+#define UI_BACKLIGHT_TRANSITIONS 0  ///< 1 = switch screens behind a backlight fade instead of an alpha fade
+#endif
+
 /**
  * @class UIController
  * @brief LVGL UI manager and sensor display controller
  * @details Responsibilities:
  *          - Start/manage LVGL tick timer (1ms resolution)
- *          - Run LVGL handler task (~50 FPS)
+ *          - Run LVGL handler task and execute the UICommandQueue commands
  *          - Update pressure/temperature/battery UI elements
  *          - Handle alert icon blinking (250ms period)
  *          - Handle label blinking for unsynchronized sensors (500ms period)
  *          - Manage screen transitions (splash, main, pair)
+ *          - Create screens on first use and delete the one-shot screens
+ *            (splash, pair) after they are left, reporting the LVGL heap
+ *            each screen used
  *          - Apply color coding (green/yellow/red) based on pressure thresholds
  */
 class UIController {
 public:
+	/**
+	 * @enum Screen
+	 * @brief Screens managed by the controller
+	 */
+	enum class Screen : uint8_t {
+		Splash,  ///< Logo and version, created by ui_init(), deleted after it is left
+		Main,    ///< Sensor display, created on first use, kept for the rest of the run
+		Pair,    ///< Pairing workflow, created on first use, deleted after it is left
+		Count
+	};
+
 	/**
 	 * @brief Get singleton instance
 	 * @return Reference to UIController singleton
@@ -39,7 +59,8 @@ public:
 	
 	/**
 	 * @brief Start LVGL handler task
-	 * @details Creates FreeRTOS task running lv_timer_handler() at ~50 FPS
+	 * @details Creates FreeRTOS task running lv_timer_handler() when the
+	 *          next LVGL timer is due
 	 */
 	void startLVGLTask();
 
@@ -56,20 +77,70 @@ public:
 	void setWiFiModeLabel();
 	
 	/**
-	 * @brief Show splash screen with fade animation
+	 * @brief Create a screen if it does not exist yet
+	 * @param screen Screen to create
+	 * @return The LVGL screen object
+	 * @details Takes the LVGL lock, so it may be called from any task. Use it
+	 *          before touching the widgets of a screen outside the show*()
+	 *          calls (e.g. setPairingView()). Creating ui_Main also
+	 *          initializes its labels and static layer.
+	 */
+	lv_obj_t *createScreen(Screen screen);
+
+	/**
+	 * @brief Show splash screen with a fade transition
 	 */
 	void showSplashScreen();
 	
 	/**
-	 * @brief Show main sensor screen with fade animation
+	 * @brief Show main sensor screen with a fade transition
 	 */
 	void showMainScreen();
 	
 	/**
-	 * @brief Show pairing screen with fade animation
+	 * @brief Show pairing screen with a fade transition
 	 */
 	void showPairScreen();
 
+	/**
+	 * @brief Show splash screen with the WiFi mode label
+	 * @details Entering WiFi config mode without a reboot
+	 */
+	void showWiFiScreen();
+
+	/**
+	 * @brief Set the widgets of the pairing screen
+	 * @param view Texts, color and visibility of the pairing widgets
+	 * @details Creates the pairing screen first if needed: with backlight
+	 *          transitions it is only loaded after the fade-out.
+	 */
+	void setPairingView(const UICommand::PairingView &view);
+
+	/**
+	 * @brief Set the pairing countdown label
+	 * @param text Countdown text (e.g. "42s")
+	 * @details Does nothing before the pairing screen has been created.
+	 */
+	void setPairingTimeout(const char *text);
+
+	/**
+	 * @brief Update the main screen from the sensor data in State
+	 * @param postedUs Time the UpdateLabels command was posted
+	 * @details Looks up the paired sensors, advances the blink states and
+	 *          calls updateSensorUI(). New readings are passed on to
+	 *          LatencyTracker.
+	 */
+	void updateFromState(int64_t postedUs);
+
+	/**
+	 * @brief Set up the cached static layer of the main screen
+	 * @details Registers the widgets of ui_Main that never change with live
+	 *          data (unit label, temperature icons, arc tracks) and attaches
+	 *          the layer. No-op unless built with UI_STATIC_LAYER_CACHE.
+	 *          Called once when ui_Main is created.
+	 */
+	void initStaticLayer();
+
 	/**
 	 * @brief Initialize all labels with default values
 	 * @details Sets pressure unit label and clears all sensor displays to "---"
@@ -85,6 +156,7 @@ public:
 	 * @param currentTime Current timestamp in milliseconds
 	 * @details Updates pressure/temp/battery displays and applies alert blinking.
 	 *          Missing sensors trigger label blinking (500ms period).
+	 *          Does nothing before ui_Main has been created.
 	 */
 	void updateSensorUI(TPMSUtil *frontSensor, TPMSUtil *rearSensor,
 						float frontIdealPSI, float rearIdealPSI,
@@ -124,13 +196,81 @@ private:
 	 */
 	static void lvglTimerTaskWrapper(void *pvParameter);
 	
+	/**
+	 * @brief Wake the LVGL task early
+	 * @param data Handle of the LVGL task
+	 * @details LVGL resume callback, called when a timer is created, resumed
+	 *          or reset, e.g. by lv_async_call() from the BLE task.
+	 */
+	static void lvglTimerResumeCallback(void *data);
+
+	/**
+	 * @brief Execute a command of the UICommandQueue
+	 * @param cmd Command posted by an other task
+	 * @details Called in the LVGL task with the LVGL lock held.
+	 */
+	static void runCommand(const UICommand &cmd);
+
 	/**
 	 * @brief LVGL handler task loop
-	 * @details Calls lv_timer_handler() every 20ms (~50 FPS) and
-	 *          triggers sensor data cleanup
+	 * @details Executes the queued UI commands, calls lv_timer_handler() and
+	 *          sleeps until the next LVGL timer is due or a command is posted
+	 *          (at most 20ms), then triggers sensor data cleanup
 	 */
 	void lvglTimerTask();
 
+	/**
+	 * @brief Switch to a screen with a fade transition
+	 * @param screen Screen to load (created if needed)
+	 * @details With UI_BACKLIGHT_TRANSITIONS the backlight fades out, the
+	 *          screen is created, loaded and rendered once, and the backlight
+	 *          fades back in. Otherwise LVGL alpha-blends the two screens.
+	 */
+	void loadScreen(Screen screen);
+
+	/**
+	 * @brief Check whether a screen exists and is the active screen
+	 * @param screen Screen to check
+	 * @return true if the screen is currently loaded
+	 */
+	bool isActive(Screen screen) const;
+
+	/**
+	 * @brief Record the LVGL heap usage of the screen just created or loaded
+	 * @param screen Screen the usage is attributed to
+	 * @details Called when a screen is created, loaded and left, and
+	 *          periodically while it is active.
+	 */
+	void sampleHeap(Screen screen);
+
+	/**
+	 * @brief Report a screen's heap usage and schedule its deletion
+	 * @param e LVGL event (SCREEN_UNLOADED), user data is the screen's ScreenStats
+	 */
+	static void screenUnloadedCallback(lv_event_t *e);
+
+	/**
+	 * @brief Delete a one-shot screen
+	 * @param arg The screen's ScreenStats
+	 * @details Runs as an lv_async_call after SCREEN_UNLOADED. Skipped if the
+	 *          screen has been loaded again in the meantime.
+	 */
+	static void destroyScreenCallback(void *arg);
+
+	/**
+	 * @brief Sample the heap usage of the active screen
+	 * @param timer Periodic LVGL timer, user data is the UIController
+	 */
+	static void heapSampleTimerCallback(lv_timer_t *timer);
+
+#if UI_BACKLIGHT_TRANSITIONS
+	/**
+	 * @brief Swap screens once the backlight is off
+	 * @param timer One-shot LVGL timer, user data is the UIController
+	 */
+	static void transitionTimerCallback(lv_timer_t *timer);
+#endif
+
 	/**
 	 * @brief Update front sensor display
 	 * @param frontSensor Front tire sensor data
@@ -176,9 +316,40 @@ private:
 	 */
 	void updateAlertIcons(bool alertFront, bool alertRear);
 
+	static constexpr uint32_t LVGL_TASK_MAX_SLEEP_MS = 20;  ///< Longest sleep of the LVGL task (sensor cleanup period)
+
 	bool m_alertBlinkState = false;      ///< Alert icon blink state (250ms period)
 	uint32_t m_lastBlinkTime = 0;        ///< Last alert blink toggle timestamp
 	
 	bool m_labelBlinkState = false;      ///< Label blink state (500ms period)
 	uint32_t m_lastLabelBlinkTime = 0;   ///< Last label blink toggle timestamp
+
+	/**
+	 * @struct ScreenStats
+	 * @brief LVGL heap usage of one screen
+	 */
+	struct ScreenStats {
+		Screen screen;               ///< Screen these numbers belong to
+		uint32_t widgetBytes = 0;    ///< Heap taken by creating the widget tree
+		uint32_t peakUsedBytes = 0;  ///< Highest heap usage sampled while the screen was active
+		uint16_t createCount = 0;    ///< Times the screen was created
+	};
+	ScreenStats m_screenStats[static_cast<size_t>(Screen::Count)] = {
+		{Screen::Splash}, {Screen::Main}, {Screen::Pair}
+	};
+	lv_timer_t *m_heapSampleTimer = nullptr;  ///< Periodic heap sampling (created with the first screen)
+
+	static constexpr uint32_t HEAP_SAMPLE_PERIOD_MS = 1000;  ///< Heap sampling period of the active screen
+
+#if UI_BACKLIGHT_TRANSITIONS
+	Screen m_pendingScreen = Screen::Splash; ///< Screen to load when the backlight is off
+	lv_timer_t *m_transitionTimer = nullptr; ///< Running fade-out timer (nullptr when idle)
+
+	static constexpr uint32_t TRANSITION_FADE_OUT_MS = 200;  ///< Backlight fade-out before the swap
+	static constexpr uint32_t TRANSITION_FADE_IN_MS = 300;   ///< Backlight fade-in after the swap
+#endif
+
+#if UI_STATIC_LAYER_CACHE
+	StaticLayerCache m_mainStaticLayer;  ///< Pre-rendered static widgets of ui_Main
+#endif
 };
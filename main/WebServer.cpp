@@ -2,18 +2,27 @@
  * @file WebServer.cpp
  * @brief HTTP server implementation for web configuration interface
  * @details Implements REST API for device configuration and OTA updates.
- *          Uses chunked transfer with retry logic for WiFi/BLE coexistence.
+ *          The configuration page is served gzipped from flash in one send.
  */
 
 #include "WebServer.h"
 #include "Application.h"
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include "Profiler.h"
+#include "SensorStream.h"
 #include "State.h"
+#include "Telemetry.h"
 #include "index_html.h"
 #include "esp_log.h"
 #include "esp_ota_ops.h"
 #include "esp_app_format.h"
+#include <cctype>
+#include <cmath>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <unistd.h>
 
 static const char *TAG = "WebServer";
 
@@ -22,6 +31,129 @@ bool WebServer::s_otaInProgress = false;
 int WebServer::s_otaProgress = 0;
 std::string WebServer::s_otaError = "";
 
+/// Accepted ideal pressure range of POST /api/config, PSI (exclusive, inclusive)
+static constexpr float MIN_IDEAL_PSI = 0.0f;
+static constexpr float MAX_IDEAL_PSI = 150.0f;
+
+/**
+ * @struct ConfigUpdate
+ * @brief Fields of a POST /api/config body, staged until the whole body parsed
+ */
+struct ConfigUpdate {
+	char frontAddress[ConfigManager::STRING_SIZE];  ///< front_address
+	char rearAddress[ConfigManager::STRING_SIZE];   ///< rear_address
+	char pressureUnit[4];                           ///< pressure_unit, "PSI" or "BAR"
+	float frontIdealPsi;                            ///< front_ideal_psi
+	float rearIdealPsi;                             ///< rear_ideal_psi
+	bool hasFrontAddress;                           ///< front_address present
+	bool hasRearAddress;                            ///< rear_address present
+	bool hasPressureUnit;                           ///< pressure_unit present
+	bool hasFrontIdealPsi;                          ///< front_ideal_psi present
+	bool hasRearIdealPsi;                           ///< rear_ideal_psi present
+};
+
+/**
+ * @brief JsonWriter::Sink sending the buffer as an HTTP chunk
+ * @param data Bytes to send
+ * @param len Number of bytes
+ * @param ctx HTTP request
+ * @return false if the client is gone
+ */
+static bool sendHttpChunk(const char *data, size_t len, void *ctx) {
+	return httpd_resp_send_chunk(static_cast<httpd_req_t *>(ctx), data, len) == ESP_OK;
+}
+
+/**
+ * @brief Copy a string member into a staged field
+ * @param dst Field
+ * @param size Size of dst
+ * @param type Value type
+ * @param value Value
+ * @return false if the value is no string or too long
+ */
+static bool stageString(char *dst, size_t size, JsonReader::Type type, const char *value) {
+	if (type != JsonReader::Type::String || strlen(value) >= size) {
+		return false;
+	}
+	strcpy(dst, value);
+	return true;
+}
+
+/**
+ * @brief Copy a sensor address member into a staged field
+ * @param dst Field (ConfigManager::STRING_SIZE bytes)
+ * @param type Value type
+ * @param value Value
+ * @return false unless the value is empty (unpaired) or a MAC address
+ *         "xx:xx:xx:xx:xx:xx"
+ * @details Hex digits are stored in lower case, as NimBLE reports addresses
+ */
+static bool stageAddress(char *dst, JsonReader::Type type, const char *value) {
+	if (type != JsonReader::Type::String) {
+		return false;
+	}
+	const size_t len = strlen(value);
+	if (len != 0 && len != ConfigManager::STRING_SIZE - 1) {
+		return false;
+	}
+	for (size_t i = 0; i < len; i++) {
+		const char c = value[i];
+		if (i % 3 == 2 ? c != ':' : !isxdigit(static_cast<unsigned char>(c))) {
+			return false;
+		}
+		dst[i] = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+	}
+	dst[len] = '\0';
+	return true;
+}
+
+/**
+ * @brief Convert an ideal pressure member into a staged field
+ * @param dst Field
+ * @param type Value type
+ * @param value Value
+ * @return false if the value is no number or outside
+ *         (MIN_IDEAL_PSI, MAX_IDEAL_PSI]
+ */
+static bool stagePsi(float &dst, JsonReader::Type type, const char *value) {
+	if (type != JsonReader::Type::Number) {
+		return false;
+	}
+	dst = strtof(value, nullptr);
+	return std::isfinite(dst) && dst > MIN_IDEAL_PSI && dst <= MAX_IDEAL_PSI;
+}
+
+/**
+ * @brief JsonReader::Handler staging the members of POST /api/config
+ * @param key Member name
+ * @param type Value type
+ * @param value Value
+ * @param ctx ConfigUpdate
+ * @return false for a known member with an invalid value; unknown members are ignored
+ */
+static bool stageConfigMember(const char *key, JsonReader::Type type, const char *value, void *ctx) {
+	ConfigUpdate &update = *static_cast<ConfigUpdate *>(ctx);
+	if (strcmp(key, "front_address") == 0) {
+		return update.hasFrontAddress = stageAddress(update.frontAddress, type, value);
+	}
+	if (strcmp(key, "rear_address") == 0) {
+		return update.hasRearAddress = stageAddress(update.rearAddress, type, value);
+	}
+	if (strcmp(key, "front_ideal_psi") == 0) {
+		return update.hasFrontIdealPsi = stagePsi(update.frontIdealPsi, type, value);
+	}
+	if (strcmp(key, "rear_ideal_psi") == 0) {
+		return update.hasRearIdealPsi = stagePsi(update.rearIdealPsi, type, value);
+	}
+	if (strcmp(key, "pressure_unit") == 0) {
+		if (strcmp(value, "PSI") != 0 && strcmp(value, "BAR") != 0) {
+			return false;
+		}
+		return update.hasPressureUnit = stageString(update.pressureUnit, sizeof(update.pressureUnit), type, value);
+	}
+	return true;
+}
+
 /**
  * @brief Get singleton instance
  * @return Reference to WebServer singleton (static local variable)
@@ -44,9 +176,10 @@ WebServer::~WebServer() {
  * @return true if server started successfully
  * @details Configures server with:
  *          - Stack size: 12KB (increased for large HTML)
- *          - Max URI handlers: 10 (for all API endpoints)
+ *          - Max URI handlers: 12 (for all API endpoints)
  *          - LRU purge enabled
  *          - Timeouts: 10 seconds
+ *          - Session close hook for the sensor event streams
  *          Registers all URI handlers for root, API, and OTA endpoints
  */
 bool WebServer::start() {
@@ -59,10 +192,11 @@ bool WebServer::start() {
 
 	httpd_config_t config = HTTPD_DEFAULT_CONFIG();
 	config.stack_size = 12288; // Increased stack for larger HTML
-	config.max_uri_handlers = 10; // Increased for OTA handlers
+	config.max_uri_handlers = 12; // Increased for OTA and stream handlers
 	config.lru_purge_enable = true;
 	config.recv_wait_timeout = 10;
 	config.send_wait_timeout = 10;
+	config.close_fn = closeSession;
 
 	esp_err_t ret = httpd_start(&m_server, &config);
 	if (ret != ESP_OK) {
@@ -83,6 +217,12 @@ bool WebServer::start() {
 							   .user_ctx = nullptr};
 	httpd_register_uri_handler(m_server, &api_sensors);
 
+	httpd_uri_t api_sensors_stream = {.uri = "/api/sensors/stream",
+									  .method = HTTP_GET,
+									  .handler = handleSensorStream,
+									  .user_ctx = nullptr};
+	httpd_register_uri_handler(m_server, &api_sensors_stream);
+
 	httpd_uri_t api_config_get = {.uri = "/api/config",
 								  .method = HTTP_GET,
 								  .handler = handleGetConfig,
@@ -119,6 +259,20 @@ bool WebServer::start() {
 								  .user_ctx = nullptr};
 	httpd_register_uri_handler(m_server, &api_ota_status);
 
+	httpd_uri_t api_telemetry = {.uri = "/api/telemetry",
+								 .method = HTTP_GET,
+								 .handler = handleGetTelemetry,
+								 .user_ctx = nullptr};
+	httpd_register_uri_handler(m_server, &api_telemetry);
+
+#if UI_PROFILER
+	httpd_uri_t api_trace = {.uri = "/api/trace",
+							 .method = HTTP_GET,
+							 .handler = handleGetTrace,
+							 .user_ctx = nullptr};
+	httpd_register_uri_handler(m_server, &api_trace);
+#endif
+
 	ESP_LOGI(TAG, "HTTP server started successfully");
 	return true;
 }
@@ -133,6 +287,7 @@ void WebServer::stop() {
 	}
 
 	ESP_LOGI(TAG, "Stopping HTTP server");
+	SensorStream::instance().disconnectAll();
 	httpd_stop(m_server);
 	m_server = nullptr;
 }
@@ -141,58 +296,37 @@ void WebServer::stop() {
  * @brief Handle GET / - serve HTML configuration interface
  * @param req HTTP request
  * @return ESP_OK on success
- * @details Sends index_html in small chunks (128 bytes) with 20ms delays
- *          for WiFi/BLE coexistence. Implements retry logic (3 attempts)
- *          for failed chunks. Logs progress and errors.
+ * @details Sends the build-time gzipped page (about 3 KB) in one
+ *          httpd_resp_send(); lwIP segments it and the coexistence scheduler
+ *          shares the radio with BLE. A request carrying the current ETag in
+ *          If-None-Match gets a 304 without a body. "no-cache" makes the
+ *          browser revalidate on every load, so a new firmware's page is
+ *          picked up at once. The connection stays open for the API calls.
  */
 esp_err_t WebServer::handleRoot(httpd_req_t *req) {
-	httpd_resp_set_type(req, "text/html");
-	httpd_resp_set_hdr(req, "Connection", "close");
-	
-	// Send HTML in very small chunks with longer delays
-	const char *html = index_html;
-	size_t len = strlen(html);
-	size_t chunk_size = 128; // Very small chunks
-	size_t offset = 0;
-	int retry_count = 0;
-	const int max_retries = 3;
-	
-	ESP_LOGI(TAG, "Sending HTML page, total size: %zu bytes", len);
-	
-	while (offset < len) {
-		size_t to_send = (len - offset > chunk_size) ? chunk_size : (len - offset);
-		esp_err_t ret = httpd_resp_send_chunk(req, html + offset, to_send);
-		
-		if (ret != ESP_OK) {
-			if (retry_count < max_retries) {
-				ESP_LOGW(TAG, "Send failed at offset %zu, retry %d/%d", offset, retry_count + 1, max_retries);
-				vTaskDelay(pdMS_TO_TICKS(50)); // Longer wait on error
-				retry_count++;
-				continue; // Retry same chunk
-			} else {
-				ESP_LOGE(TAG, "Failed to send chunk at offset %zu after %d retries: %s", 
-						 offset, max_retries, esp_err_to_name(ret));
-				httpd_resp_send_chunk(req, NULL, 0); // Terminate on error
-				return ret;
-			}
-		}
-		
-		// Success - move to next chunk
-		offset += to_send;
-		retry_count = 0;
-		
-		// Longer delay to allow WiFi/BLE coexistence
-		if (offset < len) {
-			vTaskDelay(pdMS_TO_TICKS(20));
-		}
+	httpd_resp_set_hdr(req, "ETag", index_html_etag);
+	httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+	// Browser has the current page: revalidated, nothing to send
+	char ifNoneMatch[64];
+	if (httpd_req_get_hdr_value_str(req, "If-None-Match", ifNoneMatch, sizeof(ifNoneMatch)) == ESP_OK &&
+		strstr(ifNoneMatch, index_html_etag) != nullptr) {
+		httpd_resp_set_status(req, "304 Not Modified");
+		return httpd_resp_send(req, nullptr, 0);
 	}
-	
-	// Send final empty chunk to finish
-	esp_err_t ret = httpd_resp_send_chunk(req, NULL, 0);
+
+	// Every browser accepts gzip; there is no uncompressed copy in flash
+	char acceptEncoding[64];
+	if (httpd_req_get_hdr_value_str(req, "Accept-Encoding", acceptEncoding, sizeof(acceptEncoding)) != ESP_OK ||
+		strstr(acceptEncoding, "gzip") == nullptr) {
+		ESP_LOGW(TAG, "Client does not announce gzip support, sending gzip anyway");
+	}
+
+	httpd_resp_set_type(req, "text/html");
+	httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+	esp_err_t ret = httpd_resp_send(req, reinterpret_cast<const char *>(index_html_gz), index_html_gz_len);
 	if (ret != ESP_OK) {
-		ESP_LOGE(TAG, "Failed to send final chunk: %s", esp_err_to_name(ret));
-	} else {
-		ESP_LOGI(TAG, "HTML page sent successfully");
+		ESP_LOGE(TAG, "Failed to send HTML page: %s", esp_err_to_name(ret));
 	}
 	return ret;
 }
@@ -201,107 +335,149 @@ esp_err_t WebServer::handleRoot(httpd_req_t *req) {
  * @brief Handle GET /api/sensors - get current sensor data
  * @param req HTTP request
  * @return ESP_OK on success
- * @details Calls getSensorsJSON() and sends JSON response
+ * @details Streams writeSensors() as chunked JSON response
  */
 esp_err_t WebServer::handleGetSensors(httpd_req_t *req) {
-	std::string json = getSensorsJSON();
-	return sendJSON(req, json.c_str());
+	return streamJSON(req, writeSensors);
+}
+
+/**
+ * @brief Handle GET /api/sensors/stream - live sensor readings (SSE)
+ * @param req HTTP request
+ * @return ESP_OK on success
+ * @details Sends all sensors as the first event, then SensorStream pushes
+ *          the changed readings on the open response
+ */
+esp_err_t WebServer::handleSensorStream(httpd_req_t *req) {
+	return SensorStream::instance().addClient(req, writeSensors);
+}
+
+/**
+ * @brief Session close hook of the server
+ * @param server Server handle
+ * @param fd Socket of the closed session
+ * @details Replaces the server's close(): a closing event stream is removed
+ *          from SensorStream before its socket number can be reused
+ */
+void WebServer::closeSession(httpd_handle_t server, int fd) {
+	(void)server;
+	SensorStream::instance().removeClient(fd);
+	close(fd);
 }
 
 /**
  * @brief Handle GET /api/config - get current configuration
  * @param req HTTP request
  * @return ESP_OK on success
- * @details Calls getConfigJSON() and sends JSON response
+ * @details Streams writeConfig() as chunked JSON response
  */
 esp_err_t WebServer::handleGetConfig(httpd_req_t *req) {
-	std::string json = getConfigJSON();
+	return streamJSON(req, writeConfig);
+}
+
+/**
+ * @brief Handle GET /api/telemetry - get task, stack and heap statistics
+ * @param req HTTP request
+ * @return ESP_OK on success
+ * @details Sends the latest Telemetry sample as JSON
+ */
+esp_err_t WebServer::handleGetTelemetry(httpd_req_t *req) {
+	std::string json = Telemetry::instance().toJSON();
 	return sendJSON(req, json.c_str());
 }
 
+#if UI_PROFILER
+/**
+ * @brief Handle GET /api/trace - download the profiler trace
+ * @param req HTTP request
+ * @return ESP_OK on success
+ * @details Streams the profiler ring as Chrome trace JSON (chunked), to be
+ *          opened in Perfetto or chrome://tracing
+ */
+esp_err_t WebServer::handleGetTrace(httpd_req_t *req) {
+	httpd_resp_set_type(req, "application/json");
+	httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"trace.json\"");
+	if (!Profiler::instance().dump(sendHttpChunk, req)) {
+		ESP_LOGW(TAG, "Trace download failed");
+		return ESP_FAIL;
+	}
+	return httpd_resp_send_chunk(req, nullptr, 0);
+}
+#endif
+
 /**
  * @brief Handle POST /api/config - update configuration
  * @param req HTTP request (JSON body)
  * @return ESP_OK on success
- * @details Parses JSON (simple string search, not robust) and updates:
- *          - front_address: Front sensor MAC address
- *          - rear_address: Rear sensor MAC address
- *          - front_ideal_psi: Target pressure for front tire
- *          - rear_ideal_psi: Target pressure for rear tire
+ * @details The body is fed to a JsonReader in small pieces as it arrives, so
+ *          it is never held as a whole. Recognized members:
+ *          - front_address: Front sensor MAC address, or "" (unpaired)
+ *          - rear_address: Rear sensor MAC address, or ""
+ *          - front_ideal_psi: Target pressure for front tire, 0 < psi <= 150
+ *          - rear_ideal_psi: Target pressure for rear tire, 0 < psi <= 150
  *          - pressure_unit: "PSI" or "BAR"
- *          Saves all changes to NVS via ConfigManager
+ *          Members are staged first; only a fully valid body is applied, in
+ *          one ConfigManager transaction (one NVS write). Unknown members
+ *          are ignored.
  */
 esp_err_t WebServer::handleSetConfig(httpd_req_t *req) {
-	char content[512];
-	int ret = httpd_req_recv(req, content, sizeof(content) - 1);
-	if (ret <= 0) {
-		httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid request");
+	if (req->content_len > MAX_CONFIG_BODY) {
+		ESP_LOGW(TAG, "Config body too large: %u bytes", req->content_len);
+		httpd_resp_set_status(req, "413 Content Too Large");
+		httpd_resp_send(req, "Configuration too large", HTTPD_RESP_USE_STRLEN);
 		return ESP_FAIL;
 	}
-	content[ret] = '\0';
-
-	ESP_LOGI(TAG, "Received config: %s", content);
-
-	// Parse JSON manually (simple parsing)
-	Application &app = Application::instance();
-	ConfigManager &config = app.getConfig();
 
-	// Extract values (simple string search, not robust JSON parsing)
-	char *ptr;
-
-	// Front address
-	ptr = strstr(content, "\"front_address\":\"");
-	if (ptr) {
-		ptr += 17;
-		char *end = strchr(ptr, '"');
-		if (end) {
-			std::string addr(ptr, end - ptr);
-			config.setString("front_address", addr);
-			ESP_LOGI(TAG, "Set front_address: %s", addr.c_str());
+	ConfigUpdate update = {};
+	JsonReader reader(stageConfigMember, &update);
+	char chunk[128];
+	size_t remaining = req->content_len;
+	bool parsed = true;
+	while (remaining > 0 && parsed) {
+		const int ret = httpd_req_recv(req, chunk, remaining < sizeof(chunk) ? remaining : sizeof(chunk));
+		if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+			continue;
 		}
-	}
-
-	// Rear address
-	ptr = strstr(content, "\"rear_address\":\"");
-	if (ptr) {
-		ptr += 16;
-		char *end = strchr(ptr, '"');
-		if (end) {
-			std::string addr(ptr, end - ptr);
-			config.setString("rear_address", addr);
-			ESP_LOGI(TAG, "Set rear_address: %s", addr.c_str());
+		if (ret <= 0) {
+			ESP_LOGE(TAG, "Config receive failed: %d", ret);
+			return ESP_FAIL;
 		}
+		remaining -= ret;
+		parsed = reader.feed(chunk, ret);
 	}
-
-	// Front PSI
-	ptr = strstr(content, "\"front_ideal_psi\":");
-	if (ptr) {
-		float psi = atof(ptr + 18);
-		config.setFloat("front_ideal_psi", psi);
-		ESP_LOGI(TAG, "Set front_ideal_psi: %.1f", psi);
+	if (!parsed || !reader.finish()) {
+		ESP_LOGW(TAG, "Invalid config: %s", reader.error());
+		char message[64];
+		snprintf(message, sizeof(message), "Invalid configuration: %s", reader.error());
+		httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, message);
+		return ESP_FAIL;
 	}
 
-	// Rear PSI
-	ptr = strstr(content, "\"rear_ideal_psi\":");
-	if (ptr) {
-		float psi = atof(ptr + 17);
-		config.setFloat("rear_ideal_psi", psi);
-		ESP_LOGI(TAG, "Set rear_ideal_psi: %.1f", psi);
+	ConfigManager &config = Application::instance().getConfig();
+	config.begin();
+	if (update.hasFrontAddress) {
+		config.setString(ConfigString::FrontAddress, update.frontAddress);
+		ESP_LOGI(TAG, "Set front_address: %s", update.frontAddress);
 	}
-	
-	// Pressure unit
-	ptr = strstr(content, "\"pressure_unit\":\"");
-	if (ptr) {
-		ptr += 17;
-		char *end = strchr(ptr, '"');
-		if (end) {
-			std::string unit(ptr, end - ptr);
-			if (unit == "PSI" || unit == "BAR") {
-				config.setString("pressure_unit", unit);
-				State::getInstance().setPressureUnit(unit);
-				ESP_LOGI(TAG, "Set pressure_unit: %s", unit.c_str());
-			}
-		}
+	if (update.hasRearAddress) {
+		config.setString(ConfigString::RearAddress, update.rearAddress);
+		ESP_LOGI(TAG, "Set rear_address: %s", update.rearAddress);
+	}
+	if (update.hasFrontIdealPsi) {
+		config.setFloat(ConfigFloat::FrontIdealPsi, update.frontIdealPsi);
+		ESP_LOGI(TAG, "Set front_ideal_psi: %.1f", update.frontIdealPsi);
+	}
+	if (update.hasRearIdealPsi) {
+		config.setFloat(ConfigFloat::RearIdealPsi, update.rearIdealPsi);
+		ESP_LOGI(TAG, "Set rear_ideal_psi: %.1f", update.rearIdealPsi);
+	}
+	if (update.hasPressureUnit) {
+		config.setString(ConfigString::PressureUnit, update.pressureUnit);
+		ESP_LOGI(TAG, "Set pressure_unit: %s", update.pressureUnit);
+	}
+	if (!config.commit()) {
+		httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save configuration");
+		return ESP_FAIL;
 	}
 
 	const char *response = "{\"status\":\"ok\"}";
@@ -333,13 +509,16 @@ esp_err_t WebServer::handleClearConfig(httpd_req_t *req) {
 	Application &app = Application::instance();
 	ConfigManager &config = app.getConfig();
 
-	// Clear sensor addresses
-	config.setString("front_address", "");
-	config.setString("rear_address", "");
-
-	// Reset to default PSI values
-	config.setFloat("front_ideal_psi", 36.0f);
-	config.setFloat("rear_ideal_psi", 42.0f);
+	// Clear sensor addresses and reset to default PSI values, one NVS write
+	config.begin();
+	config.setString(ConfigString::FrontAddress, "");
+	config.setString(ConfigString::RearAddress, "");
+	config.setFloat(ConfigFloat::FrontIdealPsi, 36.0f);
+	config.setFloat(ConfigFloat::RearIdealPsi, 42.0f);
+	if (!config.commit()) {
+		httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save configuration");
+		return ESP_FAIL;
+	}
 
 	ESP_LOGI(TAG, "Configuration cleared - addresses reset, PSI set to defaults");
 
@@ -348,77 +527,104 @@ esp_err_t WebServer::handleClearConfig(httpd_req_t *req) {
 }
 
 /**
- * @brief Handle POST /api/restart - reboot device
+ * @brief Handle POST /api/restart - leave WiFi configuration mode
  * @param req HTTP request
  * @return ESP_OK on success
- * @details Clears wifi_config_mode flag (returns to normal mode),
- *          sends response, waits 1 second, then calls esp_restart()
+ * @details Sends the response first, then clears wifi_config_mode flag. The
+ *          control task stops the AP and this server (no reboot), so the
+ *          response must be on its way before.
  */
 esp_err_t WebServer::handleRestart(httpd_req_t *req) {
-	Application &app = Application::instance();
-	ConfigManager &config = app.getConfig();
-	
-	// Clear WiFi config mode flag to return to normal operation
-	config.setInt("wifi_config_mode", 0);
-	ESP_LOGI(TAG, "Cleared WiFi config mode flag - will restart in normal mode");
-	
 	const char *response = "{\"status\":\"restarting\"}";
 	sendJSON(req, response);
 
-	// Restart after 1 second
-	vTaskDelay(pdMS_TO_TICKS(1000));
-	esp_restart();
+	// Clear WiFi config mode flag to return to normal operation
+	Application::instance().getConfig().setInt(ConfigInt::WiFiConfigMode, 0);
+	ESP_LOGI(TAG, "Cleared WiFi config mode flag - returning to normal mode");
 
 	return ESP_OK;
 }
 
 /**
- * @brief Build JSON string with all detected sensors
- * @return JSON string
- * @details Iterates State sensor map and formats as JSON array with:
- *          address, pressure_psi, pressure_bar, temperature_c, battery_level
+ * @brief Write all detected sensors
+ * @param json Output
+ * @details Iterates State sensor map and writes a sensors array with:
+ *          address, pressure, temperature, battery. At most
+ *          MAX_SENSORS_LISTED sensors are written.
  */
-std::string WebServer::getSensorsJSON() {
+void WebServer::writeSensors(JsonWriter &json) {
 	State &state = State::getInstance();
 
-	std::string json = "{\"sensors\":[";
-
-	bool first = true;
+	// Copied under the lock into a stack array: writing can block in a chunk
+	// send for the socket timeout, while the BLE task replaces and deletes
+	// readings. Nothing is allocated while other tasks wait for the lock.
+	SensorStream::Reading readings[MAX_SENSORS_LISTED];
+	size_t count = 0;
+	state.lock();
 	for (const auto &pair : state.getData()) {
-		if (!first)
-			json += ",";
-		first = false;
-
-		TPMSUtil *sensor = pair.second;
-		char buf[256];
-		snprintf(buf, sizeof(buf),
-				 "{\"address\":\"%s\",\"pressure\":%.1f,\"temperature\":%.1f,\"battery\":%d}",
-				 pair.first.c_str(), sensor->pressurePSI,
-				 sensor->temperatureC, sensor->batteryLevel);
-		json += buf;
+		if (count == MAX_SENSORS_LISTED) {
+			break;
+		}
+		const TPMSUtil *sensor = pair.second;
+		SensorStream::Reading &reading = readings[count++];
+		strlcpy(reading.address, pair.first.c_str(), sizeof(reading.address));
+		reading.pressurePsi = sensor->pressurePSI;
+		reading.temperatureC = sensor->temperatureC;
+		reading.battery = sensor->batteryLevel;
 	}
-
-	json += "]}";
-	return json;
+	state.unlock();
+
+	json.beginObject().key("sensors").beginArray();
+	for (size_t i = 0; i < count; i++) {
+		const SensorStream::Reading &reading = readings[i];
+		json.beginObject();
+		json.key("address").value(reading.address);
+		json.key("pressure").value(reading.pressurePsi, 1);
+		json.key("temperature").value(reading.temperatureC, 1);
+		json.key("battery").value(static_cast<int>(reading.battery));
+		json.endObject();
+	}
+	json.endArray().endObject();
 }
 
 /**
- * @brief Build JSON string with current configuration
- * @return JSON string
- * @details Reads State singleton and formats as JSON with:
- *          front_address, rear_address, front_ideal_psi, rear_ideal_psi
+ * @brief Write the current configuration
+ * @param json Output
+ * @details Reads State singleton and writes front_address, rear_address,
+ *          front_ideal_psi, rear_ideal_psi, pressure_unit
  */
-std::string WebServer::getConfigJSON() {
+void WebServer::writeConfig(JsonWriter &json) {
 	State &state = State::getInstance();
 
-	char json[512];
-	snprintf(json, sizeof(json),
-			 "{\"front_address\":\"%s\",\"rear_address\":\"%s\","
-			 "\"front_ideal_psi\":%.1f,\"rear_ideal_psi\":%.1f}",
-			 state.getFrontAddress().c_str(), state.getRearAddress().c_str(),
-			 state.getFrontIdealPSI(), state.getRearIdealPSI());
+	json.beginObject();
+	json.key("front_address").value(state.getFrontAddress().c_str());
+	json.key("rear_address").value(state.getRearAddress().c_str());
+	json.key("front_ideal_psi").value(state.getFrontIdealPSI(), 1);
+	json.key("rear_ideal_psi").value(state.getRearIdealPSI(), 1);
+	json.key("pressure_unit").value(state.getPressureUnit().c_str());
+	json.endObject();
+}
+
+/**
+ * @brief Send a JSON document as chunked response
+ * @param req HTTP request
+ * @param write Writes the document
+ * @return ESP_OK on success
+ * @details Same headers as sendJSON(); the stack buffer is sent whenever it
+ *          is full and by finish(), followed by the terminating chunk
+ */
+esp_err_t WebServer::streamJSON(httpd_req_t *req, void (*write)(JsonWriter &json)) {
+	httpd_resp_set_type(req, "application/json");
+	httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
-	return std::string(json);
+	char buffer[STREAM_BUFFER_SIZE];
+	JsonWriter json(buffer, sizeof(buffer), sendHttpChunk, req);
+	write(json);
+	if (!json.finish()) {
+		ESP_LOGW(TAG, "JSON response failed");
+		return ESP_FAIL;
+	}
+	return httpd_resp_send_chunk(req, nullptr, 0);
 }
 
 /**
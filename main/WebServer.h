@@ -5,7 +5,7 @@
  *          - Device configuration (sensor addresses, target pressures, units)
  *          - Real-time sensor data viewing
  *          - OTA firmware updates
- *          - System restart
+ *          - Leaving WiFi configuration mode
  */
 
 #pragma once
@@ -13,18 +13,23 @@
 #include "esp_http_server.h"
 #include <string>
 
+class JsonWriter;
+
 /**
  * @class WebServer
  * @brief HTTP server for device configuration and OTA updates
  * @details Provides REST API endpoints:
  *          - GET /: Serves HTML configuration interface
  *          - GET /api/sensors: Returns current sensor data (JSON)
+ *          - GET /api/sensors/stream: Pushes changed sensor data (Server-Sent Events)
  *          - GET /api/config: Returns current configuration (JSON)
  *          - POST /api/config: Updates configuration
  *          - POST /api/clear: Clears sensor pairing
- *          - POST /api/restart: Reboots device
+ *          - POST /api/restart: Leaves WiFi configuration mode
  *          - POST /api/ota/upload: Uploads firmware binary
  *          - GET /api/ota/status: Returns OTA progress
+ *          - GET /api/telemetry: Returns task, stack and heap statistics (JSON)
+ *          - GET /api/trace: Returns the profiler trace (UI_PROFILER builds)
  */
 class WebServer {
 public:
@@ -65,8 +70,8 @@ private:
 	 * @brief Handle GET / - serve HTML configuration interface
 	 * @param req HTTP request
 	 * @return ESP_OK on success
-	 * @details Sends index_html in small chunks (128 bytes) with 20ms delays
-	 *          for WiFi/BLE coexistence. Implements retry logic for failed chunks.
+	 * @details Sends the gzipped page in one response with a strong ETag;
+	 *          answers 304 when If-None-Match carries it
 	 */
 	static esp_err_t handleRoot(httpd_req_t *req);
 	
@@ -78,6 +83,22 @@ private:
 	 */
 	static esp_err_t handleGetSensors(httpd_req_t *req);
 	
+	/**
+	 * @brief Handle GET /api/sensors/stream - live sensor readings
+	 * @param req HTTP request
+	 * @return ESP_OK on success
+	 * @details Server-Sent Events: a snapshot, then the changed readings
+	 *          (see SensorStream)
+	 */
+	static esp_err_t handleSensorStream(httpd_req_t *req);
+	
+	/**
+	 * @brief Session close hook, removes event stream clients
+	 * @param server Server handle
+	 * @param fd Socket of the closed session
+	 */
+	static void closeSession(httpd_handle_t server, int fd);
+	
 	/**
 	 * @brief Handle GET /api/config - get current configuration
 	 * @param req HTTP request
@@ -86,12 +107,33 @@ private:
 	 */
 	static esp_err_t handleGetConfig(httpd_req_t *req);
 	
+	/**
+	 * @brief Handle GET /api/telemetry - get task, stack and heap statistics
+	 * @param req HTTP request
+	 * @return ESP_OK on success
+	 * @details Returns the latest Telemetry sample: per-task CPU share and
+	 *          stack high-water mark, internal and DMA heap usage
+	 */
+	static esp_err_t handleGetTelemetry(httpd_req_t *req);
+
+	/**
+	 * @brief Handle GET /api/trace - download the profiler trace
+	 * @param req HTTP request
+	 * @return ESP_OK on success
+	 * @details Chrome trace event JSON of the profiler ring (see Profiler).
+	 *          Only registered in UI_PROFILER builds.
+	 */
+	static esp_err_t handleGetTrace(httpd_req_t *req);
+	
 	/**
 	 * @brief Handle POST /api/config - update configuration
 	 * @param req HTTP request (JSON body)
 	 * @return ESP_OK on success
-	 * @details Parses JSON and updates front_address, rear_address, front_ideal_psi,
-	 *          rear_ideal_psi, pressure_unit in ConfigManager
+	 * @details Parses the body with JsonReader while it is received and
+	 *          applies front_address, rear_address, front_ideal_psi,
+	 *          rear_ideal_psi, pressure_unit in one ConfigManager transaction.
+	 *          Nothing is applied if any field is invalid (400) or the body
+	 *          exceeds MAX_CONFIG_BODY (413).
 	 */
 	static esp_err_t handleSetConfig(httpd_req_t *req);
 	
@@ -112,10 +154,11 @@ private:
 	static esp_err_t handleClearConfig(httpd_req_t *req);
 	
 	/**
-	 * @brief Handle POST /api/restart - reboot device
+	 * @brief Handle POST /api/restart - leave WiFi configuration mode
 	 * @param req HTTP request
 	 * @return ESP_OK on success
-	 * @details Clears wifi_config_mode flag and reboots after 1 second delay
+	 * @details Clears wifi_config_mode flag; the control task stops the AP
+	 *          and this server and resumes BLE scanning, without a reboot
 	 */
 	static esp_err_t handleRestart(httpd_req_t *req);
 	
@@ -137,18 +180,28 @@ private:
 	static esp_err_t handleOTAStatus(httpd_req_t *req);
 
 	/**
-	 * @brief Build JSON string with all detected sensors
-	 * @return JSON string
-	 * @details Iterates State sensor map and formats as JSON array
+	 * @brief Write all detected sensors
+	 * @param json Output
+	 * @details Iterates State sensor map and writes an object with the sensors array
 	 */
-	static std::string getSensorsJSON();
+	static void writeSensors(JsonWriter &json);
 	
 	/**
-	 * @brief Build JSON string with current configuration
-	 * @return JSON string
-	 * @details Reads ConfigManager and formats front/rear addresses, PSI values, unit
+	 * @brief Write the current configuration
+	 * @param json Output
+	 * @details Front/rear addresses, ideal PSI values and pressure unit from State
 	 */
-	static std::string getConfigJSON();
+	static void writeConfig(JsonWriter &json);
+	
+	/**
+	 * @brief Send a JSON document as chunked response
+	 * @param req HTTP request
+	 * @param write Writes the document
+	 * @return ESP_OK on success
+	 * @details The document is written through a STREAM_BUFFER_SIZE stack
+	 *          buffer; every full buffer goes out as one chunk
+	 */
+	static esp_err_t streamJSON(httpd_req_t *req, void (*write)(JsonWriter &json));
 	
 	/**
 	 * @brief Send JSON response with proper headers
@@ -159,6 +212,10 @@ private:
 	 */
 	static esp_err_t sendJSON(httpd_req_t *req, const char *json);
 
+	static constexpr size_t STREAM_BUFFER_SIZE = 256;  ///< Chunk size of streamed JSON responses
+	static constexpr size_t MAX_CONFIG_BODY = 1024;    ///< Largest accepted POST /api/config body
+	static constexpr size_t MAX_SENSORS_LISTED = 32;   ///< Sensors in a sensor list, copied on the httpd stack (28 bytes each)
+
 	httpd_handle_t m_server = nullptr;  ///< HTTP server handle
 	
 	static bool s_otaInProgress;       ///< OTA upload in progress flag
@@ -39,41 +39,49 @@ WiFiManager::~WiFiManager() {
  *          1. Initialize TCP/IP stack (esp_netif_init)
  *          2. Create default event loop (if not exists)
  *          3. Create WiFi AP network interface
- *          4. Initialize WiFi driver with default config
- *          5. Register WiFi event handlers
+ *          4. Register WiFi event handlers
+ *          5. Initialize WiFi driver with default config
+ *          Steps 1-4 run on the first call only, so WiFi config mode can be
+ *          entered again after stop().
  */
 bool WiFiManager::init() {
 	ESP_LOGI(TAG, "Initializing WiFi Manager");
 
-	// Initialize TCP/IP stack
-	ESP_ERROR_CHECK(esp_netif_init());
+	// TCP/IP stack, netif and event handlers survive stop(): set up once
+	if (!m_netif) {
+		// Initialize TCP/IP stack
+		ESP_ERROR_CHECK(esp_netif_init());
+
+		// Create default event loop if not already created
+		esp_err_t ret = esp_event_loop_create_default();
+		if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+			ESP_LOGE(TAG, "Failed to create event loop: %s", esp_err_to_name(ret));
+			return false;
+		}
 
-	// Create default event loop if not already created
-	esp_err_t ret = esp_event_loop_create_default();
-	if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
-		ESP_LOGE(TAG, "Failed to create event loop: %s", esp_err_to_name(ret));
-		return false;
-	}
+		// Create WiFi AP netif
+		m_netif = esp_netif_create_default_wifi_ap();
+		if (!m_netif) {
+			ESP_LOGE(TAG, "Failed to create WiFi AP netif");
+			return false;
+		}
 
-	// Create WiFi AP netif
-	m_netif = esp_netif_create_default_wifi_ap();
-	if (!m_netif) {
-		ESP_LOGE(TAG, "Failed to create WiFi AP netif");
-		return false;
+		// Register event handlers
+		ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, ESP_EVENT_ANY_ID,
+												   &wifiEventHandler, this));
 	}
 
-	// Initialize WiFi with default config
-	wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-	ret = esp_wifi_init(&cfg);
-	if (ret != ESP_OK) {
-		ESP_LOGE(TAG, "Failed to initialize WiFi: %s", esp_err_to_name(ret));
-		return false;
+	// Initialize WiFi with default config (deinitialized by stop())
+	if (!m_isInitialized) {
+		wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+		esp_err_t ret = esp_wifi_init(&cfg);
+		if (ret != ESP_OK) {
+			ESP_LOGE(TAG, "Failed to initialize WiFi: %s", esp_err_to_name(ret));
+			return false;
+		}
+		m_isInitialized = true;
 	}
 
-	// Register event handlers
-	ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, ESP_EVENT_ANY_ID,
-											   &wifiEventHandler, this));
-
 	ESP_LOGI(TAG, "WiFi Manager initialized successfully");
 	return true;
 }
@@ -129,19 +137,22 @@ bool WiFiManager::start() {
 /**
  * @brief Stop WiFi Access Point
  * @details Stops WiFi driver and deinitializes WiFi.
- *          Safe to call even if AP is not running.
+ *          Safe to call even if AP is not running. Also deinitializes a
+ *          driver whose start() failed, so the next init() starts over.
  */
 void WiFiManager::stop() {
-	if (!m_isRunning) {
+	if (!m_isInitialized) {
 		return;
 	}
 
-	ESP_LOGI(TAG, "Stopping WiFi AP");
+	if (m_isRunning) {
+		ESP_LOGI(TAG, "Stopping WiFi AP");
+		esp_wifi_stop();
+		m_isRunning = false;
+	}
 
-	esp_wifi_stop();
 	esp_wifi_deinit();
-
-	m_isRunning = false;
+	m_isInitialized = false;
 }
 
 /**
@@ -39,7 +39,8 @@ public:
 	 * @brief Initialize WiFi subsystem
 	 * @return true if initialization succeeded
 	 * @details Initializes TCP/IP stack, creates event loop, creates WiFi AP netif,
-	 *          and registers event handlers. Must be called before start().
+	 *          and registers event handlers (first call only), then initializes
+	 *          the WiFi driver. Must be called before start(), again after stop().
 	 */
 	bool init();
 
@@ -53,7 +54,8 @@ public:
 
 	/**
 	 * @brief Stop WiFi Access Point
-	 * @details Stops WiFi and deinitializes WiFi driver. Safe to call even if not running.
+	 * @details Stops WiFi and deinitializes WiFi driver. Safe to call even if not running;
+	 *          after a failed start() it only deinitializes the driver.
 	 */
 	void stop();
 
@@ -89,6 +91,7 @@ private:
 
 	esp_netif_t *m_netif = nullptr;  ///< WiFi AP network interface
 	bool m_isRunning = false;        ///< AP running state
+	bool m_isInitialized = false;    ///< esp_wifi_init() done, not yet deinitialized
 
 	static constexpr const char *WIFI_SSID = "TPMS-Config";  ///< AP SSID
 	static constexpr const char *WIFI_PASS = "tpms1234";     ///< AP password
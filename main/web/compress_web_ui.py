@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+Minify and gzip the web configuration page for the firmware image.
+
+The page (main/web/index.html) used to be embedded as a raw string and was
+sent in 128-byte chunks. The build now stores it gzip-compressed, and
+WebServer::handleRoot() sends the stored bytes as they are with
+Content-Encoding: gzip. The ETag is a hash of the compressed page, so it
+changes with every edit of the page and browsers revalidate with a 304.
+
+Minification is deliberately conservative, so the page keeps working without
+a JavaScript parser: leading/trailing whitespace and empty lines are removed,
+as well as comment-only lines (// in scripts, /* */ in styles and <!-- -->).
+Line breaks are kept, so automatic semicolon insertion is unchanged.
+
+Only the Python standard library is used, so this runs inside the ESP-IDF
+build (main/CMakeLists.txt calls it for main/web/index.html).
+
+Usage:
+    # Build step: generate the C source with the compressed page
+    python3 main/web/compress_web_ui.py main/web/index.html out.c
+
+    # Size report
+    python3 main/web/compress_web_ui.py --report
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+WEB_DIR = os.path.dirname(os.path.abspath(__file__))
+PAGE = os.path.join(WEB_DIR, "index.html")
+
+COMMENT_LINE = re.compile(r"^(//.*|/\*.*\*/|<!--.*-->)$")
+
+
+def minify(html):
+    lines = []
+    for line in html.splitlines():
+        line = line.strip()
+        if line and not COMMENT_LINE.match(line):
+            lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def compress(data):
+    # mtime=0: the same page gives the same bytes (and ETag) on every build
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        raw = f.read().encode("utf-8")
+    minified = minify(raw.decode("utf-8")).encode("utf-8")
+    return raw, minified, compress(minified)
+
+
+def write_source(src_path, out_path):
+    raw, minified, blob = load(src_path)
+    etag = hashlib.sha256(blob).hexdigest()[:16]
+
+    rows = []
+    for i in range(0, len(blob), 32):
+        rows.append("    " + "".join(f"0x{v:02X}," for v in blob[i:i + 32]))
+
+    src = (
+        "// This file was generated by main/web/compress_web_ui.py\n"
+        f"// Source: {os.path.basename(src_path)} ({len(raw)} bytes raw, "
+        f"{len(minified)} minified, gzip)\n"
+        "\n"
+        "#include <stddef.h>\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "const uint8_t index_html_gz[] = {\n"
+        + "\n".join(rows) + "\n"
+        "};\n"
+        "const size_t index_html_gz_len = sizeof(index_html_gz);\n"
+        f"const char index_html_etag[] = \"\\\"{etag}\\\"\";\n"
+        "\n"
+    )
+    os.makedirs(os.path.dirname(os.path.abspath(out_path)), exist_ok=True)
+    with open(out_path, "w", newline="\n") as f:
+        f.write(src)
+    print(f"index.html: {len(raw)} -> {len(minified)} minified -> {len(blob)} bytes gzip "
+          f"({100 * len(blob) / len(raw):.0f}%), ETag \"{etag}\"")
+
+
+def report():
+    raw, minified, blob = load(PAGE)
+    print(f"{'page':<12} {'raw':>8} {'minified':>9} {'gzip':>8} {'ratio':>6}")
+    print(f"{'index.html':<12} {len(raw):>8} {len(minified):>9} {len(blob):>8} "
+          f"{100 * len(blob) / len(raw):>5.0f}%")
+    return 0
+
+
+def main(argv):
+    if len(argv) == 2 and argv[1] == "--report":
+        return report()
+    if len(argv) != 3:
+        print(__doc__)
+        return 1
+    write_source(argv[1], argv[2])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+"""
+Compress SquareLine image arrays with LVGL's RLE image format.
+
+SquareLine exports every image as a raw pixel array, which is stored in flash
+as-is and read directly on every draw. Most of our images are a logo or icon
+on a transparent background, so they compress very well with LVGL's RLE
+scheme. LVGL's bin decoder decompresses an image once, and the decoded copy is
+then kept in the image cache (see ImageCache).
+
+Only the Python standard library is used, so this runs inside the ESP-IDF
+build (main/CMakeLists.txt calls it for every image in COMPRESSED_IMAGES).
+
+Usage:
+    # Build step: compress one SquareLine image source into a new C file
+    python3 squareline/compress_images.py main/UI/images/ui_img_temp_png.c out.c
+
+    # Flash footprint report for all images in main/UI/images
+    python3 squareline/compress_images.py --report
+
+The RLE stream matches lv_rle_decompress(): a control byte with bit 7 set is
+followed by (ctrl & 0x7F) literal blocks, otherwise the next block repeats
+ctrl times. The block size is the pixel size in bytes (2 for RGB565A8, where
+the alpha plane is compressed in pairs of bytes as well). Every stream is
+decoded again with a port of lv_rle_decompress() and compared to the input.
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+IMAGE_DIR = os.path.join(ROOT, "main", "UI", "images")
+
+LV_IMAGE_COMPRESS_RLE = 1
+COMPRESS_HEADER_SIZE = 12   # method, compressed_size, decompressed_size (lv_image_compressed_t)
+MIN_REPEAT = 3              # shorter runs are cheaper as literals
+MAX_COUNT = 0x7F
+
+# Bytes per RLE block for the color formats SquareLine exports
+BLOCK_SIZE = {
+    "LV_COLOR_FORMAT_NATIVE_WITH_ALPHA": 2,  # RGB565A8 with LV_COLOR_DEPTH 16
+    "LV_COLOR_FORMAT_RGB565A8": 2,
+    "LV_COLOR_FORMAT_RGB565": 2,
+    "LV_COLOR_FORMAT_NATIVE": 2,
+    "LV_COLOR_FORMAT_A8": 1,
+    "LV_COLOR_FORMAT_ARGB8888": 4,
+}
+
+# Bytes per pixel of the first plane (row stride = width * this)
+STRIDE_BYTES = {
+    "LV_COLOR_FORMAT_NATIVE_WITH_ALPHA": 2,
+    "LV_COLOR_FORMAT_RGB565A8": 2,
+    "LV_COLOR_FORMAT_RGB565": 2,
+    "LV_COLOR_FORMAT_NATIVE": 2,
+    "LV_COLOR_FORMAT_A8": 1,
+    "LV_COLOR_FORMAT_ARGB8888": 4,
+}
+
+
+def parse_image_source(path):
+    """Read name, size, color format and pixel bytes from a SquareLine image .c file."""
+    with open(path) as f:
+        src = f.read()
+
+    m = re.search(r"uint8_t\s+(\w+)_data\[\]\s*=\s*\{(.*?)\};", src, re.S)
+    if not m:
+        raise ValueError(f"{path}: no image data array found")
+    name = m.group(1)
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", m.group(2)))
+
+    def field(key):
+        fm = re.search(r"\.header\." + key + r"\s*=\s*(\w+)", src)
+        if not fm:
+            raise ValueError(f"{path}: missing header.{key}")
+        return fm.group(1)
+
+    w, h, cf = int(field("w")), int(field("h")), field("cf")
+    if cf not in BLOCK_SIZE:
+        raise ValueError(f"{path}: unsupported color format {cf}")
+    return name, w, h, cf, data
+
+
+def rle_compress(data, blk):
+    """Compress data into the lv_rle_decompress() stream format."""
+    # A trailing partial block (odd-sized RGB565A8 images) must end up in a
+    # literal: the decoder cuts a literal at the decompressed size, but drops
+    # the whole last block of a repeat run that overflows it.
+    full = len(data) - len(data) % blk
+    blocks = [data[i:i + blk] for i in range(0, full, blk)]
+
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_COUNT]
+            del literals[:MAX_COUNT]
+            out.append(0x80 | len(chunk))
+            for b in chunk:
+                out.extend(b)
+
+    i = 0
+    while i < len(blocks):
+        run = 1
+        while i + run < len(blocks) and run < MAX_COUNT and blocks[i + run] == blocks[i]:
+            run += 1
+        if run >= MIN_REPEAT:
+            flush_literals()
+            out.append(run)
+            out.extend(blocks[i])
+        else:
+            literals.extend(blocks[i:i + run])
+        i += run
+    if full < len(data):
+        # Padded to a whole block: the decoder reads it, but copies only the real bytes
+        literals.append(data[full:] + bytes(blk - (len(data) - full)))
+    flush_literals()
+    return bytes(out)
+
+
+def rle_decompress(stream, size, blk):
+    """Decode like lv_rle_decompress(), including its handling of the last block."""
+    out = bytearray()
+    pos = 0
+    while pos < len(stream):
+        ctrl = stream[pos]
+        pos += 1
+        if ctrl & 0x80:
+            n = blk * (ctrl & 0x7F)
+            if pos + n > len(stream):
+                raise ValueError("literal past end of stream")
+            out.extend(stream[pos:pos + n])
+            pos += n
+        else:
+            if pos + blk > len(stream):
+                raise ValueError("repeat past end of stream")
+            if len(out) + blk * ctrl > size:
+                ctrl -= 1  # lv_rle_decompress() skips the overflowing block
+            out.extend(stream[pos:pos + blk] * ctrl)
+            pos += blk
+        if len(out) >= size:
+            return bytes(out[:size])
+    return bytes(out)
+
+
+def rle_checked(data, blk, what):
+    """rle_compress() with a round trip through rle_decompress()."""
+    stream = rle_compress(data, blk)
+    decoded = rle_decompress(stream, len(data), blk)
+    if decoded != data:
+        diff = next((i for i in range(min(len(decoded), len(data))) if decoded[i] != data[i]),
+                    min(len(decoded), len(data)))
+        raise ValueError(f"{what}: RLE round trip differs at byte {diff} of {len(data)}")
+    return stream
+
+
+def write_compressed(src_path, out_path):
+    name, w, h, cf, data = parse_image_source(src_path)
+    payload = rle_checked(data, BLOCK_SIZE[cf], name)
+    header = (LV_IMAGE_COMPRESS_RLE.to_bytes(4, "little")
+              + len(payload).to_bytes(4, "little")
+              + len(data).to_bytes(4, "little"))
+    blob = header + payload
+
+    rows = []
+    for i in range(0, len(blob), 32):
+        rows.append("    " + "".join(f"0x{v:02X}," for v in blob[i:i + 32]))
+
+    src = (
+        "// This file was generated by squareline/compress_images.py\n"
+        f"// Source: {os.path.basename(src_path)} ({len(data)} bytes raw, RLE)\n"
+        "\n"
+        '#include "UI/ui.h"\n'
+        "\n"
+        "#ifndef LV_ATTRIBUTE_MEM_ALIGN\n"
+        "    #define LV_ATTRIBUTE_MEM_ALIGN\n"
+        "#endif\n"
+        "\n"
+        f"const LV_ATTRIBUTE_MEM_ALIGN uint8_t {name}_data[] = {{\n"
+        + "\n".join(rows) + "\n"
+        "};\n"
+        f"const lv_image_dsc_t {name} = {{\n"
+        f"    .header.w = {w},\n"
+        f"    .header.h = {h},\n"
+        f"    .header.stride = {w * STRIDE_BYTES[cf]},\n"
+        "    .header.flags = LV_IMAGE_FLAGS_COMPRESSED,\n"
+        f"    .data_size = sizeof({name}_data),\n"
+        f"    .header.cf = {cf},\n"
+        "    .header.magic = LV_IMAGE_HEADER_MAGIC,\n"
+        f"    .data = {name}_data\n"
+        "};\n"
+        "\n"
+    )
+    os.makedirs(os.path.dirname(os.path.abspath(out_path)), exist_ok=True)
+    with open(out_path, "w", newline="\n") as f:
+        f.write(src)
+    print(f"{name}: {len(data)} -> {len(blob)} bytes ({100 * len(blob) / len(data):.0f}%)")
+
+
+def report():
+    total_raw = total_rle = 0
+    print(f"{'image':<24} {'size':>8} {'raw':>8} {'rle':>8} {'ratio':>6}")
+    for fname in sorted(os.listdir(IMAGE_DIR)):
+        if not fname.endswith(".c"):
+            continue
+        path = os.path.join(IMAGE_DIR, fname)
+        with open(path) as f:
+            if "lv_image_dsc_t" not in f.read():
+                continue  # Not an LVGL image (e.g. the boot splash of gen_boot_splash.py)
+        name, w, h, cf, data = parse_image_source(path)
+        rle = COMPRESS_HEADER_SIZE + len(rle_checked(data, BLOCK_SIZE[cf], name))
+        total_raw += len(data)
+        total_rle += rle
+        print(f"{name:<24} {f'{w}x{h}':>8} {len(data):>8} {rle:>8} {100 * rle / len(data):>5.0f}%")
+    print(f"{'total':<24} {'':>8} {total_raw:>8} {total_rle:>8} {100 * total_rle / total_raw:>5.0f}%")
+    return 0
+
+
+def main(argv):
+    if len(argv) == 2 and argv[1] == "--report":
+        return report()
+    if len(argv) != 3:
+        print(__doc__)
+        return 1
+    write_compressed(argv[1], argv[2])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""
+Generate the boot splash frame drawn before LVGL is running.
+
+DisplayManager pushes this frame to the panel with LovyanGFX right after the
+panel is initialized, so the logo is visible while NVS, BLE and LVGL start up.
+The frame is the background gradient of ui_Splash with the splash logo
+(ui_img_942102620) blended on top, computed the same way as LVGL's software
+renderer does it. When LVGL draws ui_Splash, only the version label and the
+spinner appear.
+
+Output: main/UI/images/ui_img_boot_splash.c, a 240x240 RGB565 frame in panel
+byte order, compressed with the same RLE scheme as compress_images.py (block
+size 2). DisplayManager decodes it band by band, so no full frame buffer is
+needed.
+
+Only the Python standard library is used.
+
+Usage (from the repository root):
+    python3 squareline/gen_boot_splash.py
+"""
+
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from compress_images import parse_image_source, rle_compress  # noqa: E402
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SPLASH_SRC = os.path.join(ROOT, "main", "UI", "screens", "ui_Splash.c")
+LOGO_SRC = os.path.join(ROOT, "main", "UI", "images", "ui_img_942102620.c")
+OUT_FILE = os.path.join(ROOT, "main", "UI", "images", "ui_img_boot_splash.c")
+NAME = "ui_img_boot_splash"
+
+WIDTH = 240
+HEIGHT = 240
+
+
+def style_props(src, style):
+    """Properties of a constant style written by gen_const_styles.py."""
+    m = re.search(r"\b" + style + r"_props\[\] = \{(.*?)\};", src, re.S)
+    if not m:
+        raise ValueError(f"{style} not found in {SPLASH_SRC}, run gen_const_styles.py first")
+    props = {}
+    for prop, value in re.findall(r"LV_STYLE_CONST_(\w+)\((.*)\),", m.group(1)):
+        props[prop] = value
+    return props
+
+
+def color_of(value):
+    m = re.match(r"LV_COLOR_MAKE\(0x(\w\w), 0x(\w\w), 0x(\w\w)\)", value)
+    if not m:
+        raise ValueError(f"unsupported color {value}")
+    return tuple(int(v, 16) for v in m.groups())
+
+
+def rgb565(r, g, b):
+    """lv_color_to_u16()"""
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def udiv255(x):
+    """LV_UDIV255()"""
+    return (x * 0x8081) >> 0x17
+
+
+def gradient_row(stops, y):
+    """lv_draw_sw_grad_color_calculate() for a vertical gradient over the screen height."""
+    (c0, f0), (c1, f1) = stops
+    lo = (f0 * HEIGHT) >> 8
+    hi = (f1 * HEIGHT) >> 8
+    if y <= lo:
+        return rgb565(*c0)
+    if y >= hi:
+        return rgb565(*c1)
+    mix = ((y - lo) * 255) // (hi - lo)
+    return rgb565(*(udiv255(b * mix + a * (255 - mix)) for a, b in zip(c0, c1)))
+
+
+def mix565(c1, c2, mix):
+    """lv_color_16_16_mix()"""
+    if mix == 255:
+        return c1
+    if mix == 0:
+        return c2
+    if c1 == c2:
+        return c1
+    mix = (mix + 4) >> 3
+    bg = (c2 | (c2 << 16)) & 0x7E0F81F
+    fg = (c1 | (c1 << 16)) & 0x7E0F81F
+    result = (((((fg - bg) & 0xFFFFFFFF) * mix) >> 5) + bg) & 0x7E0F81F
+    return ((result >> 16) | result) & 0xFFFF
+
+
+def compose():
+    """Return the splash frame as a list of RGB565 values (LVGL byte order)."""
+    with open(SPLASH_SRC) as f:
+        src = f.read()
+
+    bg = style_props(src, "style_Splash_main")
+    if bg.get("BG_GRAD_DIR") != "LV_GRAD_DIR_VER":
+        raise ValueError("only a vertical splash gradient is supported")
+    stops = [(color_of(bg["BG_COLOR"]), int(bg["BG_MAIN_STOP"])),
+             (color_of(bg["BG_GRAD_COLOR"]), int(bg["BG_GRAD_STOP"]))]
+
+    _, w, h, cf, data = parse_image_source(LOGO_SRC)
+    if cf not in ("LV_COLOR_FORMAT_NATIVE_WITH_ALPHA", "LV_COLOR_FORMAT_RGB565A8"):
+        raise ValueError(f"unsupported logo color format {cf}")
+    logo = style_props(src, "style_Image2_main")
+    if logo.get("ALIGN") != "LV_ALIGN_CENTER":
+        raise ValueError("the splash logo is expected to be centered")
+    x0 = (WIDTH - w) // 2 + int(logo.get("X", "0"))
+    y0 = (HEIGHT - h) // 2 + int(logo.get("Y", "0"))
+
+    frame = []
+    for y in range(HEIGHT):
+        row = [gradient_row(stops, y)] * WIDTH
+        ly = y - y0
+        if 0 <= ly < h:
+            for lx in range(w):
+                x = x0 + lx
+                if not 0 <= x < WIDTH:
+                    continue
+                i = ly * w + lx
+                color = data[2 * i] | (data[2 * i + 1] << 8)
+                alpha = data[2 * w * h + i]
+                row[x] = mix565(color, row[x], alpha)
+        frame.extend(row)
+    return frame
+
+
+def generate():
+    frame = compose()
+    # Panel byte order (big-endian), as pushed by DisplayManager::flushScreen()
+    raw = b"".join(v.to_bytes(2, "big") for v in frame)
+    payload = rle_compress(raw, 2)
+
+    rows = [", ".join(f"0x{b:02x}" for b in payload[i:i + 16]) for i in range(0, len(payload), 16)]
+    src = f"""// This file was generated by squareline/gen_boot_splash.py
+// ui_Splash background + ui_img_942102620, {WIDTH}x{HEIGHT} RGB565 in panel byte order,
+// RLE-compressed ({len(raw)} -> {len(payload)} bytes). Drawn by DisplayManager before LVGL starts.
+
+#include <stdint.h>
+
+const uint16_t {NAME}_width = {WIDTH};
+const uint16_t {NAME}_height = {HEIGHT};
+const uint32_t {NAME}_rle_size = {len(payload)};
+
+const uint8_t {NAME}_rle[] = {{
+    {(","+chr(10)+"    ").join(rows)}
+}};
+"""
+    with open(OUT_FILE, "w", newline="\n") as f:
+        f.write(src)
+    print(f"{os.path.relpath(OUT_FILE, ROOT)}: {WIDTH}x{HEIGHT}, {len(raw)} -> {len(payload)} bytes")
+
+
+def main():
+    generate()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+Convert the style setters of the SquareLine screens to constant styles.
+
+SquareLine sets every property of every widget with its own call:
+lv_obj_set_style_*() plus lv_obj_set_width/height/x/y/align(), which are local
+style properties as well. Each call grows the widget's local style in the LVGL
+heap (a realloc per property), so building a screen costs a few hundred small
+allocations.
+
+This script collects the setters with constant arguments per widget and part,
+and replaces them with one LV_STYLE_CONST_INIT style in flash and a single
+lv_obj_add_style() call. Setters with non-constant arguments are left alone.
+Files that were already converted are skipped, so run it after every
+SquareLine export.
+
+Only the Python standard library is used.
+
+Usage (from the repository root):
+    python3 squareline/gen_const_styles.py
+"""
+
+import glob
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SCREENS = os.path.join(ROOT, "main", "UI", "screens", "ui_*.c")
+MARKER = "// CONST STYLES (generated by squareline/gen_const_styles.py)"
+
+DEFAULT_SELECTOR = "LV_PART_MAIN | LV_STATE_DEFAULT"
+POSITION_SETTERS = ("width", "height", "x", "y", "align")
+
+SETTER_RE = re.compile(
+    r"^\s*lv_obj_set_(?:style_(?P<style>\w+)|(?P<pos>" + "|".join(POSITION_SETTERS) + r"))"
+    r"\((?P<obj>\w+), (?P<value>[^;]+?)(?:, (?P<selector>LV_PART_\w+ \| LV_STATE_\w+))?\);"
+    r"(?:\s*///.*)?$")
+
+CONSTANT_RE = re.compile(r"^(-?\d+|0x[0-9a-fA-F]+|true|false|LV_[A-Z0-9_]+|&\w+)$")
+COLOR_RE = re.compile(r"^lv_color_hex\(0x([0-9a-fA-F]{6})\)$")
+PCT_RE = re.compile(r"^lv_pct\((-?\d+)\)$")
+
+
+def const_value(value):
+    """Initializer for a setter argument, or None if it is not a constant."""
+    value = value.strip()
+    m = COLOR_RE.match(value)
+    if m:
+        rgb = m.group(1)
+        return f"LV_COLOR_MAKE(0x{rgb[0:2]}, 0x{rgb[2:4]}, 0x{rgb[4:6]})"
+    m = PCT_RE.match(value)
+    if m:
+        return f"LV_PCT({m.group(1)})"
+    if CONSTANT_RE.match(value):
+        return value
+    return None
+
+
+def style_name(obj, selector):
+    """style_<widget>_<part>[_<state>] for a widget variable and selector."""
+    part, state = (s.strip() for s in selector.split("|"))
+    name = "style_" + re.sub(r"^c?ui_", "", obj) + "_" + part[len("LV_PART_"):].lower()
+    if state != "LV_STATE_DEFAULT":
+        name += "_" + state[len("LV_STATE_"):].lower()
+    return name
+
+
+def convert(path):
+    with open(path) as f:
+        lines = f.read().split("\n")
+    if MARKER in lines:
+        return None
+
+    # Group constant setters by widget and selector, keeping the first line of each group
+    groups = {}
+    order = []
+    first_line = {}
+    drop = set()
+    for i, line in enumerate(lines):
+        m = SETTER_RE.match(line)
+        if not m:
+            continue
+        value = const_value(m.group("value"))
+        if value is None:
+            continue
+        prop = (m.group("style") or m.group("pos")).upper()
+        selector = DEFAULT_SELECTOR if m.group("pos") else m.group("selector")
+        if selector is None:
+            continue
+        key = (m.group("obj"), selector)
+        if key not in groups:
+            groups[key] = {}
+            order.append(key)
+            first_line[i] = key
+        else:
+            drop.add(i)
+        groups[key][prop] = value
+
+    if not groups:
+        return None
+
+    out = []
+    for i, line in enumerate(lines):
+        if i in drop:
+            continue
+        if i in first_line:
+            obj, selector = first_line[i]
+            indent = line[:len(line) - len(line.lstrip())]
+            out.append(f"{indent}lv_obj_add_style({obj}, &{style_name(obj, selector)}, {selector});")
+            continue
+        # Drop the blank lines SquareLine put between the per-part setter blocks
+        if line.strip() == "" and out and out[-1].strip().startswith("lv_obj_add_style(") \
+                and i + 1 < len(lines) and (i + 1 in drop or i + 1 in first_line):
+            continue
+        out.append(line)
+
+    styles = [MARKER, ""]
+    for obj, selector in order:
+        name = style_name(obj, selector)
+        styles.append(f"static const lv_style_const_prop_t {name}_props[] = {{")
+        for prop, value in groups[(obj, selector)].items():
+            styles.append(f"    LV_STYLE_CONST_{prop}({value}),")
+        styles.append("    LV_STYLE_CONST_PROPS_END")
+        styles.append("};")
+        styles.append(f"static LV_STYLE_CONST_INIT({name}, {name}_props);")
+        styles.append("")
+
+    # Styles go in front of the generated functions
+    at = next(i for i, line in enumerate(out) if line.startswith("// event funtions"))
+    out[at:at] = styles
+
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(out))
+    return len(order), len(order) + len(drop)
+
+
+def main():
+    for path in sorted(glob.glob(SCREENS)):
+        result = convert(path)
+        rel = os.path.relpath(path, ROOT)
+        if result is None:
+            print(f"{rel}: nothing to convert")
+        else:
+            styles, setters = result
+            print(f"{rel}: {setters} setters -> {styles} const styles")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+"""
+Generate the digit-subset font used by the pressure readouts.
+
+ui_Label3/ui_Label4 only ever show "0-9 . -", but lv_font_montserrat_40 carries
+the full ASCII set plus symbols as 4 bpp bitmaps. Every glyph draw goes through
+the fmt_txt cmap search and unpacks the 4 bpp bitmap into a temporary A8
+buffer. This script cuts those 12 glyphs out of LVGL's Montserrat 40 source
+and writes ui_font_pressure_40:
+
+- glyph bitmaps pre-expanded to A8 (static bitmaps, blended straight from
+  flash by the software renderer, no unpacking)
+- a direct index table from character code to glyph
+- the Montserrat kerning resolved into a per-pair advance width table
+
+Only the Python standard library is used.
+
+Usage (from the repository root):
+    python3 squareline/gen_digit_font.py
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC_FONT = os.path.join(ROOT, "components", "lvgl-custom", "src", "font", "lv_font_montserrat_40.c")
+OUT_FILE = os.path.join(ROOT, "main", "UI", "fonts", "ui_font_pressure_40.c")
+FONT_NAME = "ui_font_pressure_40"
+
+CHARS = "-.0123456789"
+FIRST_CMAP_START = 0x20   # Montserrat cmap 0: U+0020..U+007E, glyph id 1 + (c - 0x20)
+OPA4 = [v * 17 for v in range(16)]
+
+
+def c_array(src, name):
+    m = re.search(r"\b" + name + r"\[\]\s*=\s*\{(.*?)\};", src, re.S)
+    if not m:
+        raise ValueError(f"{name} not found in {SRC_FONT}")
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", body)]
+
+
+def c_field(src, name):
+    m = re.search(r"\." + name + r"\s*=\s*(-?\d+)", src)
+    if not m:
+        raise ValueError(f"{name} not found in {SRC_FONT}")
+    return int(m.group(1))
+
+
+def load_font():
+    with open(SRC_FONT) as f:
+        src = f.read()
+
+    bitmap = c_array(src, "glyph_bitmap")
+    glyphs = []
+    for m in re.finditer(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), "
+                         r"\.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", src):
+        glyphs.append(tuple(int(v) for v in m.groups()))
+
+    font = {
+        "bitmap": bitmap,
+        "glyphs": glyphs,
+        "left_class": c_array(src, "kern_left_class_mapping"),
+        "right_class": c_array(src, "kern_right_class_mapping"),
+        "class_values": c_array(src, "kern_class_values"),
+        "right_class_cnt": c_field(src, "right_class_cnt"),
+        "kern_scale": c_field(src, "kern_scale"),
+        "bpp": c_field(src, "bpp"),
+        "line_height": c_field(src, "line_height"),
+        "base_line": c_field(src, "base_line"),
+        "underline_position": c_field(src, "underline_position"),
+        "underline_thickness": c_field(src, "underline_thickness"),
+    }
+    if font["bpp"] != 4:
+        raise ValueError("only 4 bpp source fonts are supported")
+    return font
+
+
+def gid_of(ch):
+    return 1 + ord(ch) - FIRST_CMAP_START
+
+
+def expand_a8(font, gid):
+    """Unpack a 4 bpp glyph (continuous nibble stream, no row padding) to A8."""
+    bitmap_index, _, box_w, box_h, _, _ = font["glyphs"][gid]
+    out = []
+    for i in range(box_w * box_h):
+        byte = font["bitmap"][bitmap_index + i // 2]
+        nibble = byte >> 4 if i % 2 == 0 else byte & 0xF
+        out.append(OPA4[nibble])
+    return out
+
+
+def advance(font, gid, gid_next):
+    """Advance width in px, as lv_font_get_glyph_dsc_fmt_txt() computes it."""
+    adv_w = font["glyphs"][gid][1]
+    if gid_next:
+        left = font["left_class"][gid]
+        right = font["right_class"][gid_next]
+        if left > 0 and right > 0:
+            k = font["class_values"][(left - 1) * font["right_class_cnt"] + (right - 1)]
+            adv_w += (k * font["kern_scale"]) >> 4
+    return (adv_w + 8) >> 4
+
+
+def generate():
+    font = load_font()
+    first, last = min(CHARS), max(CHARS)
+
+    # Glyph 0 is reserved for "not in this font"
+    bitmaps = []
+    glyph_rows = ["    {0, 0, 0, 0, 0},".ljust(32) + "/* id = 0 reserved */"]
+    offset = 0
+    for ch in CHARS:
+        gid = gid_of(ch)
+        _, _, box_w, box_h, ofs_x, ofs_y = font["glyphs"][gid]
+        a8 = expand_a8(font, gid)
+        bitmaps.append(f"    /* \"{ch}\" {box_w}x{box_h} */")
+        for y in range(box_h):
+            row = a8[y * box_w:(y + 1) * box_w]
+            bitmaps.append("    " + " ".join(f"0x{v:02x}," for v in row))
+        entry = f"    {{{offset}, {box_w}, {box_h}, {ofs_x}, {ofs_y}}},"
+        glyph_rows.append(entry.ljust(32) + f"/* \"{ch}\" */")
+        offset += len(a8)
+
+    index = []
+    for code in range(ord(first), ord(last) + 1):
+        ch = chr(code)
+        index.append(str(CHARS.index(ch) + 1) if ch in CHARS else "0")
+
+    adv_rows = []
+    for i, ch in enumerate(CHARS):
+        gid = gid_of(ch)
+        row = [advance(font, gid, 0)] + [advance(font, gid, gid_of(n)) for n in CHARS]
+        adv_rows.append("    {" + ", ".join(f"{v:2d}" for v in row) + f"}}, /* \"{ch}\" */")
+
+    raw_bytes = sum((font["glyphs"][gid_of(c)][2] * font["glyphs"][gid_of(c)][3] + 1) // 2 for c in CHARS)
+
+    src = f"""// This file was generated by squareline/gen_digit_font.py
+// Source: lv_font_montserrat_40.c, characters "{CHARS}" ({raw_bytes} bytes at 4 bpp)
+// Glyphs are stored as A8 and looked up through a direct index table.
+
+#include "../ui.h"
+
+#define FIRST_LETTER 0x{ord(first):02X}  /* '{first}' */
+#define LAST_LETTER  0x{ord(last):02X}  /* '{last}' */
+#define GLYPH_COUNT  {len(CHARS)}
+
+typedef struct {{
+    uint16_t bitmap_index;  /* Offset into glyph_bitmap */
+    uint8_t box_w;          /* Bitmap width = row stride in bytes */
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+}} glyph_t;
+
+/* A8 glyph bitmaps, one byte per pixel, no row padding */
+static const uint8_t glyph_bitmap[] = {{
+{chr(10).join(bitmaps)}
+}};
+
+static const glyph_t glyphs[GLYPH_COUNT + 1] = {{
+{chr(10).join(glyph_rows)}
+}};
+
+/* Character code - FIRST_LETTER -> glyph id (0 = not in this font) */
+static const uint8_t glyph_index[LAST_LETTER - FIRST_LETTER + 1] = {{
+    {", ".join(index)}
+}};
+
+/* Advance width in px including kerning: [glyph id - 1][next glyph id], next 0 = no kerning pair */
+static const uint8_t glyph_adv[GLYPH_COUNT][GLYPH_COUNT + 1] = {{
+{chr(10).join(adv_rows)}
+}};
+
+static uint32_t glyph_id(uint32_t letter)
+{{
+    if(letter < FIRST_LETTER || letter > LAST_LETTER) return 0;
+    return glyph_index[letter - FIRST_LETTER];
+}}
+
+static bool get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                          uint32_t letter_next)
+{{
+    LV_UNUSED(font);
+    uint32_t gid = glyph_id(letter);
+    if(gid == 0) return false;
+
+    const glyph_t * g = &glyphs[gid];
+    dsc_out->adv_w = glyph_adv[gid - 1][glyph_id(letter_next)];
+    dsc_out->box_w = g->box_w;
+    dsc_out->box_h = g->box_h;
+    dsc_out->ofs_x = g->ofs_x;
+    dsc_out->ofs_y = g->ofs_y;
+    dsc_out->stride = g->box_w;
+    dsc_out->format = LV_FONT_GLYPH_FORMAT_A8;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+    return true;
+}}
+
+static const void * get_glyph_bitmap(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
+{{
+    const glyph_t * g = &glyphs[g_dsc->gid.index];
+    const uint8_t * bitmap = &glyph_bitmap[g->bitmap_index];
+
+    /* Static bitmap: the software renderer blends straight from flash */
+    if(g_dsc->req_raw_bitmap) return bitmap;
+
+    /* Transformed text needs a copy with the draw buffer's stride */
+    uint32_t stride_out = lv_draw_buf_width_to_stride(g->box_w, LV_COLOR_FORMAT_A8);
+    uint8_t * out = draw_buf->data;
+    for(int32_t y = 0; y < g->box_h; y++) {{
+        lv_memcpy(out + y * stride_out, bitmap + y * g->box_w, g->box_w);
+    }}
+    lv_draw_buf_flush_cache(draw_buf, NULL);
+    return draw_buf;
+}}
+
+const lv_font_t {FONT_NAME} = {{
+    .get_glyph_dsc = get_glyph_dsc,
+    .get_glyph_bitmap = get_glyph_bitmap,
+    .line_height = {font["line_height"]},
+    .base_line = {font["base_line"]},
+    .subpx = LV_FONT_SUBPX_NONE,
+    .kerning = LV_FONT_KERNING_NORMAL,
+    .static_bitmap = 1,
+    .underline_position = {font["underline_position"]},
+    .underline_thickness = {font["underline_thickness"]},
+    .dsc = NULL,
+    .fallback = NULL,
+    .user_data = NULL,
+}};
+"""
+    os.makedirs(os.path.dirname(OUT_FILE), exist_ok=True)
+    with open(OUT_FILE, "w", newline="\n") as f:
+        f.write(src)
+    print(f"{os.path.relpath(OUT_FILE, ROOT)}: {len(CHARS)} glyphs, {offset} bytes A8 "
+          f"(full Montserrat 40: {len(font['bitmap'])} bytes at 4 bpp, {len(font['glyphs']) - 1} glyphs)")
+
+
+def main():
+    generate()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
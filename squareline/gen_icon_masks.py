@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+Generate A8 alpha-mask icons from the SquareLine assets.
+
+The TPMS and Bluetooth state icons only differ in colour, so instead of
+exporting one RGB565A8 image per state we keep a single 8-bit alpha mask per
+shape and colour it at runtime with the image_recolor style property
+(see UIController).
+
+Only the Python standard library is used (PNG is decoded with zlib), so this
+runs anywhere SquareLine exports do.
+
+Usage (from the repository root):
+    python3 squareline/gen_icon_masks.py
+
+Re-run after editing the source PNGs in squareline/assets.
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ASSETS = os.path.join(ROOT, "squareline", "assets")
+OUT_DIR = os.path.join(ROOT, "main", "UI", "images")
+
+# symbol name -> source asset (the colour of the asset is ignored)
+MASKS = {
+    "ui_img_tpms_mask": "tpmsblack.png",
+    "ui_img_bt_mask": "BToff.png",
+}
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png_alpha(path):
+    """Decode an 8-bit RGBA, non-interlaced PNG and return (w, h, alpha bytes)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG file")
+
+    pos = 8
+    idat = b""
+    w = h = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            w, h, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+            if depth != 8 or color != 6 or interlace != 0:
+                raise ValueError(f"{path}: only 8-bit RGBA non-interlaced PNGs are supported")
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+
+    raw = zlib.decompress(idat)
+    bpp = 4
+    stride = w * bpp
+    prev = bytearray(stride)
+    alpha = bytearray()
+    for y in range(h):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for x in range(stride):
+            a = line[x - bpp] if x >= bpp else 0
+            b = prev[x]
+            c = prev[x - bpp] if x >= bpp else 0
+            if ftype == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif ftype == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif ftype == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[x] = (line[x] + paeth(a, b, c)) & 0xFF
+        alpha += line[3::4]
+        prev = line
+    return w, h, bytes(alpha)
+
+
+def write_mask(name, asset):
+    w, h, alpha = read_png_alpha(os.path.join(ASSETS, asset))
+    rows = []
+    for y in range(h):
+        row = alpha[y * w:(y + 1) * w]
+        rows.append("    " + "".join(f"0x{v:02X}," for v in row))
+
+    src = (
+        "// This file was generated by squareline/gen_icon_masks.py\n"
+        f"// Source asset: assets/{asset} (alpha channel only)\n"
+        "\n"
+        '#include "../ui.h"\n'
+        "\n"
+        "#ifndef LV_ATTRIBUTE_MEM_ALIGN\n"
+        "    #define LV_ATTRIBUTE_MEM_ALIGN\n"
+        "#endif\n"
+        "\n"
+        f"// IMAGE DATA: assets/{asset} as A8 mask\n"
+        f"const LV_ATTRIBUTE_MEM_ALIGN uint8_t {name}_data[] = {{\n"
+        + "\n".join(rows) + "\n"
+        "};\n"
+        f"const lv_image_dsc_t {name} = {{\n"
+        f"    .header.w = {w},\n"
+        f"    .header.h = {h},\n"
+        f"    .header.stride = {w},\n"
+        f"    .data_size = sizeof({name}_data),\n"
+        "    .header.cf = LV_COLOR_FORMAT_A8,\n"
+        "    .header.magic = LV_IMAGE_HEADER_MAGIC,\n"
+        f"    .data = {name}_data\n"
+        "};\n"
+        "\n"
+    )
+    out = os.path.join(OUT_DIR, f"{name}.c")
+    with open(out, "w", newline="\n") as f:
+        f.write(src)
+    print(f"{asset} -> {os.path.relpath(out, ROOT)} ({w}x{h}, {len(alpha)} bytes)")
+
+
+def main():
+    for name, asset in MASKS.items():
+        write_mask(name, asset)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())